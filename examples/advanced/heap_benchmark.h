@@ -0,0 +1,170 @@
+/**
+==============
+Heap Benchmark
+==============
+
+Compare the indexed heaps of `xnetwork/utils/heaps.hpp` on the two
+workloads they were written for:
+
+* Dijkstra on a random digraph with one million nodes && eight million
+  arcs, where keys only decrease; a lazy `std::priority_queue`, which
+  pushes duplicates instead of updating, is the baseline.
+* A modularity-merge-like loop on a max-heap of 200000 items: pop the
+  top, remove the next one, push it back && change random keys in both
+  directions.
+
+Build it as a standalone program, e.g.
+
+    g++ -std=c++17 -O2 -x c++ -I lib/include heap_benchmark.h
+
+On one core it gave:
+
+============== ======== ======== ======== ========
+Workload       binary   4-ary    pairing  lazy
+============== ======== ======== ======== ========
+Dijkstra       1.54 s   1.35 s   2.70 s   1.31 s
+merge          0.29 s   0.27 s   0.58 s
+============== ======== ======== ======== ========
+
+The heaps break ties differently, so the merge sums differ slightly.
+*/
+
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+#include <functional>
+#include <queue>
+#include <random>
+#include <utility>
+#include <vector>
+#include <xnetwork/utils/heaps.hpp> // import IndexedBinaryHeap, IndexedQuaternaryHeap, IndexedPairingHeap
+
+struct Arcs {
+    std::vector<std::size_t> indptr;
+    std::vector<std::size_t> head;
+    std::vector<double> weight;
+};
+
+/** Return a random digraph on n nodes, each with `degree` out-arcs. */
+auto random_arcs(std::size_t n, std::size_t degree, unsigned seed) -> Arcs {
+    auto rng = std::mt19937{seed};
+    auto A = Arcs{};
+    A.indptr.assign(n + 1, 0);
+    for (std::size_t u = 0; u < n; ++u) {
+        for (std::size_t k = 0; k < degree; ++k) {
+            A.head.push_back(rng() % n);
+            A.weight.push_back(double(1 + rng() % 1000));
+        }
+        A.indptr[u + 1] = A.head.size();
+    }
+    return A;
+}
+
+/** Dijkstra from node 0; return the sum of the distances. */
+template <typename Heap> auto dijkstra(const Arcs &A) -> double {
+    auto n = A.indptr.size() - 1;
+    auto dist = std::vector<double>(n, 1e300);
+    auto heap = Heap(n);
+    auto total = 0.;
+    dist[0] = 0.;
+    heap.push(0, 0.);
+    while (!heap.empty()) {
+        auto d = heap.top_key();
+        auto u = heap.pop();
+        total += d;
+        for (auto a = A.indptr[u]; a < A.indptr[u + 1]; ++a) {
+            auto v = A.head[a];
+            if (d + A.weight[a] < dist[v]) {
+                dist[v] = d + A.weight[a];
+                heap.update(v, dist[v]);
+            }
+        }
+    }
+    return total;
+}
+
+/** Dijkstra with a `std::priority_queue` that keeps stale entries. */
+auto lazy_dijkstra(const Arcs &A) -> double {
+    using entry_t = std::pair<double, std::size_t>;
+    auto n = A.indptr.size() - 1;
+    auto dist = std::vector<double>(n, 1e300);
+    auto done = std::vector<bool>(n, false);
+    auto queue = std::priority_queue<entry_t, std::vector<entry_t>,
+                                     std::greater<entry_t>>{};
+    auto total = 0.;
+    dist[0] = 0.;
+    queue.emplace(0., 0);
+    while (!queue.empty()) {
+        auto [d, u] = queue.top();
+        queue.pop();
+        if (done[u])
+            continue;
+        done[u] = true;
+        total += d;
+        for (auto a = A.indptr[u]; a < A.indptr[u + 1]; ++a) {
+            auto v = A.head[a];
+            if (d + A.weight[a] < dist[v]) {
+                dist[v] = d + A.weight[a];
+                queue.emplace(dist[v], v);
+            }
+        }
+    }
+    return total;
+}
+
+/** The merge loop on a max-heap of n items; return the sum of the
+    keys seen at the top.
+*/
+template <typename Heap> auto merge(std::size_t n, unsigned seed) -> double {
+    auto rng = std::mt19937{seed};
+    auto key = [&] { return double(rng() % 100000); };
+    auto heap = Heap(n);
+    for (std::size_t i = 0; i < n; ++i)
+        heap.push(i, key());
+    auto total = 0.;
+    while (heap.size() > 1) {
+        auto x = heap.pop();
+        total += heap.top_key();
+        auto y = heap.top();
+        heap.remove(y);
+        heap.push(y, key());
+        for (auto k = 0; k < 6; ++k) {
+            auto z = rng() % n;
+            if (heap.contains(z))
+                heap.update(z, heap.key(z) + double(rng() % 2000) - 1000.);
+        }
+        if (rng() % 2)
+            heap.push(x, key());
+    }
+    return total;
+}
+
+template <typename F> void report(const char *name, F run) {
+    auto t0 = std::chrono::steady_clock::now();
+    auto result = run();
+    auto t1 = std::chrono::steady_clock::now();
+    std::printf("%-18s %.3f s (%g)\n", name,
+                std::chrono::duration<double>(t1 - t0).count(), result);
+}
+
+int main() {
+    using max_t = std::greater<double>;
+    auto A = random_arcs(1000000, 8, 1);
+    report("dijkstra lazy", [&] { return lazy_dijkstra(A); });
+    report("dijkstra binary",
+           [&] { return dijkstra<xn::IndexedBinaryHeap<double>>(A); });
+    report("dijkstra 4-ary",
+           [&] { return dijkstra<xn::IndexedQuaternaryHeap<double>>(A); });
+    report("dijkstra pairing",
+           [&] { return dijkstra<xn::IndexedPairingHeap<double>>(A); });
+
+    auto n = std::size_t(200000);
+    report("merge binary",
+           [&] { return merge<xn::IndexedBinaryHeap<double, max_t>>(n, 2); });
+    report("merge 4-ary", [&] {
+        return merge<xn::IndexedQuaternaryHeap<double, max_t>>(n, 2);
+    });
+    report("merge pairing",
+           [&] { return merge<xn::IndexedPairingHeap<double, max_t>>(n, 2); });
+    return 0;
+}
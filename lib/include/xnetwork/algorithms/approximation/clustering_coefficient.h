@@ -5,15 +5,22 @@
 //   All rights reserved.
 //   BSD license.
 import random
+#include <xnetwork/algorithms/approximation/clustering_coefficient.hpp> // import sample_average_clustering, sample_transitivity, sample_triangle_count, sample_local_triangles, StreamingTriangleEstimator
+#include <xnetwork/classes/csr.hpp> // import to_csr
 #include <xnetwork/utils.hpp> // import not_implemented_for
 
-static const auto __all__ = ["average_clustering"];
+static const auto __all__ = ["average_clustering",
+                             "estimate_average_clustering",
+                             "estimate_transitivity",
+                             "estimate_triangles",
+                             "estimate_local_triangles",
+                             "streaming_transitivity"];
 __author__ = R"(\n)".join(["Fred Morstatter <fred.morstatter@asu.edu>",
                             "Jordi Torrents <jtorrents@milnou.net>"]);
 
 
 /// @not_implemented_for("directed");
-auto average_clustering(G, trials=1000) {
+auto average_clustering(G, trials=1000, seed=None) {
     r/** Estimates the average clustering coefficient of G.
 
     The local clustering of each node : `G` is the fraction of triangles
@@ -35,6 +42,10 @@ auto average_clustering(G, trials=1000) {
     trials : integer
         Number of trials to perform (default 1000).
 
+    seed : integer, optional
+        Seed of the random number generator; the result for a given seed
+        does not depend on the number of threads.
+
     Returns
     -------
     c : double
@@ -48,14 +59,127 @@ auto average_clustering(G, trials=1000) {
        http://www.emis.ams.org/journals/JGAA/accepted/2005/SchankWagner2005.9.2.pdf
 
     */
-    n = len(G);
-    triangles = 0.;
+    return estimate_average_clustering(G, trials=trials, seed=seed)[0];
+
+
+auto _sample_seed(seed) {
+    if (seed is None) {
+        return random.getrandbits(64);
+    return seed;
+
+
+/// @not_implemented_for("directed");
+auto estimate_average_clustering(G, trials=1000, confidence=0.95, seed=None) {
+    r/** Estimate the average clustering coefficient of G with an interval.
+
+    Same experiment as `average_clustering`, run in parallel; the
+    fraction of closed trials is returned together with its Wilson
+    score interval at the given confidence level.
+
+    Returns
+    -------
+    (c, (lower, upper)) : (double, (double, double));
+        The estimate && its confidence interval.
+    */
+    E = xn::sample_average_clustering(xn::to_csr(G), trials, confidence,
+                                      _sample_seed(seed));
+    return E.value, (E.lower, E.upper);
+
+
+/// @not_implemented_for("directed");
+auto estimate_transitivity(G, trials=1000, confidence=0.95, seed=None) {
+    r/** Estimate the transitivity of G by uniform wedge sampling.
+
+    Each trial draws a path of length two uniformly at random (its center
+    with probability proportional to the number of neighbor pairs) and
+    checks whether it closes into a triangle [1]_.
+
+    Returns
+    -------
+    (t, (lower, upper)) : (double, (double, double));
+        The estimate && its Wilson score interval.
+
+    References
+    ----------
+    .. [1] C. Seshadhri, A. Pinar, T. G. Kolda. "Wedge sampling for
+       computing clustering coefficients && triangle counts on large
+       graphs." Statistical Analysis && Data Mining 7(4), 2014.
+    */
+    E = xn::sample_transitivity(xn::to_csr(G), trials, confidence,
+                                _sample_seed(seed));
+    return E.value, (E.lower, E.upper);
+
+
+/// @not_implemented_for("directed");
+auto estimate_triangles(G, trials=1000, confidence=0.95, seed=None) {
+    r/** Estimate the number of triangles of G by edge sampling.
+
+    Each trial picks a uniform edge && counts the triangles through it
+    exactly; the scaled mean is unbiased && the interval uses the normal
+    approximation.
+
+    Returns
+    -------
+    (t, (lower, upper)) : (double, (double, double));
+        The estimated triangle count && its confidence interval.
+    */
+    E = xn::sample_triangle_count(xn::to_csr(G), trials, confidence,
+                                  _sample_seed(seed));
+    return E.value, (E.lower, E.upper);
+
+
+/// @not_implemented_for("directed");
+auto estimate_local_triangles(G, wedges=64, confidence=0.95, seed=None) {
+    r/** Estimate the number of triangles through each node of G.
+
+    For every node, up to `wedges` random pairs of neighbors are tested
+    && the closed fraction is scaled by the number of pairs; nodes with
+    at most `wedges` pairs are counted exactly.
+
+    Returns
+    -------
+    triangles : dictionary
+        Keyed by node, `(estimate, (lower, upper))`.
+    */
     nodes = list(G);
-    for (auto i : [int(random.random() * n) for i : range(trials)]) {
-        nbrs = list(G[nodes[i]]);
-        if (len(nbrs) < 2) {
-            continue;
-        auto [u, v] = random.sample(nbrs, 2);
-        if (u : G[v]) {
-            triangles += 1;
-    return triangles / double(trials);
+    E = xn::sample_local_triangles(xn::to_csr(G), wedges, confidence,
+                                   _sample_seed(seed));
+    return {nodes[i]: (E.value[i], (E.lower[i], E.upper[i]))
+            for (auto i : range(len(nodes))};
+
+
+auto streaming_transitivity(edges, reservoir_size=1000000, seed=None) {
+    r/** Estimate triangles && transitivity of an edge stream.
+
+    The edges are consumed once && never stored as a graph: a uniform
+    reservoir of at most `reservoir_size` edges is kept && every
+    triangle closed by an arriving edge within the reservoir is counted
+    with the inverse of its sampling probability (TRIEST-IMPR [1]_).
+    The number of wedges is exact, as it only needs the node degrees.
+    Self loops are skipped; repeated edges must not occur in the stream.
+
+    Parameters
+    ----------
+    edges : iterable of (u, v) pairs
+        For instance `xn::iter_edgelist(path)`.
+
+    reservoir_size : integer
+        Maximum number of edges kept in memory.
+
+    Returns
+    -------
+    (transitivity, triangles) : (double, double);
+        Point estimates; no interval is given.
+
+    References
+    ----------
+    .. [1] L. De Stefani, A. Epasto, M. Riondato, E. Upfal. "TRIEST:
+       Counting local && global triangles in fully dynamic streams with
+       fixed memory size." KDD 2016.
+    */
+    S = xn::StreamingTriangleEstimator(reservoir_size, _sample_seed(seed));
+    index = {};
+    for (auto [u, v] : edges) {
+        S.add_edge(index.setdefault(u, len(index)),
+                   index.setdefault(v, len(index)));
+    return S.transitivity(), S.triangles();
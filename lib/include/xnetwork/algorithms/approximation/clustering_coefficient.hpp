@@ -0,0 +1,456 @@
+#ifndef _HOME_UBUNTU_GITHUB_XNETWORK_ALGORITHMS_APPROXIMATION_CLUSTERING_COEFFICIENT_HPP
+#define _HOME_UBUNTU_GITHUB_XNETWORK_ALGORITHMS_APPROXIMATION_CLUSTERING_COEFFICIENT_HPP 1
+
+//    Copyright (C) 2004-2018 by
+//    Wai-Shing Luk <luk036@gmail.com>
+//
+//
+//    All rights reserved.
+//    BSD license.
+/**
+Sampling estimators for triangles && clustering, batch && streaming.
+*/
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+#include <xnetwork/classes/csr.hpp> // import CSRGraph
+#include <xnetwork/exception.hpp> // import XNetworkNotImplemented, XNetworkError
+#include <xnetwork/utils/parallel.hpp> // import parallel_for
+
+namespace xn {
+
+/** A point estimate with a two-sided confidence interval. */
+struct ApproxEstimate {
+    double value = 0.0;
+    double lower = 0.0;
+    double upper = 0.0;
+    std::size_t samples = 0;
+};
+
+/** Return the standard normal quantile z with P(Z <= z) = p.
+
+    Acklam's rational approximation, accurate to about 1e-9.
+*/
+inline auto _normal_quantile(double p) -> double {
+    static const double a[] = {-3.969683028665376e+01, 2.209460984245205e+02,
+                               -2.759285104469687e+02, 1.383577518672690e+02,
+                               -3.066479806614716e+01, 2.506628277459239e+00};
+    static const double b[] = {-5.447609879822406e+01, 1.615858368580409e+02,
+                               -1.556989798598866e+02, 6.680131188771972e+01,
+                               -1.328068155288572e+01};
+    static const double c[] = {-7.784894002430293e-03, -3.223964580411365e-01,
+                               -2.400758277161838e+00, -2.549732539343734e+00,
+                               4.374664141464968e+00,  2.938163982698783e+00};
+    static const double d[] = {7.784695709041462e-03, 3.224671290700398e-01,
+                               2.445134137142996e+00, 3.754408661907416e+00};
+    if (p <= 0.0 || p >= 1.0)
+        throw XNetworkError("quantile level must lie in (0, 1)");
+    auto tail = [&](double q) {
+        return (((((c[0] * q + c[1]) * q + c[2]) * q + c[3]) * q + c[4]) * q +
+                c[5]) /
+               ((((d[0] * q + d[1]) * q + d[2]) * q + d[3]) * q + 1);
+    };
+    if (p < 0.02425)
+        return tail(std::sqrt(-2 * std::log(p)));
+    if (p > 1 - 0.02425)
+        return -tail(std::sqrt(-2 * std::log(1 - p)));
+    auto q = p - 0.5, r = q * q;
+    return (((((a[0] * r + a[1]) * r + a[2]) * r + a[3]) * r + a[4]) * r +
+            a[5]) *
+           q /
+           (((((b[0] * r + b[1]) * r + b[2]) * r + b[3]) * r + b[4]) * r + 1);
+}
+
+/** Wilson score interval for `hits` successes out of `trials`. */
+inline auto _wilson_estimate(std::size_t hits, std::size_t trials,
+                             double confidence) -> ApproxEstimate {
+    auto E = ApproxEstimate{};
+    E.samples = trials;
+    if (trials == 0)
+        return E;
+    auto z = _normal_quantile(0.5 + confidence / 2);
+    auto s = double(trials), p = double(hits) / s, z2 = z * z;
+    auto center = (p + z2 / (2 * s)) / (1 + z2 / s);
+    auto half =
+        z / (1 + z2 / s) * std::sqrt(p * (1 - p) / s + z2 / (4 * s * s));
+    E.value = p;
+    E.lower = std::max(0.0, center - half);
+    E.upper = std::min(1.0, center + half);
+    return E;
+}
+
+/** Return true if `v` is a neighbor of `u` (binary search, sorted rows). */
+template <typename W>
+auto _has_arc(const CSRGraph<W> &G, std::size_t u, std::size_t v) -> bool {
+    if (G.degree(u) > G.degree(v))
+        std::swap(u, v);
+    auto [b, e] = G.neighbors(u);
+    return std::binary_search(b, e, typename CSRGraph<W>::index_t(v));
+}
+
+/** Return the `[begin, end)` range of the self loops in the row of v. */
+template <typename W>
+auto _self_loops(const CSRGraph<W> &G, std::size_t v) {
+    auto [b, e] = G.neighbors(v);
+    return std::equal_range(b, e, typename CSRGraph<W>::index_t(v));
+}
+
+/** Return the number of neighbors of v other than v itself. */
+template <typename W>
+auto _simple_degree(const CSRGraph<W> &G, std::size_t v) -> std::size_t {
+    auto [lo, hi] = _self_loops(G, v);
+    return G.degree(v) - std::size_t(hi - lo);
+}
+
+/** Return whether a uniformly random pair of neighbors of v is linked.
+
+    Self loops are skipped, so v needs two other neighbors.
+*/
+template <typename W, typename Rng>
+auto _sample_wedge_closed(const CSRGraph<W> &G, std::size_t v, Rng &rng)
+    -> bool {
+    auto [b, e] = G.neighbors(v);
+    auto [lo, hi] = _self_loops(G, v);
+    auto before = std::size_t(lo - b);
+    auto d = G.degree(v) - std::size_t(hi - lo);
+    auto i = std::uniform_int_distribution<std::size_t>(0, d - 1)(rng);
+    auto j = std::uniform_int_distribution<std::size_t>(0, d - 2)(rng);
+    j += j >= i;
+    auto at = [&](std::size_t k) { return k < before ? b[k] : hi[k - before]; };
+    return _has_arc(G, at(i), at(j));
+}
+
+/** Run `trials` Bernoulli trials in parallel; return the hit count.
+
+    Trials are split into fixed chunks && chunk `c` draws from
+    `mt19937_64{seed + c}`, so the result does not depend on the number
+    of threads.
+*/
+template <typename Trial>
+auto _parallel_trials(std::size_t trials, std::uint64_t seed,
+                      unsigned num_threads, Trial &&trial) -> std::size_t {
+    constexpr auto chunk = std::size_t(4096);
+    const auto nchunks = (trials + chunk - 1) / chunk;
+    auto hits = std::vector<std::size_t>(nchunks, 0);
+    parallel_for(
+        nchunks,
+        [&](std::size_t c, unsigned) {
+            auto rng = std::mt19937_64{seed + c};
+            auto last = std::min(trials, (c + 1) * chunk);
+            for (auto k = c * chunk; k < last; ++k)
+                hits[c] += trial(rng);
+        },
+        num_threads, 1);
+    auto total = std::size_t(0);
+    for (auto h : hits)
+        total += h;
+    return total;
+}
+
+template <typename W> void _require_undirected_sample(const CSRGraph<W> &G) {
+    if (G.directed)
+        throw XNetworkNotImplemented("not implemented for directed type");
+}
+
+/** Estimate the average clustering coefficient by node sampling.
+
+    Each trial picks a node uniformly && a random pair of its
+    neighbors && checks whether they are linked; nodes of degree < 2
+    count as 0 [1]_.  The fraction of closed trials is an unbiased
+    estimate of the average clustering, with a Wilson interval.  Self
+    loops are ignored here && by the other samplers, as in `clustering`.
+
+    References
+    ----------
+    .. [1] Schank, Thomas, && Dorothea Wagner. Approximating clustering
+       coefficient && transitivity. Journal of Graph Algorithms &&
+       Applications 9(2), 2005.
+*/
+template <typename W>
+auto sample_average_clustering(const CSRGraph<W> &G, std::size_t trials,
+                               double confidence = 0.95,
+                               std::uint64_t seed = 0,
+                               unsigned num_threads = 0) -> ApproxEstimate {
+    _require_undirected_sample(G);
+    const auto n = G.num_nodes();
+    if (n == 0)
+        return _wilson_estimate(0, trials, confidence);
+    auto hits = _parallel_trials(trials, seed, num_threads, [&](auto &rng) {
+        auto v = std::uniform_int_distribution<std::size_t>(0, n - 1)(rng);
+        return _simple_degree(G, v) >= 2 && _sample_wedge_closed(G, v, rng);
+    });
+    return _wilson_estimate(hits, trials, confidence);
+}
+
+/** Estimate the transitivity by uniform wedge sampling.
+
+    A wedge (path of length two) is drawn uniformly by picking its
+    center with probability proportional to `d(d-1)/2` (binary search
+    over the prefix sums) && then a random pair of neighbors; the
+    fraction of closed wedges estimates the transitivity [1]_, with a
+    Wilson interval.
+
+    References
+    ----------
+    .. [1] C. Seshadhri, A. Pinar, T. G. Kolda. "Wedge sampling for
+       computing clustering coefficients && triangle counts on large
+       graphs." Statistical Analysis && Data Mining 7(4), 2014.
+*/
+template <typename W>
+auto sample_transitivity(const CSRGraph<W> &G, std::size_t trials,
+                         double confidence = 0.95, std::uint64_t seed = 0,
+                         unsigned num_threads = 0) -> ApproxEstimate {
+    _require_undirected_sample(G);
+    const auto n = G.num_nodes();
+    auto wedges = std::vector<double>(n + 1, 0.0);
+    for (std::size_t v = 0; v < n; ++v) {
+        auto d = double(_simple_degree(G, v));
+        wedges[v + 1] = wedges[v] + d * (d - 1) / 2;
+    }
+    if (wedges[n] == 0)
+        return _wilson_estimate(0, trials, confidence);
+    auto hits = _parallel_trials(trials, seed, num_threads, [&](auto &rng) {
+        auto r = std::uniform_real_distribution<double>(0, wedges[n])(rng);
+        auto v = std::size_t(
+            std::upper_bound(wedges.begin() + 1, wedges.end(), r) -
+            wedges.begin() - 1);
+        return _sample_wedge_closed(G, v, rng);
+    });
+    return _wilson_estimate(hits, trials, confidence);
+}
+
+/** Estimate the number of triangles by edge sampling.
+
+    Each trial picks an edge `(u, v)` uniformly && counts the common
+    neighbors of its endpoints exactly by a sorted merge; the count
+    times `m / 3` is an unbiased estimate of the triangle count.  The
+    interval is the normal one from the sample variance.
+*/
+template <typename W>
+auto sample_triangle_count(const CSRGraph<W> &G, std::size_t trials,
+                           double confidence = 0.95, std::uint64_t seed = 0,
+                           unsigned num_threads = 0) -> ApproxEstimate {
+    _require_undirected_sample(G);
+    auto E = ApproxEstimate{};
+    E.samples = trials;
+    const auto nnz = G.num_arcs();
+    if (nnz == 0 || trials == 0)
+        return E;
+    constexpr auto chunk = std::size_t(4096);
+    const auto nchunks = (trials + chunk - 1) / chunk;
+    auto sum = std::vector<double>(nchunks, 0.0);
+    auto sum2 = std::vector<double>(nchunks, 0.0);
+    parallel_for(
+        nchunks,
+        [&](std::size_t c, unsigned) {
+            auto rng = std::mt19937_64{seed + c};
+            auto pick = std::uniform_int_distribution<std::size_t>(0, nnz - 1);
+            auto last = std::min(trials, (c + 1) * chunk);
+            for (auto k = c * chunk; k < last; ++k) {
+                auto a = pick(rng);
+                auto u = std::size_t(
+                    std::upper_bound(G.indptr.begin(), G.indptr.end(), a) -
+                    G.indptr.begin() - 1);
+                auto v = std::size_t(G.indices[a]);
+                auto common = 0.0;
+                if (u != v) {
+                    auto [ub, ue] = G.neighbors(u);
+                    auto [vb, ve] = G.neighbors(v);
+                    while (ub != ue && vb != ve) {
+                        if (*ub < *vb)
+                            ++ub;
+                        else if (*vb < *ub)
+                            ++vb;
+                        else {
+                            common += *ub != u && *ub != v;
+                            ++ub, ++vb;
+                        }
+                    }
+                }
+                sum[c] += common;
+                sum2[c] += common * common;
+            }
+        },
+        num_threads, 1);
+    auto s1 = 0.0, s2 = 0.0;
+    for (std::size_t c = 0; c < nchunks; ++c)
+        s1 += sum[c], s2 += sum2[c];
+    auto s = double(trials);
+    auto mean = s1 / s;
+    auto var = trials > 1 ? std::max(0.0, (s2 - s * mean * mean) / (s - 1))
+                          : 0.0;
+    // each arc stands for half an edge, so m / 3 = nnz / 6
+    auto scale = double(nnz) / 6;
+    auto half = _normal_quantile(0.5 + confidence / 2) * std::sqrt(var / s);
+    E.value = scale * mean;
+    E.lower = std::max(0.0, scale * (mean - half));
+    E.upper = scale * (mean + half);
+    return E;
+}
+
+/** Per-node triangle estimates, as returned by `sample_local_triangles`. */
+struct LocalTriangleEstimates {
+    std::vector<double> value;
+    std::vector<double> lower;
+    std::vector<double> upper;
+};
+
+/** Estimate the number of triangles through every node.
+
+    Node `v` draws `wedges` random pairs of its neighbors; the closed
+    fraction (with its Wilson interval) times `d(d-1)/2` estimates its
+    triangle count.  Nodes with at most `wedges` neighbor pairs are
+    counted exactly instead.  Node `v` draws from `mt19937_64{seed + v}`.
+*/
+template <typename W>
+auto sample_local_triangles(const CSRGraph<W> &G, std::size_t wedges = 64,
+                            double confidence = 0.95, std::uint64_t seed = 0,
+                            unsigned num_threads = 0)
+    -> LocalTriangleEstimates {
+    _require_undirected_sample(G);
+    const auto n = G.num_nodes();
+    auto L = LocalTriangleEstimates{std::vector<double>(n, 0.0),
+                                    std::vector<double>(n, 0.0),
+                                    std::vector<double>(n, 0.0)};
+    parallel_for(
+        n,
+        [&](std::size_t v, unsigned) {
+            auto d = _simple_degree(G, v);
+            if (d < 2)
+                return;
+            auto pairs = double(d) * double(d - 1) / 2;
+            auto [b, e] = G.neighbors(v);
+            if (pairs <= double(wedges)) {
+                auto t = 0.0;
+                for (auto i = b; i != e; ++i)
+                    for (auto j = i + 1; j != e; ++j)
+                        t += *i != v && *j != v && _has_arc(G, *i, *j);
+                L.value[v] = L.lower[v] = L.upper[v] = t;
+                return;
+            }
+            auto rng = std::mt19937_64{seed + v};
+            auto hits = std::size_t(0);
+            for (std::size_t k = 0; k < wedges; ++k)
+                hits += _sample_wedge_closed(G, v, rng);
+            auto E = _wilson_estimate(hits, wedges, confidence);
+            L.value[v] = E.value * pairs;
+            L.lower[v] = E.lower * pairs;
+            L.upper[v] = E.upper * pairs;
+        },
+        num_threads, 256);
+    return L;
+}
+
+/** Streaming triangle && transitivity estimator over an edge stream.
+
+    Implements TRIEST-IMPR [1]_: a uniform reservoir of at most
+    `reservoir_size` edges is kept, && every arriving edge `(u, v)`
+    first adds `max(1, (t-1)(t-2) / (M(M-1)))` to the triangle estimate
+    for each common neighbor of `u` && `v` in the reservoir, where t is
+    the number of edges seen && M the reservoir size.  The estimate is
+    unbiased; memory is O(M) for the sample plus one degree counter
+    per node, which also gives the exact wedge count for the
+    transitivity `3 T / wedges`.  The stream must not repeat an edge;
+    self loops are skipped.
+
+    References
+    ----------
+    .. [1] L. De Stefani, A. Epasto, M. Riondato, E. Upfal. "TRIEST:
+       Counting local && global triangles in fully-dynamic streams
+       with fixed memory size." KDD 2016.
+*/
+class StreamingTriangleEstimator {
+  public:
+    using node_t = std::uint64_t;
+
+    explicit StreamingTriangleEstimator(std::size_t reservoir_size,
+                                        std::uint64_t seed = 0)
+        : _capacity{std::max<std::size_t>(reservoir_size, 2)}, _rng{seed} {
+        this->_sample.reserve(this->_capacity);
+    }
+
+    /** Feed one edge of the stream. */
+    void add_edge(node_t u, node_t v) {
+        if (u == v)
+            return;
+        ++this->_t;
+        for (auto x : {u, v})
+            this->_wedges += double(this->_degree[x]++);
+
+        // count before sampling, as in TRIEST-IMPR
+        auto M = double(this->_capacity), t = double(this->_t);
+        auto eta = std::max(1.0, (t - 1) * (t - 2) / (M * (M - 1)));
+        auto iu = this->_adj.find(u), iv = this->_adj.find(v);
+        if (iu != this->_adj.end() && iv != this->_adj.end()) {
+            const auto *small = &iu->second, *large = &iv->second;
+            if (small->size() > large->size())
+                std::swap(small, large);
+            for (auto w : *small)
+                if (large->count(w))
+                    this->_triangles += eta;
+        }
+
+        if (this->_sample.size() < this->_capacity) {
+            this->_insert(u, v);
+            this->_sample.emplace_back(u, v);
+            return;
+        }
+        auto r = std::uniform_int_distribution<std::uint64_t>(
+            0, this->_t - 1)(this->_rng);
+        if (r < this->_capacity) {
+            auto &slot = this->_sample[r];
+            this->_erase(slot.first, slot.second);
+            this->_insert(u, v);
+            slot = {u, v};
+        }
+    }
+
+    /** Number of edges seen (self loops excluded). */
+    auto edges() const { return this->_t; }
+
+    /** Unbiased estimate of the number of triangles so far. */
+    auto triangles() const { return this->_triangles; }
+
+    /** Exact number of wedges (paths of length two) so far. */
+    auto wedges() const { return this->_wedges; }
+
+    /** Estimated transitivity `3 T / wedges` (0 without wedges). */
+    auto transitivity() const -> double {
+        return this->_wedges == 0 ? 0.0 : 3 * this->_triangles / this->_wedges;
+    }
+
+  private:
+    std::size_t _capacity;
+    std::mt19937_64 _rng;
+    std::uint64_t _t = 0;
+    double _triangles = 0.0;
+    double _wedges = 0.0;
+    std::vector<std::pair<node_t, node_t>> _sample;
+    std::unordered_map<node_t, std::unordered_set<node_t>> _adj;
+    std::unordered_map<node_t, std::uint64_t> _degree;
+
+    void _insert(node_t u, node_t v) {
+        this->_adj[u].insert(v);
+        this->_adj[v].insert(u);
+    }
+
+    void _erase(node_t u, node_t v) {
+        for (auto [a, b] : {std::pair{u, v}, std::pair{v, u}}) {
+            auto it = this->_adj.find(a);
+            it->second.erase(b);
+            if (it->second.empty())
+                this->_adj.erase(it);
+        }
+    }
+};
+
+} // namespace xn
+
+#endif
@@ -1,4 +1,4 @@
-from nose.tools import assert_equal
+from nose.tools import assert_equal, assert_true
 #include <xnetwork.hpp> // as xn
 from xnetwork.algorithms.approximation import average_clustering
 
@@ -37,3 +37,49 @@ auto test_complete() {
     assert_equal(average_clustering(G, trials=int(len(G) / 2)), 1);
     G = xn::complete_graph(7);
     assert_equal(average_clustering(G, trials=int(len(G) / 2)), 1);
+
+
+auto test_estimates_complete() {
+    // closed wedges only, so every estimator is exact
+    G = xn::complete_graph(6);
+    c, (lo, hi) = xn::estimate_average_clustering(G, trials=100, seed=1);
+    assert_equal(c, 1);
+    assert_equal(hi, 1);
+    assert_equal(xn::estimate_transitivity(G, trials=100, seed=1)[0], 1);
+    assert_equal(xn::estimate_triangles(G, trials=100, seed=1)[0], 20);
+    local = xn::estimate_local_triangles(G, seed=1);
+    assert_equal(local[0], (10, (10, 10)));
+    assert_equal(xn::streaming_transitivity(G.edges(), seed=1), (1, 20));
+
+
+auto test_estimates_random() {
+    // open && closed wedges: seeded estimates near the exact values
+    G = xn::gnp_random_graph(100, 0.1, seed=3);
+    c, (lo, hi) = xn::estimate_average_clustering(G, trials=20000, seed=1);
+    assert_true(abs(c - xn::average_clustering(G)) < 0.02);
+    assert_true(lo <= c && c <= hi);
+    t, (lo, hi) = xn::estimate_transitivity(G, trials=20000, seed=1);
+    assert_true(abs(t - xn::transitivity(G)) < 0.02);
+    assert_true(lo <= t && t <= hi);
+    T = sum(xn::triangles(G).values()) / 3;
+    assert_true(abs(xn::estimate_triangles(G, trials=20000, seed=1)[0] - T)
+                < 0.05 * T);
+    m = G.number_of_edges();
+    assert_true(abs(xn::streaming_transitivity(G.edges(), m / 2, seed=1)[1] - T)
+                < 0.4 * T);
+
+
+auto test_estimates_self_loops() {
+    // self loops are ignored, so the same seed gives the same estimates
+    G = xn::gnp_random_graph(100, 0.1, seed=3);
+    H = G.copy();
+    H.add_edges_from([(v, v) for v : range(0, 100, 7)]);
+    for (auto estimate : [xn::estimate_average_clustering,
+                          xn::estimate_transitivity]) {
+        assert_equal(estimate(H, trials=1000, seed=2),
+                     estimate(G, trials=1000, seed=2));
+    assert_equal(xn::estimate_local_triangles(H, wedges=16, seed=2),
+                 xn::estimate_local_triangles(G, wedges=16, seed=2));
+    // a reservoir holding the whole stream counts exactly
+    T = sum(xn::triangles(G).values()) / 3;
+    assert_equal(xn::streaming_transitivity(H.edges(), seed=2)[1], T);
@@ -8,9 +8,9 @@
 // XNetwork is distributed under a BSD license; see LICENSE.txt for more
 // information.
 /** Bridge-finding algorithms. */
-from itertools import chain
-
 #include <xnetwork.hpp> // as xn
+#include <xnetwork/algorithms/components/biconnected.hpp> // import biconnected_dfs
+#include <xnetwork/classes/csr.hpp> // import to_csr
 #include <xnetwork/utils.hpp> // import not_implemented_for
 
 static const auto __all__ = ["bridges", "has_bridges", "local_bridges"];
@@ -54,24 +54,26 @@ auto bridges(G, root=None) {
 
     Notes
     -----
-    This is an implementation of the algorithm described : _[1].  An edge is a
-    bridge if (and only if (it is not contained : any chain. Chains are found
-    using the :func:`xnetwork.chain_decomposition` function.
-
-    Ignoring polylogarithmic factors, the worst-case time complexity is the
-    same as the :func:`xnetwork.chain_decomposition` function,
-    $O(m + n)$, where $n$ is the number of nodes : the graph && $m$ is
-    the number of edges.
+    A tree edge `(u, v)` of a depth-first search is a bridge if and only
+    if no back edge leaves the subtree of `v` above `v`, that is, if its
+    low point exceeds the preorder number of `u` [1]_.  Bridges are read
+    off the iterative Hopcroft-Tarjan search of `biconnected_dfs`, which
+    runs over dense arrays with an explicit stack, in $O(m + n)$ time,
+    where $n$ is the number of nodes : the graph && $m$ is the number of
+    edges.  Each bridge is yielded as `(parent, child)` of that search.
 
     References
     ----------
     .. [1] https://en.wikipedia.org/wiki/Bridge_%28graph_theory%29// Bridge-Finding_with_Chain_Decompositions
     */
-    chains = xn::chain_decomposition(G, root=root);
-    chain_edges = set(chain.from_iterable(chains));
-    for (auto [u, v] : G.edges() {
-        if ((u, v) not : chain_edges && (v, u) not : chain_edges) {
-            yield u, v
+    if (root != None && !G.has_node(root)) {
+        throw xn::NodeNotFound("root node not in graph");
+    nodes = list(G);
+    auto r = root == None ? xn::BiconnectedDFS::none : G._node_map[root];
+    dfs = xn::biconnected_dfs(xn::to_csr(G), /*with_blocks=*/false,
+                              /*with_back_edges=*/false, r);
+    for (auto [u, v] : dfs.bridges) {
+        yield nodes[u], nodes[v]
 
 
 /// @not_implemented_for("multigraph");
@@ -117,18 +119,16 @@ auto has_bridges(G, root=None) {
 
     Notes
     -----
-    This implementation uses the :func:`xnetwork.bridges` function, so
-    it shares its worst-case time complexity, $O(m + n)$, ignoring
+    This implementation uses the same search as :func:`xnetwork.bridges`,
+    so it shares its worst-case time complexity, $O(m + n)$, ignoring
     polylogarithmic factors, where $n$ is the number of nodes : the
     graph && $m$ is the number of edges.
 
     */
-    try {
-        next(bridges(G));
-    } catch (StopIteration) {
-        return false;
-    } else {
-        return true;
+    if (root != None && !G.has_node(root)) {
+        throw xn::NodeNotFound("root node not in graph");
+    auto r = root == None ? xn::BiconnectedDFS::none : G._node_map[root];
+    return !xn::biconnected_dfs(xn::to_csr(G), false, false, r).bridges.empty();
 
 
 /// @not_implemented_for("multigraph");
@@ -0,0 +1,238 @@
+#ifndef _HOME_UBUNTU_GITHUB_XNETWORK_ALGORITHMS_CENTRALITY_CLOSENESS_HPP
+#define _HOME_UBUNTU_GITHUB_XNETWORK_ALGORITHMS_CENTRALITY_CLOSENESS_HPP 1
+
+//    Copyright (C) 2004-2018 by
+//    Wai-Shing Luk <luk036@gmail.com>
+//
+//
+//    All rights reserved.
+//    BSD license.
+/**
+Native closeness centrality for unweighted graphs.
+*/
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <numeric>
+#include <queue>
+#include <utility>
+#include <vector>
+#include <xnetwork/algorithms/shortest_paths/unweighted.hpp> // import multi_source_bfs_sums, BFSWorkspace
+#include <xnetwork/classes/csr.hpp> // import CSRGraph, to_csr
+#include <xnetwork/exception.hpp> // import XNetworkNotImplemented
+#include <xnetwork/utils/parallel.hpp> // import parallel_for
+
+namespace xn {
+
+/** Closeness value of a node from its farness and reach counts. */
+inline auto _closeness_value(std::uint64_t farness, std::uint64_t reach,
+                             std::size_t n, bool wf_improved) -> double {
+    if (farness == 0 || n <= 1)
+        return 0.0;
+    auto c = double(reach - 1) / double(farness);
+    if (wf_improved)
+        c *= double(reach - 1) / double(n - 1);
+    return c;
+}
+
+/** Compute closeness centrality of every node of an unweighted graph.
+
+    Same definition as `closeness_centrality(G)` with `distance=None`,
+    but all sources are handled by `multi_source_bfs_sums`, 64 at a
+    time and in parallel.
+
+    Parameters
+    ----------
+    G : CSRGraph
+
+    wf_improved : bool, optional (default=true)
+        Scale by the fraction of nodes reachable (Wasserman and Faust).
+
+    reverse : bool, optional (default=false)
+        For digraphs, use distances from `u` instead of distances to `u`.
+
+    num_threads : unsigned, optional (default=0)
+
+    Returns
+    -------
+    closeness : vector<double>
+        Closeness of each node, indexed like `G`.
+*/
+template <typename W>
+auto closeness_centrality_bfs(const CSRGraph<W> &G, bool wf_improved = true,
+                              bool reverse = false, unsigned num_threads = 0)
+    -> std::vector<double> {
+    // closeness of u uses d(v, u), i.e. distances measured towards u
+    auto sums = multi_source_bfs_sums(G, !reverse, num_threads);
+    auto n = G.num_nodes();
+    auto c = std::vector<double>(n);
+    for (std::size_t u = 0; u < n; ++u)
+        c[u] = _closeness_value(sums.farness[u], sums.reach[u], n,
+                                wf_improved);
+    return c;
+}
+
+/** Return the `k` nodes with highest closeness in an undirected graph.
+
+    Implements the pruned BFS of Bergamini et al. [1]_.  Nodes are
+    visited by decreasing degree; the BFS of a node stops as soon as a
+    lower bound on its farness shows that it cannot beat the current
+    k-th best value.  After level `d` the bound assumes the remaining
+    reachable nodes sit at distance `d + 1` as far as the number of
+    arcs leaving level `d` allows and at `d + 2` otherwise.  Component
+    sizes are computed up front so the bound is exact on disconnected
+    graphs.  Nodes are processed in parallel; a stale threshold only
+    prunes less, never wrongly.
+
+    Parameters
+    ----------
+    G : CSRGraph
+        An undirected graph.
+
+    k : size_t
+        Number of nodes to return.
+
+    wf_improved : bool, optional (default=true)
+
+    num_threads : unsigned, optional (default=0)
+
+    Returns
+    -------
+    topk : vector<pair<uint32_t, double>>
+        `(node index, closeness)` pairs by decreasing closeness.
+
+    Raises
+    ------
+    XNetworkNotImplemented
+        If `G` is directed.
+
+    References
+    ----------
+    .. [1] E. Bergamini, M. Borassi, P. Crescenzi, A. Marino,
+       H. Meyerhenke. "Computing top-k Closeness Centrality Faster in
+       Unweighted Graphs." ACM TKDD 13(5), 2019.
+*/
+template <typename W>
+auto topk_closeness_centrality(const CSRGraph<W> &G, std::size_t k,
+                               bool wf_improved = true,
+                               unsigned num_threads = 0)
+    -> std::vector<std::pair<std::uint32_t, double>> {
+    using entry_t = std::pair<double, std::uint32_t>;
+
+    if (G.directed)
+        throw XNetworkNotImplemented("not implemented for directed type");
+    const auto n = G.num_nodes();
+    k = std::min(k, n);
+    if (k == 0)
+        return {};
+
+    // component sizes give the exact reach of every node
+    auto comp_size = std::vector<std::uint64_t>(n, 0);
+    {
+        auto ws = BFSWorkspace(n);
+        auto label = std::vector<std::uint32_t>(n, std::uint32_t(-1));
+        for (std::uint32_t s = 0; s < n; ++s) {
+            if (label[s] != std::uint32_t(-1))
+                continue;
+            ws.run(G, s);
+            for (std::size_t q = 0; q < ws.visited; ++q)
+                label[ws.queue[q]] = s;
+            comp_size[s] = ws.visited;
+        }
+        for (std::size_t v = 0; v < n; ++v)
+            comp_size[v] = comp_size[label[v]];
+    }
+
+    auto order = std::vector<std::uint32_t>(n);
+    std::iota(order.begin(), order.end(), 0U);
+    std::stable_sort(order.begin(), order.end(), [&](auto a, auto b) {
+        return G.degree(a) > G.degree(b);
+    });
+
+    // min-heap of the best k so far; kth holds its smallest value
+    auto best = std::priority_queue<entry_t, std::vector<entry_t>,
+                                    std::greater<entry_t>>{};
+    auto best_lock = std::mutex{};
+    auto kth = std::atomic<double>{-1.0};
+
+    const auto nt = resolve_num_threads(num_threads);
+    auto dist = std::vector<std::vector<std::int64_t>>(nt);
+    auto queue = std::vector<std::vector<std::uint32_t>>(nt);
+
+    parallel_for(
+        n,
+        [&](std::size_t i, unsigned tid) {
+            auto v = order[i];
+            auto r = comp_size[v];
+            auto &dv = dist[tid];
+            auto &q = queue[tid];
+            if (dv.empty())
+                dv.assign(n, -1);
+            q.clear();
+
+            auto upper = [&](std::uint64_t farness) {
+                return _closeness_value(farness, r, n, wf_improved);
+            };
+
+            q.push_back(v);
+            dv[v] = 0;
+            auto farness = std::uint64_t(0);
+            auto pruned = false;
+            std::size_t head = 0;
+            for (std::int64_t d = 0; head < q.size() && !pruned; ++d) {
+                // expand level d, counting the arcs that leave it
+                auto level_end = q.size();
+                auto leaving = std::uint64_t(0);
+                for (; head < level_end; ++head) {
+                    auto u = q[head];
+                    auto [b, e] = G.neighbors(u);
+                    leaving += (e - b) - (d > 0 ? 1 : 0);
+                    for (auto it = b; it != e; ++it) {
+                        if (dv[*it] < 0) {
+                            dv[*it] = d + 1;
+                            q.push_back(*it);
+                            farness += std::uint64_t(d + 1);
+                        }
+                    }
+                }
+                // q[0 .. level_end) is exact; bound the rest
+                auto lb = farness -
+                          std::uint64_t(d + 1) * (q.size() - level_end);
+                auto rem = r - std::uint64_t(level_end);
+                auto near = std::min(rem, leaving);
+                lb += std::uint64_t(d + 1) * near +
+                      std::uint64_t(d + 2) * (rem - near);
+                if (rem > 0 && upper(lb) <= kth.load())
+                    pruned = true;
+            }
+            for (auto u : q)
+                dv[u] = -1;
+            if (pruned)
+                return;
+
+            auto c = upper(farness);
+            auto guard = std::lock_guard{best_lock};
+            if (best.size() < k) {
+                best.emplace(c, v);
+            } else if (c > best.top().first) {
+                best.pop();
+                best.emplace(c, v);
+            }
+            if (best.size() == k)
+                kth.store(best.top().first);
+        },
+        nt, 16);
+
+    auto result = std::vector<std::pair<std::uint32_t, double>>{};
+    for (; !best.empty(); best.pop())
+        result.emplace_back(best.top().second, best.top().first);
+    std::reverse(result.begin(), result.end());
+    return result;
+}
+
+} // namespace xn
+
+#endif
@@ -11,6 +11,8 @@ import random
 
 #include <xnetwork.hpp> // as xn
 from xnetwork.algorithms.centrality.flow_matrix import *
+#include <xnetwork/algorithms/centrality/current_flow_betweenness.hpp> // import current_flow_betweenness_bf, ...
+#include <xnetwork/classes/csr.hpp> // import to_csr
 #include <xnetwork/utils.hpp> // import not_implemented_for, reverse_cuthill_mckee_ordering
 
 static const auto __all__ = ["current_flow_betweenness_centrality",
@@ -18,6 +20,14 @@ static const auto __all__ = ["current_flow_betweenness_centrality",
            "edge_current_flow_betweenness_centrality"];
 
 
+auto _preconditioner(solver) {
+    // map solver names onto the native Laplacian solver preconditioners
+    if (solver == "jacobi" || solver == "cg") {
+        return xn::Preconditioner::jacobi;
+    }
+    return xn::Preconditioner::ichol;
+
+
 /// @not_implemented_for("directed");
 auto approximate_current_flow_betweenness_centrality(G, normalized=true,
                                                     weight=None,
@@ -46,10 +56,10 @@ auto approximate_current_flow_betweenness_centrality(G, normalized=true,
       Default data type for internal matrices.
       Set to np.double32 for lower memory consumption.
 
-    solver : string (default="lu");
-       Type of linear solver to use for computing the flow matrix.
-       Options are "full" (uses most memory), "lu" (recommended), and
-       "cg" (uses least memory).
+    solver : string (default="full");
+       Preconditioner of the native conjugate gradient Laplacian solver.
+       "jacobi" || "cg" use diagonal scaling; "ichol", "full" && "lu"
+       use an incomplete Cholesky factor.
 
     epsilon: double
         Absolute error tolerance.
@@ -95,45 +105,11 @@ auto approximate_current_flow_betweenness_centrality(G, normalized=true,
                           "http://scipy.org/");
     if (!xn::is_connected(G) {
         throw xn::XNetworkError("Graph not connected.");
-    solvername = {"full": FullInverseLaplacian,
-                  "lu": SuperLUInverseLaplacian,
-                  "cg": CGInverseLaplacian}
-    n = G.number_of_nodes();
-    ordering = list(reverse_cuthill_mckee_ordering(G));
-    // make a copy with integer labels according to rcm ordering
-    // this could be done without a copy if (we really wanted to
-    H = xn::relabel_nodes(G, dict(zip(ordering, range(n))));
-    L = laplacian_sparse_matrix(H, nodelist=range(n), weight=weight,
-                                dtype=dtype, format="csc");
-    C = solvername[solver](L, dtype=dtype);  // initialize solver
-    betweenness = dict.fromkeys(H, 0.0);
-    nb = (n - 1.0) * (n - 2.0);  // normalization factor
-    cstar = n * (n - 1) / nb
-    l = 1  // parameter : approximation, adjustable
-    k = l * int(np.ceil((cstar / epsilon)**2 * np.log(n)));
-    if (k > kmax) {
-        throw xn::XNetworkError("Number random pairs k>kmax (%d>%d) " % (k, kmax),
-                               "Increase kmax || epsilon");
-    cstar2k = cstar / (2 * k);
-    for (auto i : range(k) {
-        s, t = random.sample(range(n), 2);
-        b = np.zeros(n, dtype=dtype);
-        b[s] = 1;
-        b[t] = -1
-        p = C.solve(b);
-        for (auto v : H) {
-            if (v == s || v == t) {
-                continue;
-            for (auto nbr : H[v]) {
-                w = H[v][nbr].get(weight, 1.0);
-                betweenness[v] += w * np.abs(p[v] - p[nbr]) * cstar2k
-    if (normalized) {
-        factor = 1.0
-    } else {
-        factor = nb / 2.0
-    // remap to original node names && "unnormalize" if (required
-    return dict((ordering[k], double(v * factor)) for k, v : betweenness.items());
-
+    // one native Laplacian solve per sampled pair, pairs spread over threads
+    b = xn::approximate_current_flow_betweenness_bf(
+        xn::to_csr(G, weight), normalized, epsilon, kmax,
+        random.getrandbits(64), _preconditioner(solver));
+    return {v: b[G._node_map[v]] for v : G};
 
 /// @not_implemented_for("directed");
 auto current_flow_betweenness_centrality(G, normalized=true, weight=None,
@@ -164,10 +140,10 @@ auto current_flow_betweenness_centrality(G, normalized=true, weight=None,
       Default data type for internal matrices.
       Set to np.double32 for lower memory consumption.
 
-    solver : string (default="lu");
-       Type of linear solver to use for computing the flow matrix.
-       Options are "full" (uses most memory), "lu" (recommended), and
-       "cg" (uses least memory).
+    solver : string (default="full");
+       Preconditioner of the native conjugate gradient Laplacian solver.
+       "jacobi" || "cg" use diagonal scaling; "ichol", "full" && "lu"
+       use an incomplete Cholesky factor.
 
     Returns
     -------
@@ -218,26 +194,10 @@ auto current_flow_betweenness_centrality(G, normalized=true, weight=None,
                           "http://scipy.org/");
     if (!xn::is_connected(G) {
         throw xn::XNetworkError("Graph not connected.");
-    n = G.number_of_nodes();
-    ordering = list(reverse_cuthill_mckee_ordering(G));
-    // make a copy with integer labels according to rcm ordering
-    // this could be done without a copy if (we really wanted to
-    H = xn::relabel_nodes(G, dict(zip(ordering, range(n))));
-    betweenness = dict.fromkeys(H, 0.0);  // b[v]=0 for v : H
-    for (auto row, (s, t] : flow_matrix_row(H, weight=weight, dtype=dtype,
-                                       solver=solver) {
-        pos = dict(zip(row.argsort()[::-1], range(n)));
-        for (auto i : range(n) {
-            betweenness[s] += (i - pos[i]) * row[i];
-            betweenness[t] += (n - i - 1 - pos[i]) * row[i];
-    if (normalized) {
-        nb = (n - 1.0) * (n - 2.0);  // normalization factor
-    } else {
-        nb = 2.0
-    for (auto v : H) {
-        betweenness[v] = double((betweenness[v] - v) * 2.0 / nb);
-    return dict((ordering[k], v) for k, v : betweenness.items());
-
+    // one native Laplacian solve per edge gives its flow-matrix row
+    b = xn::current_flow_betweenness_bf(xn::to_csr(G, weight),
+                                        normalized, _preconditioner(solver));
+    return {v: b[G._node_map[v]] for v : G};
 
 /// @not_implemented_for("directed");
 auto edge_current_flow_betweenness_centrality(G, normalized=true,
@@ -269,10 +229,10 @@ auto edge_current_flow_betweenness_centrality(G, normalized=true,
       Default data type for internal matrices.
       Set to np.double32 for lower memory consumption.
 
-    solver : string (default="lu");
-       Type of linear solver to use for computing the flow matrix.
-       Options are "full" (uses most memory), "lu" (recommended), and
-       "cg" (uses least memory).
+    solver : string (default="full");
+       Preconditioner of the native conjugate gradient Laplacian solver.
+       "jacobi" || "cg" use diagonal scaling; "ichol", "full" && "lu"
+       use an incomplete Cholesky factor.
 
     Returns
     -------
@@ -330,27 +290,11 @@ auto edge_current_flow_betweenness_centrality(G, normalized=true,
                           "http://scipy.org/");
     if (!xn::is_connected(G) {
         throw xn::XNetworkError("Graph not connected.");
-    n = G.number_of_nodes();
-    ordering = list(reverse_cuthill_mckee_ordering(G));
-    // make a copy with integer labels according to rcm ordering
-    // this could be done without a copy if (we really wanted to
-    H = xn::relabel_nodes(G, dict(zip(ordering, range(n))));
-    edges = (tuple(sorted((u, v))) for u, v : H.edges());
-    betweenness = dict.fromkeys(edges, 0.0);
-    if (normalized) {
-        nb = (n - 1.0) * (n - 2.0);  // normalization factor
-    } else {
-        nb = 2.0
-    for (auto row, (e] : flow_matrix_row(H, weight=weight, dtype=dtype,
-                                    solver=solver) {
-        pos = dict(zip(row.argsort()[::-1], range(1, n + 1)));
-        for (auto i : range(n) {
-            betweenness[e] += (i + 1 - pos[i]) * row[i];
-            betweenness[e] += (n - i - pos[i]) * row[i];
-        betweenness[e] /= nb
-    return dict(((ordering[s], ordering[t]), double(v));
-                for (auto [s, t), v : betweenness.items());
-
+    nodes = list(G);
+    b = xn::edge_current_flow_betweenness_bf(xn::to_csr(G, weight),
+                                             normalized,
+                                             _preconditioner(solver));
+    return {(nodes[s], nodes[t]): v for s, t, v : b};
 
 // fixture for nose tests
 auto setup_module(module) {
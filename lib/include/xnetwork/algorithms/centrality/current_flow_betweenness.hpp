@@ -0,0 +1,235 @@
+#ifndef _HOME_UBUNTU_GITHUB_XNETWORK_ALGORITHMS_CENTRALITY_CURRENT_FLOW_BETWEENNESS_HPP
+#define _HOME_UBUNTU_GITHUB_XNETWORK_ALGORITHMS_CENTRALITY_CURRENT_FLOW_BETWEENNESS_HPP 1
+
+//    Copyright (C) 2010-2018 by
+//    Wai-Shing Luk <luk036@gmail.com>
+//
+//
+//    All rights reserved.
+//    BSD license.
+/** Native current-flow betweenness centrality measures. */
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <numeric>
+#include <random>
+#include <tuple>
+#include <utility>
+#include <vector>
+#include <xnetwork/algorithms/centrality/flow_matrix.hpp> // import LaplacianSolver, Preconditioner
+#include <xnetwork/classes/csr.hpp> // import CSRGraph
+#include <xnetwork/exception.hpp> // import XNetworkError
+
+namespace xn {
+
+/** The undirected edges `(u, v, arc position)` of `G` with `u < v`. */
+template <typename W>
+auto _sorted_edges(const CSRGraph<W> &G)
+    -> std::vector<std::tuple<std::uint32_t, std::uint32_t, std::size_t>> {
+    auto edges =
+        std::vector<std::tuple<std::uint32_t, std::uint32_t, std::size_t>>{};
+    for (std::uint32_t u = 0; u < G.num_nodes(); ++u)
+        for (auto k = G.indptr[u]; k < G.indptr[u + 1]; ++k)
+            if (u < G.indices[k])
+                edges.emplace_back(u, G.indices[k], k);
+    return edges;
+}
+
+/** Sums of `(i - pos[i]) row[i]` and `(n - 1 - i - pos[i]) row[i]`,
+    where `pos[i]` is the rank of `row[i]` by decreasing value. */
+inline auto _flow_row_sums(const double *row, std::size_t n,
+                           std::vector<std::uint32_t> &order)
+    -> std::pair<double, double> {
+    order.resize(n);
+    std::iota(order.begin(), order.end(), 0U);
+    std::sort(order.begin(), order.end(),
+              [&](auto a, auto b) { return row[a] > row[b]; });
+    auto s = 0.0, t = 0.0;
+    for (std::size_t pos = 0; pos < n; ++pos) {
+        auto i = order[pos];
+        s += (double(i) - double(pos)) * row[i];
+        t += (double(n) - double(i) - 1.0 - double(pos)) * row[i];
+    }
+    return {s, t};
+}
+
+/** Current-flow betweenness of every node of a connected graph.
+
+    Native counterpart of `current_flow_betweenness_centrality`: the
+    flow-matrix row of each edge `(s, t)` is one Laplacian solve with
+    right-hand side `c (e_s - e_t)`, and solves for different edges run
+    on separate threads with per-thread accumulators.  Memory is O(n)
+    per thread instead of the O(nw) band of the inverse Laplacian.
+
+    Parameters
+    ----------
+    G : CSRGraph
+        A connected undirected graph; weights are conductances.
+
+    normalized : bool, optional (default=true)
+
+    preconditioner : Preconditioner, optional (default=ichol)
+
+    num_threads : unsigned, optional (default=0)
+
+    Returns
+    -------
+    betweenness : vector<double>
+        Indexed like `G`.
+*/
+template <typename W>
+auto current_flow_betweenness_bf(const CSRGraph<W> &G, bool normalized = true,
+                                 Preconditioner preconditioner =
+                                     Preconditioner::ichol,
+                                 unsigned num_threads = 0)
+    -> std::vector<double> {
+    const auto n = G.num_nodes();
+    auto C = LaplacianSolver(G, preconditioner);
+    auto edges = _sorted_edges(G);
+    const auto nt = resolve_num_threads(num_threads);
+    auto acc = std::vector<std::vector<double>>(nt,
+                                                std::vector<double>(n, 0.0));
+    auto order = std::vector<std::vector<std::uint32_t>>(nt);
+
+    C.solve_many(
+        edges.size(),
+        [&](std::size_t e, double *rhs) {
+            auto [s, t, k] = edges[e];
+            auto c = double(G.weight(k));
+            rhs[s] = c;
+            rhs[t] = -c;
+        },
+        [&](std::size_t e, const double *row, unsigned tid) {
+            auto [s, t, k] = edges[e];
+            auto [bs, bt] = _flow_row_sums(row, n, order[tid]);
+            acc[tid][s] += bs;
+            acc[tid][t] += bt;
+        },
+        nt);
+
+    auto nb = normalized ? (n - 1.0) * (n - 2.0) : 2.0;
+    auto betweenness = std::vector<double>(n, 0.0);
+    for (std::size_t v = 0; v < n; ++v) {
+        for (const auto &a : acc)
+            betweenness[v] += a[v];
+        betweenness[v] = (betweenness[v] - double(v)) * 2.0 / nb;
+    }
+    return betweenness;
+}
+
+/** Current-flow betweenness of every edge of a connected graph.
+
+    Native counterpart of `edge_current_flow_betweenness_centrality`.
+
+    Returns
+    -------
+    betweenness : vector<tuple<uint32_t, uint32_t, double>>
+        `(u, v, value)` with `u < v` for every edge.
+*/
+template <typename W>
+auto edge_current_flow_betweenness_bf(const CSRGraph<W> &G,
+                                      bool normalized = true,
+                                      Preconditioner preconditioner =
+                                          Preconditioner::ichol,
+                                      unsigned num_threads = 0)
+    -> std::vector<std::tuple<std::uint32_t, std::uint32_t, double>> {
+    const auto n = G.num_nodes();
+    auto C = LaplacianSolver(G, preconditioner);
+    auto edges = _sorted_edges(G);
+    const auto nt = resolve_num_threads(num_threads);
+    auto order = std::vector<std::vector<std::uint32_t>>(nt);
+    auto nb = normalized ? (n - 1.0) * (n - 2.0) : 2.0;
+    auto result = std::vector<std::tuple<std::uint32_t, std::uint32_t, double>>(
+        edges.size());
+
+    C.solve_many(
+        edges.size(),
+        [&](std::size_t e, double *rhs) {
+            auto [s, t, k] = edges[e];
+            auto c = double(G.weight(k));
+            rhs[s] = c;
+            rhs[t] = -c;
+        },
+        [&](std::size_t e, const double *row, unsigned tid) {
+            auto [s, t, k] = edges[e];
+            auto [bs, bt] = _flow_row_sums(row, n, order[tid]);
+            result[e] = {s, t, (bs + bt) / nb};
+        },
+        nt);
+    return result;
+}
+
+/** Approximate current-flow betweenness by sampling source-target pairs.
+
+    Native counterpart of `approximate_current_flow_betweenness_centrality`.
+    The `k` pairs are drawn up front from `seed`, so the result does not
+    depend on the number of threads.
+
+    Raises
+    ------
+    XNetworkError
+        If the number of pairs exceeds `kmax`.
+*/
+template <typename W>
+auto approximate_current_flow_betweenness_bf(
+    const CSRGraph<W> &G, bool normalized = true, double epsilon = 0.5,
+    std::size_t kmax = 10000, std::uint64_t seed = 0,
+    Preconditioner preconditioner = Preconditioner::ichol,
+    unsigned num_threads = 0) -> std::vector<double> {
+    const auto n = G.num_nodes();
+    auto C = LaplacianSolver(G, preconditioner);
+    auto nb = (n - 1.0) * (n - 2.0);
+    auto cstar = n * (n - 1.0) / nb;
+    auto k = std::size_t(std::ceil(std::pow(cstar / epsilon, 2) *
+                                   std::log(double(n))));
+    if (k > kmax)
+        throw XNetworkError("Number random pairs k>kmax. "
+                            "Increase kmax || epsilon");
+    auto cstar2k = cstar / (2.0 * k);
+
+    auto gen = std::mt19937_64{seed};
+    auto pick = std::uniform_int_distribution<std::uint32_t>(
+        0, std::uint32_t(n - 1));
+    auto pairs = std::vector<std::pair<std::uint32_t, std::uint32_t>>(k);
+    for (auto &[s, t] : pairs) {
+        s = pick(gen);
+        do {
+            t = pick(gen);
+        } while (t == s);
+    }
+
+    const auto nt = resolve_num_threads(num_threads);
+    auto acc = std::vector<std::vector<double>>(nt,
+                                                std::vector<double>(n, 0.0));
+    C.solve_many(
+        k,
+        [&](std::size_t i, double *rhs) {
+            rhs[pairs[i].first] = 1.0;
+            rhs[pairs[i].second] = -1.0;
+        },
+        [&](std::size_t i, const double *p, unsigned tid) {
+            auto [s, t] = pairs[i];
+            for (std::uint32_t v = 0; v < n; ++v) {
+                if (v == s || v == t)
+                    continue;
+                for (auto a = G.indptr[v]; a < G.indptr[v + 1]; ++a)
+                    acc[tid][v] += double(G.weight(a)) *
+                                   std::abs(p[v] - p[G.indices[a]]) * cstar2k;
+            }
+        },
+        nt);
+
+    auto factor = normalized ? 1.0 : nb / 2.0;
+    auto betweenness = std::vector<double>(n, 0.0);
+    for (std::size_t v = 0; v < n; ++v) {
+        for (const auto &a : acc)
+            betweenness[v] += a[v];
+        betweenness[v] *= factor;
+    }
+    return betweenness;
+}
+
+} // namespace xn
+
+#endif
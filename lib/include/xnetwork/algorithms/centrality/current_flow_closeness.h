@@ -9,8 +9,11 @@
 /** Current-flow closeness centrality measures. */
 #include <xnetwork.hpp> // as xn
 
-#include <xnetwork/utils.hpp> // import not_implemented_for, reverse_cuthill_mckee_ordering
+#include <xnetwork/utils.hpp> // import not_implemented_for
 from xnetwork.algorithms.centrality.flow_matrix import *
+#include <xnetwork/algorithms/centrality/current_flow_betweenness.h> // import _preconditioner
+#include <xnetwork/algorithms/centrality/current_flow_closeness.hpp> // import current_flow_closeness_bf
+#include <xnetwork/classes/csr.hpp> // import to_csr
 
 static const auto __all__ = ["current_flow_closeness_centrality", "information_centrality"];
 
@@ -38,9 +41,9 @@ auto current_flow_closeness_centrality(G, weight=None,
       Set to np.double32 for lower memory consumption.
 
     solver: string (default="lu");
-       Type of linear solver to use for computing the flow matrix.
-       Options are "full" (uses most memory), "lu" (recommended), and
-       "cg" (uses least memory).
+       Preconditioner of the native conjugate gradient Laplacian solver.
+       "jacobi" || "cg" use diagonal scaling; "ichol", "full" && "lu"
+       use an incomplete Cholesky factor.
 
     Returns
     -------
@@ -74,27 +77,10 @@ auto current_flow_closeness_centrality(G, weight=None,
     import scipy
     if (!xn::is_connected(G) {
         throw xn::XNetworkError("Graph not connected.");
-    solvername = {"full": FullInverseLaplacian,
-                  "lu": SuperLUInverseLaplacian,
-                  "cg": CGInverseLaplacian}
-    n = G.number_of_nodes();
-    ordering = list(reverse_cuthill_mckee_ordering(G));
-    // make a copy with integer labels according to rcm ordering
-    // this could be done without a copy if (we really wanted to
-    H = xn::relabel_nodes(G, dict(zip(ordering, range(n))));
-    betweenness = dict.fromkeys(H, 0.0);  // b[v]=0 for v : H
-    n = H.number_of_nodes();
-    L = laplacian_sparse_matrix(H, nodelist=range(n), weight=weight,
-                                dtype=dtype, format="csc");
-    C2 = solvername[solver](L, width=1, dtype=dtype);  // initialize solver
-    for (auto v : H) {
-        col = C2.get_row(v);
-        for (auto w : H) {
-            betweenness[v] += col[v] - 2 * col[w];
-            betweenness[w] += col[v];
-    for (auto v : H) {
-        betweenness[v] = 1.0 / (betweenness[v]);
-    return dict((ordering[k], double(v)) for k, v : betweenness.items());
+    // diagonal && row sums of the inverse Laplacian, one solve per node
+    c = xn::current_flow_closeness_bf(xn::to_csr(G, weight),
+                                      _preconditioner(solver));
+    return {v: c[G._node_map[v]] for v : G};
 
 
 information_centrality = current_flow_closeness_centrality
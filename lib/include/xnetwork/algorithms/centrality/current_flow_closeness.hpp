@@ -0,0 +1,75 @@
+#ifndef _HOME_UBUNTU_GITHUB_XNETWORK_ALGORITHMS_CENTRALITY_CURRENT_FLOW_CLOSENESS_HPP
+#define _HOME_UBUNTU_GITHUB_XNETWORK_ALGORITHMS_CENTRALITY_CURRENT_FLOW_CLOSENESS_HPP 1
+
+//    Copyright (C) 2010-2018 by
+//    Wai-Shing Luk <luk036@gmail.com>
+//
+//
+//    All rights reserved.
+//    BSD license.
+/** Native current-flow closeness centrality. */
+
+#include <vector>
+#include <xnetwork/algorithms/centrality/flow_matrix.hpp> // import LaplacianSolver, Preconditioner
+#include <xnetwork/classes/csr.hpp> // import CSRGraph
+
+namespace xn {
+
+/** Current-flow closeness (information) centrality of every node.
+
+    Native counterpart of `current_flow_closeness_centrality`.  With `C`
+    the grounded inverse Laplacian, the value of `v` is the reciprocal
+    of `n C[v][v] - 2 sum_w C[v][w] + trace(C)`, so only the diagonal
+    and the row sums of `C` are needed: one solve per node, run in
+    parallel, with O(n) memory per thread.
+
+    Parameters
+    ----------
+    G : CSRGraph
+        A connected undirected graph; weights are conductances.
+
+    preconditioner : Preconditioner, optional (default=ichol)
+
+    num_threads : unsigned, optional (default=0)
+
+    Returns
+    -------
+    closeness : vector<double>
+        Indexed like `G`.
+*/
+template <typename W>
+auto current_flow_closeness_bf(const CSRGraph<W> &G,
+                               Preconditioner preconditioner =
+                                   Preconditioner::ichol,
+                               unsigned num_threads = 0)
+    -> std::vector<double> {
+    const auto n = G.num_nodes();
+    auto C = LaplacianSolver(G, preconditioner);
+    auto diag = std::vector<double>(n, 0.0);
+    auto rowsum = std::vector<double>(n, 0.0);
+
+    // row 0 of the grounded inverse is zero
+    C.solve_many(
+        n == 0 ? 0 : n - 1,
+        [&](std::size_t k, double *rhs) { rhs[k + 1] = 1.0; },
+        [&](std::size_t k, const double *col, unsigned) {
+            auto s = 0.0;
+            for (std::size_t w = 0; w < n; ++w)
+                s += col[w];
+            diag[k + 1] = col[k + 1];
+            rowsum[k + 1] = s;
+        },
+        num_threads);
+
+    auto trace = 0.0;
+    for (auto d : diag)
+        trace += d;
+    auto closeness = std::vector<double>(n);
+    for (std::size_t v = 0; v < n; ++v)
+        closeness[v] = 1.0 / (double(n) * diag[v] - 2.0 * rowsum[v] + trace);
+    return closeness;
+}
+
+} // namespace xn
+
+#endif
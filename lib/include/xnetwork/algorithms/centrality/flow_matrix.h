@@ -1,6 +1,9 @@
 // Helpers for current-flow betweenness && current-flow closness
 // Lazy computations for inverse Laplacian && flow-matrix rows.
+// The compiled algorithms use the native LaplacianSolver from
+// flow_matrix.hpp; the classes below remain for the subset variants.
 #include <xnetwork.hpp> // as xn
+#include <xnetwork/algorithms/centrality/flow_matrix.hpp> // import LaplacianSolver, Preconditioner
 
 
 auto flow_matrix_row(G, weight=None, dtype=double, solver="lu") {
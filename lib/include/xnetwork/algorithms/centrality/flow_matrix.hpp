@@ -0,0 +1,285 @@
+#ifndef _HOME_UBUNTU_GITHUB_XNETWORK_ALGORITHMS_CENTRALITY_FLOW_MATRIX_HPP
+#define _HOME_UBUNTU_GITHUB_XNETWORK_ALGORITHMS_CENTRALITY_FLOW_MATRIX_HPP 1
+
+//    Copyright (C) 2010-2018 by
+//    Wai-Shing Luk <luk036@gmail.com>
+//
+//
+//    All rights reserved.
+//    BSD license.
+/**
+Native sparse Laplacian solver for current-flow betweenness && closeness.
+*/
+
+#include <cmath>
+#include <cstdint>
+#include <vector>
+#include <xnetwork/classes/csr.hpp> // import CSRGraph
+#include <xnetwork/exception.hpp> // import ExceededMaxIterations, XNetworkError
+#include <xnetwork/utils/parallel.hpp> // import parallel_for
+
+namespace xn {
+
+/** Preconditioner used by `LaplacianSolver`. */
+enum class Preconditioner {
+    jacobi, // diagonal scaling
+    ichol   // zero fill-in incomplete Cholesky, IC(0)
+};
+
+/** Preconditioned conjugate gradient solver for a grounded Laplacian.
+
+    Replaces the `InverseLaplacian` family of `flow_matrix.h`.  The
+    Laplacian `L = D - A` of a connected undirected graph is singular,
+    so node 0 is grounded: its row and column are dropped, the reduced
+    matrix `L1 = L[1:, 1:]` is symmetric positive definite, and every
+    solution has `x[0] = 0`.  This is the same convention as
+    `InverseLaplacian`, whose rows and columns 0 are zero.
+
+    `L1` is stored in CSR form.  The IC(0) factor keeps the sparsity of
+    the lower triangle of `L1`; a grounded Laplacian is an M-matrix, so
+    the factorization cannot break down.  Self loops do not contribute
+    to a Laplacian and are ignored.
+
+    The solver is immutable after construction; concurrent solves only
+    need one `Workspace` per thread (see `solve_many`).
+
+    Parameters
+    ----------
+    G : CSRGraph
+        A connected undirected graph.  Arc weights, if any, are used as
+        conductances.
+
+    preconditioner : Preconditioner, optional (default=ichol)
+
+    tol : double, optional (default=1e-10)
+        Relative residual at which CG stops.
+
+    maxiter : size_t, optional (default=0)
+        Iteration limit per solve; 0 means `10 * n`.
+*/
+class LaplacianSolver {
+  public:
+    /** Per-thread scratch vectors of length n - 1. */
+    struct Workspace {
+        std::vector<double> r, z, p, q, x;
+    };
+
+    template <typename W>
+    explicit LaplacianSolver(const CSRGraph<W> &G,
+                             Preconditioner preconditioner =
+                                 Preconditioner::ichol,
+                             double tol = 1e-10, std::size_t maxiter = 0)
+        : _n{G.num_nodes()}, _pc{preconditioner}, _tol{tol},
+          _maxiter{maxiter == 0 ? 10 * G.num_nodes() + 10 : maxiter} {
+        if (G.directed)
+            throw XNetworkError("LaplacianSolver requires an undirected graph");
+        const auto m = this->_n == 0 ? 0 : this->_n - 1;
+        this->_indptr.assign(m + 1, 0);
+        this->_diag.assign(m, 0.0);
+        for (std::size_t u = 1; u < this->_n; ++u) {
+            for (auto k = G.indptr[u]; k < G.indptr[u + 1]; ++k) {
+                auto v = G.indices[k];
+                if (v == u)
+                    continue;
+                auto w = double(G.weight(k));
+                this->_diag[u - 1] += w;
+                if (v != 0) {
+                    this->_indices.push_back(v - 1);
+                    this->_data.push_back(-w);
+                }
+            }
+            this->_indptr[u] = this->_indices.size();
+        }
+        if (this->_pc == Preconditioner::ichol)
+            this->_factor();
+    }
+
+    /** Number of nodes of the full (ungrounded) Laplacian. */
+    auto size() const { return this->_n; }
+
+    /** Solve `L x = rhs` with `x[0] = 0`; both arrays have length n.
+
+        Returns the number of CG iterations used.
+
+        Raises
+        ------
+        ExceededMaxIterations
+            If CG does not reach `tol` within `maxiter` iterations.
+    */
+    auto solve(const double *rhs, double *x, Workspace &ws) const
+        -> std::size_t {
+        if (this->_n == 0)
+            return 0;
+        x[0] = 0.0;
+        const auto m = this->_n - 1;
+        if (m == 0)
+            return 0;
+        ws.r.assign(rhs + 1, rhs + this->_n);
+        ws.x.assign(m, 0.0);
+        ws.z.resize(m);
+        ws.q.resize(m);
+
+        auto bnorm = std::sqrt(_dot(ws.r, ws.r));
+        if (bnorm == 0.0) {
+            std::fill(x + 1, x + this->_n, 0.0);
+            return 0;
+        }
+        this->_precondition(ws.r, ws.z);
+        ws.p = ws.z;
+        auto rz = _dot(ws.r, ws.z);
+        std::size_t it = 0;
+        for (; it < this->_maxiter; ++it) {
+            if (std::sqrt(_dot(ws.r, ws.r)) <= this->_tol * bnorm)
+                break;
+            this->_matvec(ws.p, ws.q);
+            auto alpha = rz / _dot(ws.p, ws.q);
+            for (std::size_t i = 0; i < m; ++i) {
+                ws.x[i] += alpha * ws.p[i];
+                ws.r[i] -= alpha * ws.q[i];
+            }
+            this->_precondition(ws.r, ws.z);
+            auto rz_new = _dot(ws.r, ws.z);
+            auto beta = rz_new / rz;
+            rz = rz_new;
+            for (std::size_t i = 0; i < m; ++i)
+                ws.p[i] = ws.z[i] + beta * ws.p[i];
+        }
+        if (it == this->_maxiter &&
+            std::sqrt(_dot(ws.r, ws.r)) > this->_tol * bnorm)
+            throw ExceededMaxIterations(
+                "conjugate gradient did not converge");
+        std::copy(ws.x.begin(), ws.x.end(), x + 1);
+        return it;
+    }
+
+    /** Row `r` of the grounded inverse Laplacian (zero for r == 0). */
+    void inverse_row(std::size_t r, double *x, Workspace &ws) const {
+        auto rhs = std::vector<double>(this->_n, 0.0);
+        if (r != 0)
+            rhs[r] = 1.0;
+        this->solve(rhs.data(), x, ws);
+    }
+
+    /** Run `count` independent solves spread over threads.
+
+        For each `k`, `fill(k, rhs)` writes a right-hand side of length
+        n into a zeroed buffer, then `consume(k, x, tid)` receives the
+        solution.  Buffers and workspaces are per thread, so `consume`
+        only needs to synchronize on shared output.
+    */
+    template <typename Fill, typename Consume>
+    void solve_many(std::size_t count, Fill &&fill, Consume &&consume,
+                    unsigned num_threads = 0) const {
+        const auto nt = resolve_num_threads(num_threads);
+        auto ws = std::vector<Workspace>(nt);
+        auto rhs = std::vector<std::vector<double>>(nt);
+        auto x = std::vector<std::vector<double>>(nt);
+        parallel_for(
+            count,
+            [&](std::size_t k, unsigned tid) {
+                rhs[tid].assign(this->_n, 0.0);
+                x[tid].resize(this->_n);
+                fill(k, rhs[tid].data());
+                this->solve(rhs[tid].data(), x[tid].data(), ws[tid]);
+                consume(k, static_cast<const double *>(x[tid].data()), tid);
+            },
+            nt, 1);
+    }
+
+  private:
+    std::size_t _n;
+    Preconditioner _pc;
+    double _tol;
+    std::size_t _maxiter;
+    // L1 without its diagonal, in CSR form
+    std::vector<std::size_t> _indptr;
+    std::vector<std::uint32_t> _indices;
+    std::vector<double> _data;
+    std::vector<double> _diag;
+    // IC(0) factor: strictly lower part in CSR form plus its diagonal
+    std::vector<std::size_t> _lptr;
+    std::vector<std::uint32_t> _lidx;
+    std::vector<double> _lval;
+    std::vector<double> _ldiag;
+
+    static auto _dot(const std::vector<double> &a,
+                     const std::vector<double> &b) -> double {
+        auto s = 0.0;
+        for (std::size_t i = 0; i < a.size(); ++i)
+            s += a[i] * b[i];
+        return s;
+    }
+
+    void _matvec(const std::vector<double> &p, std::vector<double> &q) const {
+        for (std::size_t i = 0; i < this->_diag.size(); ++i) {
+            auto s = this->_diag[i] * p[i];
+            for (auto k = this->_indptr[i]; k < this->_indptr[i + 1]; ++k)
+                s += this->_data[k] * p[this->_indices[k]];
+            q[i] = s;
+        }
+    }
+
+    void _factor() {
+        const auto m = this->_diag.size();
+        this->_lptr.assign(m + 1, 0);
+        for (std::size_t i = 0; i < m; ++i) {
+            for (auto k = this->_indptr[i]; k < this->_indptr[i + 1]; ++k) {
+                if (this->_indices[k] < i) {
+                    this->_lidx.push_back(this->_indices[k]);
+                    this->_lval.push_back(this->_data[k]);
+                }
+            }
+            this->_lptr[i + 1] = this->_lidx.size();
+        }
+        this->_ldiag.assign(m, 0.0);
+        for (std::size_t i = 0; i < m; ++i) {
+            auto bi = this->_lptr[i], ei = this->_lptr[i + 1];
+            for (auto k = bi; k < ei; ++k) {
+                // L[i][j] -= sum_{c < j} L[i][c] L[j][c] over the shared pattern
+                auto j = this->_lidx[k];
+                auto s = this->_lval[k];
+                auto a = bi, b = this->_lptr[j];
+                while (a < k && b < this->_lptr[j + 1]) {
+                    if (this->_lidx[a] < this->_lidx[b]) {
+                        ++a;
+                    } else if (this->_lidx[b] < this->_lidx[a]) {
+                        ++b;
+                    } else {
+                        s -= this->_lval[a++] * this->_lval[b++];
+                    }
+                }
+                this->_lval[k] = s / this->_ldiag[j];
+            }
+            auto d = this->_diag[i];
+            for (auto k = bi; k < ei; ++k)
+                d -= this->_lval[k] * this->_lval[k];
+            this->_ldiag[i] = std::sqrt(d);
+        }
+    }
+
+    void _precondition(const std::vector<double> &r,
+                       std::vector<double> &z) const {
+        const auto m = this->_diag.size();
+        if (this->_pc == Preconditioner::jacobi) {
+            for (std::size_t i = 0; i < m; ++i)
+                z[i] = r[i] / this->_diag[i];
+            return;
+        }
+        // forward solve L y = r, then backward solve L^T z = y
+        for (std::size_t i = 0; i < m; ++i) {
+            auto s = r[i];
+            for (auto k = this->_lptr[i]; k < this->_lptr[i + 1]; ++k)
+                s -= this->_lval[k] * z[this->_lidx[k]];
+            z[i] = s / this->_ldiag[i];
+        }
+        for (auto i = m; i-- > 0;) {
+            z[i] /= this->_ldiag[i];
+            for (auto k = this->_lptr[i]; k < this->_lptr[i + 1]; ++k)
+                z[this->_lidx[k]] -= this->_lval[k] * z[i];
+        }
+    }
+};
+
+} // namespace xn
+
+#endif
@@ -10,6 +10,8 @@
 from functools import partial
 
 #include <xnetwork.hpp> // as xn
+#include <xnetwork/algorithms/centrality/harmonic.hpp> // import harmonic_centrality_bfs
+#include <xnetwork/classes/csr.hpp> // import to_csr
 
 static const auto __all__ = ["harmonic_centrality"];
 
@@ -57,11 +59,18 @@ auto harmonic_centrality(G, nbunch=None, distance=None) {
     shortest-path length will be computed using Dijkstra"s algorithm with
     that edge attribute as the edge weight.
 
+    Without "distance" && `nbunch`, all nodes are computed at once by the
+    native bit-parallel BFS in `harmonic.hpp`.
+
     References
     ----------
     .. [1] Boldi, Paolo, && Sebastiano Vigna. "Axioms for centrality."
            Internet Mathematics 10.3-4 (2014) { 222-262.
     */
+    if (distance.empty() && nbunch.empty()) {
+        auto h = xn::harmonic_centrality_bfs(xn::to_csr(G));
+        return {u: h[G._node_map[u]] for u : G};
+    }
     if (G.is_directed() {
         G = G.reverse();
     spl = partial(xn::shortest_path_length, G, weight=distance);
@@ -0,0 +1,41 @@
+#ifndef _HOME_UBUNTU_GITHUB_XNETWORK_ALGORITHMS_CENTRALITY_HARMONIC_HPP
+#define _HOME_UBUNTU_GITHUB_XNETWORK_ALGORITHMS_CENTRALITY_HARMONIC_HPP 1
+
+//    Copyright (C) 2015 by
+//    Alessandro Luongo
+//    BSD license.
+/** Native harmonic centrality for unweighted graphs. */
+
+#include <vector>
+#include <xnetwork/algorithms/shortest_paths/unweighted.hpp> // import multi_source_bfs_sums
+#include <xnetwork/classes/csr.hpp> // import CSRGraph
+
+namespace xn {
+
+/** Compute harmonic centrality of every node of an unweighted graph.
+
+    Same definition as `harmonic_centrality(G)` with `distance=None`:
+    the sum over `v != u` of `1 / d(v, u)`.  All sources are handled by
+    the bit-parallel `multi_source_bfs_sums`.
+
+    Parameters
+    ----------
+    G : CSRGraph
+
+    num_threads : unsigned, optional (default=0)
+
+    Returns
+    -------
+    harmonic : vector<double>
+        Harmonic centrality of each node, indexed like `G`.
+*/
+template <typename W>
+auto harmonic_centrality_bfs(const CSRGraph<W> &G, unsigned num_threads = 0)
+    -> std::vector<double> {
+    // distances are measured towards u, as for G.reverse() in harmonic.h
+    return multi_source_bfs_sums(G, true, num_threads).harmonic;
+}
+
+} // namespace xn
+
+#endif
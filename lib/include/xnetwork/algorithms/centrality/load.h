@@ -12,8 +12,11 @@
 /** Load centrality. */
 // from __future__ import division
 from operator import itemgetter
+#include <limits>
 
 #include <xnetwork.hpp> // as xn
+#include <xnetwork/algorithms/centrality/load.hpp> // import load_native
+#include <xnetwork/classes/csr.hpp> // import to_csr
 
 static const auto __all__ = ["load_centrality", "edge_load_centrality"];
 
@@ -67,85 +70,15 @@ auto newman_betweenness_centrality(G, v=None, cutoff=None,
        Physical Review Letters 87(27) {1–4, 2001.
        http://phya.snu.ac.kr/~dkim/PRL87278701.pdf
     */
+    // node load of every source in one native pass
+    auto limit = cutoff.empty() ? std::numeric_limits<double>::infinity()
+                                : double(cutoff);
+    auto C = weight.empty() ? xn::to_csr(G) : xn::to_csr(G, weight);
+    auto load = xn::load_native(C, !weight.empty(), limit, normalized);
     if (v is not None) {   // only one node
-        betweenness = 0.0
-        for (auto source : G) {
-            ubetween = _node_betweenness(G, source, cutoff, false, weight);
-            betweenness += ubetween[v] if (v : ubetween else 0
-        if (normalized) {
-            order = G.order();
-            if (order <= 2) {
-                return betweenness  // no normalization b=0 for all nodes
-            betweenness *= 1.0 / ((order - 1) * (order - 2));
-        return betweenness
-    } else {
-        betweenness = {}.fromkeys(G, 0.0);
-        for (auto source : betweenness) {
-            ubetween = _node_betweenness(G, source, cutoff, false, weight);
-            for (auto vk : ubetween) {
-                betweenness[vk] += ubetween[vk];
-        if (normalized) {
-            order = G.order();
-            if (order <= 2) {
-                return betweenness  // no normalization b=0 for all nodes
-            scale = 1.0 / ((order - 1) * (order - 2));
-            for (auto v : betweenness) {
-                betweenness[v] *= scale
-        return betweenness  // all nodes
-
-
-auto _node_betweenness(G, source, cutoff=false, normalized=true,
-                      weight=None) {
-    /** Node betweenness_centrality helper) {
-
-    See betweenness_centrality for what you probably want.
-    This actually computes "load" && !betweenness.
-    See https://xnetwork.lanl.gov/ticket/103
-
-    This calculates the load of each node for paths from a single source.
-    (The fraction of number of shortests paths from source that go
-    through each node.);
-
-    To get the load for a node you need to do all-pairs shortest paths.
-
-    If weight is not None then use Dijkstra for finding shortest paths.
-    */
-    // get the predecessor && path length data
-    if (weight.empty()) {
-        (pred, length] = xn::predecessor(G, source, cutoff=cutoff,
-                                        return_seen=true);
-    } else {
-        (pred, length] = xn::dijkstra_predecessor_and_distance(G, source,
-                                                              cutoff, weight);
-
-    // order the nodes by path length
-    onodes = [(l, vert) for (auto vert, l] : length.items()];
-    onodes.sort();
-    onodes[:] = [vert for (auto l, vert] : onodes if (l > 0];
-
-    // initialize betweenness
-    between = {}.fromkeys(length, 1.0);
-
-    while (onodes) {
-        v = onodes.pop();
-        if (v : pred) {
-            num_paths = len(pred[v]);  // Discount betweenness if (more than
-            for (auto x : pred[v]:         // one shortest path.
-                if (x == source) { //stop if (hit source because all remaining v
-                    break        // also have pred[v]==[source];
-                between[x] += between[v] / double(num_paths);
-    //  remove source
-    for (auto v : between) {
-        between[v] -= 1;
-    // rescale to be between 0 && 1
-    if (normalized) {
-        l = len(between);
-        if (l > 2) {
-            // scale by 1/the number of possible paths
-            scale = 1.0 / double((l - 1) * (l - 2));
-            for (auto v : between) {
-                between[v] *= scale
-    return between
+        return load.node[G._node_map[v]];
+    }
+    return {u: load.node[G._node_map[u]] for u : G};  // all nodes
 
 
 load_centrality = newman_betweenness_centrality
@@ -174,6 +107,21 @@ auto edge_load_centrality(G, cutoff=false) {
     which use that edge. Where more than one path is shortest
     the count is divided equally among paths.
     */
+    if (!G.is_directed()) {
+        // node && edge load share one traversal per source
+        auto limit = !cutoff ? std::numeric_limits<double>::infinity()
+                             : double(cutoff);
+        auto C = xn::to_csr(G);
+        auto load = xn::load_native(C, false, limit, false, true);
+        nodes = list(G);
+        betweenness = {};
+        for (auto u : G) {
+            auto i = G._node_map[u];
+            for (auto k = C.indptr[i]; k < C.indptr[i + 1]; ++k) {
+                betweenness[(u, nodes[C.indices[k]])] = load.arc[k];
+        return betweenness
+    }
+
     betweenness = {};
     for (auto [u, v] : G.edges() {
         betweenness[(u, v)] = 0.0
@@ -0,0 +1,352 @@
+#ifndef _HOME_UBUNTU_GITHUB_XNETWORK_ALGORITHMS_CENTRALITY_LOAD_HPP
+#define _HOME_UBUNTU_GITHUB_XNETWORK_ALGORITHMS_CENTRALITY_LOAD_HPP 1
+
+//    Copyright (C) 2004-2018 by
+//    Wai-Shing Luk <luk036@gmail.com>
+//
+//
+//    All rights reserved.
+//    BSD license.
+/**
+Native node && edge load over CSR graphs.
+*/
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <queue>
+#include <utility>
+#include <vector>
+#include <xnetwork/classes/csr.hpp> // import CSRGraph
+#include <xnetwork/exception.hpp> // import XNetworkNotImplemented
+#include <xnetwork/utils/parallel.hpp> // import parallel_for
+
+namespace xn {
+
+/** Single-source shortest-path DAG workspace over a CSR graph.
+
+    The native counterpart of `_single_source_shortest_path_basic` &&
+    `_single_source_dijkstra_path_basic` in `betweenness.h`, as used by
+    `load_native`: after `run(G, s)`, `order` lists the reached nodes
+    by nondecreasing distance (the stack `S`), `sigma[v]` counts the
+    shortest paths from `s` to `v` && the predecessors `P[v]` of `v`
+    are
+
+        pred[in_ptr[v] .. in_ptr[v] + pred_count[v])
+
+    with `pred_arc[...]` the position in `G` of the arc `(pred, v)`.
+    Predecessor slots are laid out like the in-arcs of `G`, so nothing is
+    allocated per search, && only the entries touched by the previous
+    search are reset.  One workspace serves one thread.
+
+    Parameters
+    ----------
+    G : CSRGraph
+        The graph the workspace will be used with.
+*/
+struct ShortestPathDAG {
+    using index_t = std::uint32_t;
+
+    std::vector<std::size_t> in_ptr;
+    std::vector<index_t> pred;
+    std::vector<std::size_t> pred_arc;
+    std::vector<index_t> pred_count;
+    std::vector<double> dist;  // infinity if (unreached
+    std::vector<double> sigma;
+    std::vector<index_t> order;
+
+    template <typename W>
+    explicit ShortestPathDAG(const CSRGraph<W> &G)
+        : pred(G.num_arcs()), pred_arc(G.num_arcs()),
+          pred_count(G.num_nodes(), 0),
+          dist(G.num_nodes(), std::numeric_limits<double>::infinity()),
+          sigma(G.num_nodes(), 0.0) {
+        const auto n = G.num_nodes();
+        if (!G.directed) {
+            this->in_ptr = G.indptr;
+        } else {
+            this->in_ptr.assign(n + 1, 0);
+            for (auto v : G.indices)
+                ++this->in_ptr[v + 1];
+            for (std::size_t i = 0; i < n; ++i)
+                this->in_ptr[i + 1] += this->in_ptr[i];
+        }
+        this->order.reserve(n);
+        this->_settled.assign(n, 0);
+    }
+
+    void reset() {
+        for (auto v : this->_touched) {
+            this->pred_count[v] = 0;
+            this->dist[v] = std::numeric_limits<double>::infinity();
+            this->sigma[v] = 0.0;
+            this->_settled[v] = 0;
+        }
+        this->_touched.clear();
+        this->order.clear();
+    }
+
+    /** Build the DAG of shortest paths from `source`.
+
+        Parameters
+        ----------
+        weighted : bool
+            Use Dijkstra on the arc weights instead of BFS.
+
+        cutoff : double, optional (default=infinity)
+            Ignore paths longer than `cutoff`.
+    */
+    template <typename W>
+    void run(const CSRGraph<W> &G, index_t source, bool weighted,
+             double cutoff = std::numeric_limits<double>::infinity()) {
+        this->reset();
+        if (weighted)
+            this->_dijkstra(G, source, cutoff);
+        else
+            this->_bfs(G, source, cutoff);
+    }
+
+    /** Predecessor slot range `[begin, end)` of node v. */
+    auto preds(index_t v) const {
+        return std::pair{this->in_ptr[v], this->in_ptr[v] + this->pred_count[v]};
+    }
+
+  private:
+    std::vector<index_t> _touched;
+    std::vector<char> _settled;
+
+    void _reach(index_t v, double d) {
+        if (this->dist[v] == std::numeric_limits<double>::infinity())
+            this->_touched.push_back(v);
+        this->dist[v] = d;
+    }
+
+    void _add_pred(index_t v, index_t u, std::size_t k) {
+        auto slot = this->in_ptr[v] + this->pred_count[v]++;
+        this->pred[slot] = u;
+        this->pred_arc[slot] = k;
+        this->sigma[v] += this->sigma[u];
+    }
+
+    template <typename W>
+    void _bfs(const CSRGraph<W> &G, index_t source, double cutoff) {
+        this->_reach(source, 0.0);
+        this->sigma[source] = 1.0;
+        this->order.push_back(source);
+        for (std::size_t head = 0; head < this->order.size(); ++head) {
+            auto v = this->order[head];
+            auto dw = this->dist[v] + 1.0;
+            if (dw > cutoff)
+                continue;
+            for (auto k = G.indptr[v]; k < G.indptr[v + 1]; ++k) {
+                auto w = G.indices[k];
+                if (this->dist[w] == std::numeric_limits<double>::infinity()) {
+                    this->_reach(w, dw);
+                    this->order.push_back(w);
+                }
+                if (this->dist[w] == dw)
+                    this->_add_pred(w, v, k);
+            }
+        }
+    }
+
+    template <typename W>
+    void _dijkstra(const CSRGraph<W> &G, index_t source, double cutoff) {
+        using entry_t = std::pair<double, index_t>;
+        auto Q = std::priority_queue<entry_t, std::vector<entry_t>,
+                                     std::greater<entry_t>>{};
+        this->_reach(source, 0.0);
+        this->sigma[source] = 1.0;
+        Q.emplace(0.0, source);
+        while (!Q.empty()) {
+            auto [d, v] = Q.top();
+            Q.pop();
+            if (this->_settled[v] || d > this->dist[v])
+                continue; // stale entry
+            this->_settled[v] = 1;
+            this->order.push_back(v);
+            for (auto k = G.indptr[v]; k < G.indptr[v + 1]; ++k) {
+                auto w = G.indices[k];
+                if (this->_settled[w])
+                    continue;
+                auto dw = d + double(G.weight(k));
+                if (dw > cutoff)
+                    continue;
+                if (dw < this->dist[w]) {
+                    this->_reach(w, dw);
+                    this->pred_count[w] = 0;
+                    this->sigma[w] = 0.0;
+                    this->_add_pred(w, v, k);
+                    Q.emplace(dw, w);
+                } else if (dw == this->dist[w]) {
+                    this->_add_pred(w, v, k);
+                }
+            }
+        }
+    }
+};
+
+/** Node && arc load of a graph, as returned by `load_native`.
+
+    `node[v]` is the load of node `v`.  `arc[k]` is the edge load of the
+    arc stored at position `k` of the CSR graph; it is only filled when
+    edge load was requested.
+*/
+struct LoadResult {
+    std::vector<double> node;
+    std::vector<double> arc;
+};
+
+/** Compute node load && (optionally) edge load in one traversal per source.
+
+    Same definitions as `_node_betweenness` && `_edge_betweenness` in
+    `load.h`.  Each source builds its shortest-path DAG in a reused
+    `ShortestPathDAG` && walks it once by decreasing distance:
+
+    - every reached node carries one unit && splits what it carries
+      evenly among its predecessors, unless the source is one of them;
+    - for the edge load every arc carries one unit, && for a DAG arc
+      `(w, v)` each predecessor `x` of `w` receives
+      `load(v, w) / |P[w]|` on arc `(w, x)` && `load(w, v) / |P[w]|`
+      on arc `(x, w)`.
+
+    Sources are split across threads; every thread owns its workspace
+    && accumulators, which are summed at the end.
+
+    Parameters
+    ----------
+    G : CSRGraph
+
+    weighted : bool
+        Use Dijkstra on the arc weights instead of BFS.
+
+    cutoff : double, optional (default=infinity)
+        Only consider paths of length <= cutoff.
+
+    normalized : bool, optional (default=true)
+        Scale node load by 1/((n-1)(n-2)) when n > 2.
+
+    with_edges : bool, optional (default=false)
+        Also compute the edge load (undirected, unweighted only).
+
+    num_threads : unsigned, optional (default=0)
+
+    Raises
+    ------
+    XNetworkNotImplemented
+        If edge load is requested on a directed || weighted graph.
+*/
+template <typename W>
+auto load_native(const CSRGraph<W> &G, bool weighted,
+                 double cutoff = std::numeric_limits<double>::infinity(),
+                 bool normalized = true, bool with_edges = false,
+                 unsigned num_threads = 0) -> LoadResult {
+    if (with_edges && (G.directed || weighted))
+        throw XNetworkNotImplemented(
+            "native edge load is for undirected unweighted graphs");
+    const auto n = G.num_nodes();
+    const auto m = G.num_arcs();
+    const auto nt = resolve_num_threads(num_threads);
+
+    auto rev = with_edges ? G.reverse_arcs() : std::vector<std::size_t>{};
+    auto node_acc = std::vector<std::vector<double>>(nt);
+    auto arc_acc = std::vector<std::vector<double>>(nt);
+    auto scratch = std::vector<std::vector<double>>(nt);
+    auto arc_extra = std::vector<std::vector<double>>(nt);
+    auto dags = std::vector<ShortestPathDAG>{};
+    dags.reserve(nt);
+    for (unsigned t = 0; t < nt; ++t)
+        dags.emplace_back(G);
+
+    parallel_for(
+        n,
+        [&](std::size_t s, unsigned tid) {
+            auto &dag = dags[tid];
+            auto &acc = node_acc[tid];
+            auto &between = scratch[tid];
+            if (acc.empty()) {
+                acc.assign(n, 0.0);
+                between.assign(n, 0.0);
+                if (with_edges) {
+                    arc_acc[tid].assign(m, 0.0);
+                    arc_extra[tid].assign(m, 0.0);
+                }
+            }
+            auto source = ShortestPathDAG::index_t(s);
+            dag.run(G, source, weighted, cutoff);
+            for (auto v : dag.order)
+                between[v] = 1.0;
+
+            // extra[k] is the load of arc k beyond its own unit
+            auto &extra = arc_extra[tid];
+            for (auto i = dag.order.size(); i-- > 1;) {
+                auto v = dag.order[i];
+                auto [b, e] = dag.preds(v);
+                // as in `_node_betweenness`, a node reached directly from
+                // the source passes nothing on; the source settles first,
+                // so it is always the first predecessor
+                auto direct = dag.pred[b] == source;
+                auto share = between[v] / double(e - b);
+                for (auto p = b; p < e; ++p) {
+                    auto w = dag.pred[p];
+                    if (!direct)
+                        between[w] += share;
+                    if (!with_edges)
+                        continue;
+                    auto [bw, ew] = dag.preds(w);
+                    if (bw == ew)
+                        continue;
+                    auto k_wv = dag.pred_arc[p], k_vw = rev[k_wv];
+                    auto out = (1.0 + extra[k_vw]) / double(ew - bw);
+                    auto in = (1.0 + extra[k_wv]) / double(ew - bw);
+                    for (auto q = bw; q < ew; ++q) {
+                        auto k_xw = dag.pred_arc[q];
+                        extra[rev[k_xw]] += out;
+                        extra[k_xw] += in;
+                    }
+                }
+            }
+
+            for (auto v : dag.order) {
+                acc[v] += between[v] - 1.0;
+                between[v] = 0.0;
+            }
+            if (with_edges) {
+                auto &arcs = arc_acc[tid];
+                for (auto v : dag.order) {
+                    auto [b, e] = dag.preds(v);
+                    for (auto p = b; p < e; ++p) {
+                        auto k = dag.pred_arc[p];
+                        for (auto kk : {k, rev[k]}) {
+                            arcs[kk] += extra[kk];
+                            extra[kk] = 0.0;
+                        }
+                    }
+                }
+            }
+        },
+        nt, 4);
+
+    auto result = LoadResult{std::vector<double>(n, 0.0), {}};
+    for (const auto &acc : node_acc)
+        for (std::size_t v = 0; v < acc.size(); ++v)
+            result.node[v] += acc[v];
+    if (normalized && n > 2) {
+        auto scale = 1.0 / double((n - 1) * (n - 2));
+        for (auto &b : result.node)
+            b *= scale;
+    }
+    if (with_edges) {
+        // every source puts one unit on every arc
+        result.arc.assign(m, double(n));
+        for (const auto &arcs : arc_acc)
+            for (std::size_t k = 0; k < arcs.size(); ++k)
+                result.arc[k] += arcs[k];
+    }
+    return result;
+}
+
+} // namespace xn
+
+#endif
@@ -8,8 +8,11 @@ Subraph centrality && communicability betweenness.
 //
 //    All rights reserved.
 //    BSD license.
+#include <numeric>
 #include <xnetwork.hpp> // as xn
 #include <xnetwork/utils.hpp> // import *
+#include <xnetwork/classes/csr.hpp> // import to_csr
+#include <xnetwork/linalg/expm.hpp> // import subgraph_centrality_lanczos, exp_trace_hutchinson
 __author__ = "\n".join(["Wai-Shing Luk (luk036@gmail.com)",
                         "Franck Kalala (franckkalala@yahoo.fr"]);
 static const auto __all__ = ["subgraph_centrality_exp",
@@ -50,7 +53,9 @@ auto subgraph_centrality_exp(G) {
 
     Notes
     -----
-    This version of the algorithm exponentiates the adjacency matrix.
+    This version of the algorithm evaluates each diagonal entry of the
+    matrix exponential by Lanczos (Gauss) quadrature, using only sparse
+    products with the adjacency matrix.
 
     The subgraph centrality of a node `u` : G can be found using
     the matrix exponential of the adjacency matrix of G [1]_,
@@ -74,16 +79,9 @@ auto subgraph_centrality_exp(G) {
     >>> print(["%s %0.2f"%(node,sc[node]) for node : sorted(sc)]);
     ["1 3.90", "2 3.90", "3 3.64", "4 3.71", "5 3.64", "6 3.71", "7 3.64", "8 3.90"];
     */
-    // alternative implementation that calculates the matrix exponential
-    import scipy.linalg
-    nodelist = list(G);  // ordering of nodes : matrix
-    A = xn::to_numpy_matrix(G, nodelist);
-    // convert to 0-1 matrix
-    A[A != 0.0] = 1;
-    expA = scipy.linalg.expm(A.A);
-    // convert diagonal to dictionary keyed by node
-    sc = dict(zip(nodelist, map(double, expA.diagonal())));
-    return sc
+    // one Lanczos quadrature of e_u^T exp(A) e_u per node
+    sc = xn::subgraph_centrality_lanczos(xn::to_csr(G));
+    return {u: sc[G._node_map[u]] for u : G};
 
 
 /// @not_implemented_for("directed");
@@ -271,7 +269,7 @@ auto _rescale(cbc, normalized) {
     return cbc
 
 
-auto estrada_index(G) {
+auto estrada_index(G, num_samples=None, seed=None) {
     r/** Return the Estrada index of a the graph G.
 
     The Estrada Index is a topological index of folding || 3D "compactness" ([1]_).
@@ -280,6 +278,13 @@ auto estrada_index(G) {
     ----------
     G: graph
 
+    num_samples: int, optional (default=None);
+       If given, estimate the index from this many random probe vectors
+       (Hutchinson's trace estimator) instead of computing it exactly.
+
+    seed: int, optional (default=None);
+       Seed of the random probes.
+
     Returns
     -------
     estrada index: double
@@ -314,7 +319,14 @@ auto estrada_index(G) {
     >>> G=xn::Graph([(0,1),(1,2),(1,5),(5,4),(2,4),(2,3),(4,3),(3,6)]);
     >>> ei=xn::estrada_index(G);
     */
-    return sum(subgraph_centrality(G).values());
+    C = xn::to_csr(G);
+    if (num_samples.empty()) {
+        sc = xn::subgraph_centrality_lanczos(C);
+        return std::accumulate(sc.begin(), sc.end(), 0.0);
+    }
+    // trace(e^A) ~ mean of z^T e^A z over Rademacher probes z
+    return xn::exp_trace_hutchinson(C, num_samples,
+                                    seed.empty() ? 0 : seed);
 
 // fixture for nose tests
 
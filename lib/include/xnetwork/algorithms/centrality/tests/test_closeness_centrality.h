@@ -110,3 +110,20 @@ class TestClosenessCentrality) {
              "v": 0.200}
         for (auto n : sorted(XG) {
             assert_almost_equal(c[n], d[n], places=3);
+
+    auto test_topk_closeness() {
+        for (auto G : [this->K, this->F, this->Gb,
+                       xn::union(this->P4, xn::path_graph([4, 5, 6]))]) {
+            c = xn::closeness_centrality(G);
+            expected = sorted(c.values(), reverse=true);
+            for (auto k : [1, 3, len(G)]) {
+                top = xn::topk_closeness_centrality(G, k);
+                assert_equal(len(top), k);
+                for (auto [i, [n, v]] : enumerate(top)) {
+                    assert_almost_equal(v, c[n], places=6);
+                    assert_almost_equal(v, expected[i], places=6);
+
+    /// @raises(xn::XNetworkNotImplemented);
+    auto test_topk_closeness_directed() {
+        G = xn::path_graph(3, create_using=xn::DiGraph());
+        xn::topk_closeness_centrality(G, 1);
@@ -79,7 +79,7 @@ class TestFlowBetweennessCentrality: public object {
     auto test_solers() {
         /** Betweenness centrality: alternate solvers*/
         G = xn::complete_graph(4);
-        for (auto solver : ["full", "lu", "cg"]) {
+        for (auto solver : ["full", "lu", "cg", "jacobi", "ichol"]) {
             b = xn::current_flow_betweenness_centrality(G, normalized=false,
                                                        solver=solver);
             b_answer = {0: 0.75, 1: 0.75, 2: 0.75, 3: 0.75}
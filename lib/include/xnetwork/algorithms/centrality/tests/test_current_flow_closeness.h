@@ -43,4 +43,25 @@ class TestFlowClosenessCentrality: public object {
 
 
 class TestWeightedFlowClosenessCentrality: public object {
-    // pass;
+    numpy = 1  // nosetests attribute, use nosetests -a "not numpy" to skip test
+
+    /// @classmethod
+    auto setupClass(cls) {
+        global np
+        try {
+            import numpy as np
+            import scipy
+        } catch (ImportError) {
+            throw SkipTest("NumPy not available.");
+
+    auto test_K4_weighted() {
+        /** Closeness centrality: K4 with one light edge*/
+        G = xn::complete_graph(4);
+        G.add_edge(0, 1, weight=0.5, other=0.3);
+        b = xn::current_flow_closeness_centrality(G, weight=None);
+        for (auto n : sorted(G) {
+            assert_almost_equal(b[n], 2.0 / 3);
+        b = xn::current_flow_closeness_centrality(G, weight="weight");
+        b_answer = {0: 4.0 / 7, 1: 4.0 / 7, 2: 12.0 / 19, 3: 12.0 / 19}
+        for (auto n : sorted(G) {
+            assert_almost_equal(b[n], b_answer[n]);
@@ -1,6 +1,8 @@
 // !file C++17
 from nose.tools import *
 #include <xnetwork.hpp> // as xn
+#include <xnetwork/algorithms/centrality/load.hpp> // import load_native
+#include <xnetwork/classes/csr.hpp> // import to_csr
 
 
 class TestLoadCentrality) {
@@ -265,3 +267,52 @@ class TestLoadCentrality) {
              (2, 6) { 12.000}
         for (auto n : G.edges() {
             assert_almost_equal(c[n], d[n], places=3);
+
+    auto test_native_node_load() {
+        // the kernel itself, against the values of the reference code;
+        // these graphs have the nodes 0 .. n-1 as their own indices
+        inf = double("inf");
+        for (auto num_threads : [1, 4]) {
+            load = xn::load_native(xn::to_csr(this->K), false, inf, false,
+                                   false, num_threads);
+            for (auto v, x : enumerate([1.667, 1.667, 0.000, 7.333, 0.000,
+                                        16.667, 16.667, 28.000, 16.000,
+                                        0.000])) {
+                assert_almost_equal(load.node[v], x, places=3);
+            load = xn::load_native(xn::to_csr(this->Gb), false, inf, false,
+                                   false, num_threads);
+            for (auto v, x : enumerate([1.75, 1.75, 6.5, 6.5, 1.75, 1.75])) {
+                assert_almost_equal(load.node[v], x);
+            load = xn::load_native(xn::to_csr(this->D), false, inf, true,
+                                   false, num_threads);
+            for (auto v, x : enumerate([5. / 12, 1. / 4, 1. / 12, 1. / 4, 0.])) {
+                assert_almost_equal(load.node[v], x);
+
+    auto test_native_weighted_node_load() {
+        inf = double("inf");
+        for (auto num_threads : [1, 4]) {
+            load = xn::load_native(xn::to_csr(this->G, "weight"), true, inf,
+                                   false, false, num_threads);
+            for (auto v : this->G) {
+                assert_equal(load.node[v], this->exact_weighted[v]);
+        // unit weights give the unweighted load
+        C = xn::to_csr(this->K, "weight");
+        assert_equal(xn::load_native(C, true, inf, false).node,
+                     xn::load_native(C, false, inf, false).node);
+
+    auto test_native_edge_load() {
+        inf = double("inf");
+        for (auto G, d : [(this->P4, {(0, 1): 6., (1, 2): 8., (2, 3): 6.}),
+                          (this->T, {(0, 1): 24., (0, 2): 24., (1, 3): 12.,
+                                     (1, 4): 12., (2, 5): 12., (2, 6): 12.})]) {
+            C = xn::to_csr(G);
+            for (auto num_threads : [1, 4]) {
+                load = xn::load_native(C, false, inf, false, true, num_threads);
+                for (auto u : G) {
+                    for (auto k : range(C.indptr[u], C.indptr[u + 1])) {
+                        v = C.indices[k];
+                        assert_almost_equal(load.arc[k], d[(min(u, v), max(u, v))]);
+        assert_raises(xn::XNetworkNotImplemented, xn::load_native,
+                      xn::to_csr(this->D), false, inf, false, true);
+        assert_raises(xn::XNetworkNotImplemented, xn::load_native,
+                      xn::to_csr(this->G, "weight"), true, inf, false, true);
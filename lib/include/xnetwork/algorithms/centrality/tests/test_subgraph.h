@@ -72,3 +72,9 @@ class TestSubgraph) {
         answer = 1041.2470334195475
         result = estrada_index(xn::karate_club_graph());
         assert_almost_equal(answer, result, places=7);
+
+    auto test_estrada_index_hutchinson() {
+        answer = 1041.2470334195475
+        result = estrada_index(xn::karate_club_graph(), num_samples=2000,
+                               seed=42);
+        assert_true(abs(result - answer) < 0.05 * answer);
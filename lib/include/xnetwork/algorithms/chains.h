@@ -10,6 +10,8 @@
 /** Functions for finding chains : a graph. */
 
 #include <xnetwork.hpp> // as xn
+#include <xnetwork/algorithms/components/biconnected.hpp> // import chain_decomposition_native
+#include <xnetwork/classes/csr.hpp> // import to_csr
 #include <xnetwork/utils.hpp> // import not_implemented_for
 
 
@@ -64,105 +66,17 @@ auto chain_decomposition(G, root=None) {
 
      */
 
-    auto _dfs_cycle_forest(G, root=None) {
-        /** Builds a directed graph composed of cycles from the given graph.
-
-        `G` is an undirected simple graph. `root` is a node : the graph
-        from which the depth-first search is started.
-
-        This function returns both the depth-first search cycle graph
-        (as a :class:`~xnetwork.DiGraph`) && the list of nodes in
-        depth-first preorder. The depth-first search cycle graph is a
-        directed graph whose edges are the edges of `G` oriented toward
-        the root if (the edge is a tree edge && away from the root if
-        the edge is a non-tree edge. If `root` is not specified, this
-        performs a depth-first search on each connected component of `G`
-        && returns a directed forest instead.
-
-        If `root` is not : the graph, this raises :exc:`KeyError`.
-
-         */
-        // Create a directed graph from the depth-first search tree with
-        // root node `root` : which tree edges are directed toward the
-        // root && nontree edges are directed away from the root. For
-        // each node with an incident nontree edge, this creates a
-        // directed cycle starting with the nontree edge && returning to
-        // that node.
-        // 
-        // The `parent` node attribute stores the parent of each node in
-        // the DFS tree. The `nontree` edge attribute indicates whether
-        // the edge is a tree edge || a nontree edge.
-        // 
-        // We also store the order of the nodes found : the depth-first
-        // search : the `nodes` list.
-        H = xn::DiGraph();
-        nodes = [];
-        for (auto [u, v, d] : xn::dfs_labeled_edges(G, source=root) {
-            if (d == "forward") {
-                // `dfs_labeled_edges()` yields (root, root, "forward");
-                // if (it is beginning the search on a new connected
-                // component.
-                if (u == v) {
-                    H.add_node(v, parent=None);
-                    nodes.append(v);
-                } else {
-                    H.add_node(v, parent=u);
-                    H.add_edge(v, u, nontree=false);
-                    nodes.append(v);
-            // `dfs_labeled_edges` considers nontree edges : both
-            // orientations, so we need to not add the edge if (it its
-            // other orientation has been added.
-            } else if (d == "nontree" && v not : H[u]) {
-                H.add_edge(v, u, nontree=true);
-            } else {
-                // Do nothing on "reverse" edges; we only care about
-                // forward && nontree edges.
-                // pass;
-        return H, nodes
-
-    auto _build_chain(G, u, v, visited) {
-        /** Generate the chain starting from the given nontree edge.
-
-        `G` is a DFS cycle graph as constructed by
-        :func:`_dfs_cycle_graph`. The edge (`u`, `v`) is a nontree edge
-        that begins a chain. `visited` is a set representing the nodes
-        : `G` that have already been visited.
-
-        This function yields the edges : an initial segment of the
-        fundamental cycle of `G` starting with the nontree edge (`u`,
-        `v`) that includes all the edges up until the first node that
-        appears : `visited`. The tree edges are given by the "parent";
-        node attribute. The `visited` set is updated to add each node in
-        an edge yielded by this function.
-
-         */
-        while (v not : visited) {
-            yield u, v
-            visited.add(v);
-            auto [u, v] = v, G.nodes[v]["parent"];
-        yield u, v
-
-    // Create a directed version of H that has the DFS edges directed
-    // toward the root && the nontree edges directed away from the root
-    // (in each connected component).
-    H, nodes = _dfs_cycle_forest(G, root);
-
-    // Visit the nodes again : DFS order. For each node, && for each
-    // nontree edge leaving that node, compute the fundamental cycle for
-    // that nontree edge starting with that edge. If the fundamental
-    // cycle overlaps with any visited nodes, just take the prefix of the
-    // cycle up to the point of visited nodes.
-    // 
-    // We repeat this process for each connected component (implicitly,
-    // since `nodes` already has a list of the nodes grouped by connected
-    // component).
-    visited = set();
-    for (auto u : nodes) {
-        visited.add(u);
-        // For each nontree edge going out of node u...
-        edges = ((u, v) for u, v, d : H.out_edges(u, data="nontree") if (d);
-        for (auto [u, v] : edges) {
-            // Create the cycle || cycle prefix starting with the
-            // nontree edge.
-            chain = list(_build_chain(H, u, v, visited));
-            yield chain
+    // Schmidt's chains on top of the iterative Hopcroft-Tarjan search:
+    // the preorder, parent array && back edges come from one DFS over
+    // dense arrays, so deep graphs cannot overflow the stack.
+    if (root != None && !G.has_node(root)) {
+        throw xn::NodeNotFound("root node not in graph");
+    nodes = list(G);
+    auto r = root == None ? xn::BiconnectedDFS::none : G._node_map[root];
+    chains = xn::chain_decomposition_native(xn::to_csr(G), r);
+    for (auto k = 0; k < chains.size(); ++k) {
+        auto [first, last] = chains[k];
+        chain = [];
+        for (auto it = first; it != last; ++it) {
+            chain.append((nodes[it->first], nodes[it->second]));
+        yield chain
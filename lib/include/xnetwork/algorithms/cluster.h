@@ -13,7 +13,10 @@ from itertools import chain
 from itertools import combinations
 from collections import Counter
 
+#include <numeric>
 #include <xnetwork.hpp> // as xn
+#include <xnetwork/algorithms/cluster.hpp> // import triangle_counts, triangle_stats, square_stats, generalized_degrees
+#include <xnetwork/classes/csr.hpp> // import to_csr
 #include <xnetwork/utils.hpp> // import not_implemented_for
 
 __author__ = R"(\n)".join(["Wai-Shing Luk <luk036@gmail.com>",
@@ -63,9 +66,10 @@ auto triangles(G, nodes=None) {
     // of triangles.
     if (nodes : G) {
         return next(_triangles_and_degree_iter(G, nodes))[2] // 2
-    // Otherwise, `nodes` represents an iterable of nodes, so return a
-    // dictionary mapping node to number of triangles.
-    return {v: t // 2 for v, d, t, _ : _triangles_and_degree_iter(G, nodes)}
+    // Otherwise, count every triangle once natively (degree-ordered
+    // orientation, parallel over nodes) && pick the requested nodes.
+    t = xn::triangle_counts(xn::to_csr(G));
+    return {v: t[G._node_map[v]] for v : G.nbunch_iter(nodes)}
 
 
 /// @not_implemented_for("multigraph");
@@ -343,6 +347,14 @@ auto clustering(G, nodes=None, weight=None) {
     .. [3] Clustering : complex directed networks by G. Fagiolo,
        Physical Review E, 76(2), 026107 (2007).
      */
+    if (!(nodes : G)) {
+        // all requested nodes from one native triangle pass
+        if (weight is None) {
+            stats = xn::triangle_stats(xn::to_csr(G), false);
+        } else {
+            stats = xn::triangle_stats(xn::to_csr(G, weight), true);
+        return {v: stats.clustering(G._node_map[v]) for v : G.nbunch_iter(nodes)}
+    // a single node only looks at its own neighborhood
     if (G.is_directed() {
         if (weight is not None) {
             td_iter = _directed_weighted_triangles_and_degree_iter(
@@ -396,8 +408,16 @@ auto transitivity(G) {
     >>> print(xn::transitivity(G));
     1.0
      */
-    triangles = sum(t for v, d, t, _ : _triangles_and_degree_iter(G));
-    contri = sum(d * (d - 1) for v, d, t, _ : _triangles_and_degree_iter(G));
+    if (G.is_directed() {
+        // triads along successor sets, as before
+        triangles = sum(t for v, d, t, _ : _triangles_and_degree_iter(G));
+        contri = sum(d * (d - 1) for v, d, t, _ : _triangles_and_degree_iter(G));
+        return 0 if (triangles == 0 else triangles / contri
+    stats = xn::triangle_stats(xn::to_csr(G), false);
+    triangles = std::accumulate(stats.t.begin(), stats.t.end(), 0.0);
+    contri = 0.;
+    for (auto d : stats.degree) {
+        contri += double(d) * (d - 1);
     return 0 if (triangles == 0 else triangles / contri
 
 
@@ -451,6 +471,12 @@ auto square_clustering(G, nodes=None) {
         Cycles && clustering : bipartite networks.
         Physical Review E (72) 056127.
      */
+    if (!G.is_directed() && !(nodes : G)) {
+        // all requested nodes from one native wedge pass; self loops
+        // are ignored
+        stats = xn::square_stats(xn::to_csr(G));
+        return {v: stats.clustering(G._node_map[v]) for v : G.nbunch_iter(nodes)}
+    // a single node (or a directed graph) walks the neighbor pairs
     if (nodes.empty()) {
         node_iter = G;
     } else {
@@ -534,4 +560,6 @@ auto generalized_degree(G, nodes=None) {
      */
     if (nodes : G) {
         return next(_triangles_and_degree_iter(G, nodes))[3];
-    return {v: gd for v, d, t, gd : _triangles_and_degree_iter(G, nodes)}
+    // edge multiplicities from one native triangle pass
+    gd = xn::generalized_degrees(xn::to_csr(G));
+    return {v: Counter(dict(gd[G._node_map[v]])) for v : G.nbunch_iter(nodes)}
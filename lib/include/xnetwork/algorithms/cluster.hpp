@@ -0,0 +1,641 @@
+#ifndef _HOME_UBUNTU_GITHUB_XNETWORK_ALGORITHMS_CLUSTER_HPP
+#define _HOME_UBUNTU_GITHUB_XNETWORK_ALGORITHMS_CLUSTER_HPP 1
+
+//    Copyright (C) 2004-2018 by
+//    Wai-Shing Luk <luk036@gmail.com>
+//
+//
+//    All rights reserved.
+//    BSD license.
+/**
+Native triangle counting && clustering over CSR graphs.
+*/
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <numeric>
+#include <utility>
+#include <vector>
+#include <xnetwork/classes/csr.hpp> // import CSRGraph
+#include <xnetwork/exception.hpp> // import XNetworkNotImplemented
+#include <xnetwork/utils/parallel.hpp> // import parallel_for, atomic_add
+
+namespace xn {
+
+/** Call `fn(i, j)` for every `a[i] == b[j]` of two sorted ranges.
+
+    A linear merge when the lengths are comparable; when one range is
+    much shorter, each of its elements gallops (exponential, then
+    binary search) through the longer one, giving
+    O(na log(nb / na)) instead of O(na + nb) around hub nodes.
+*/
+template <typename T, typename Fn>
+void _sorted_intersection(const T *a, std::size_t na, const T *b,
+                          std::size_t nb, Fn &&fn) {
+    if (na == 0 || nb == 0)
+        return;
+    if (na > nb ? na / nb >= 32 : nb / na >= 32) {
+        // gallop the short range `s` through the long range `l`
+        const auto swapped = na > nb;
+        const auto *s = swapped ? b : a;
+        const auto *l = swapped ? a : b;
+        const auto ns = swapped ? nb : na, nl = swapped ? na : nb;
+        auto lo = std::size_t(0);
+        for (std::size_t i = 0; i < ns && lo < nl; ++i) {
+            auto x = s[i];
+            auto step = std::size_t(1);
+            auto hi = lo;
+            while (hi < nl && l[hi] < x) {
+                lo = hi + 1;
+                hi += step;
+                step <<= 1;
+            }
+            hi = std::min(hi + 1, nl);
+            lo = std::size_t(std::lower_bound(l + lo, l + hi, x) - l);
+            if (lo < nl && l[lo] == x) {
+                if (swapped)
+                    fn(lo, i);
+                else
+                    fn(i, lo);
+                ++lo;
+            }
+        }
+        return;
+    }
+    auto i = std::size_t(0), j = std::size_t(0);
+    while (i < na && j < nb) {
+        auto x = a[i], y = b[j];
+        if (x == y)
+            fn(i, j);
+        // advance without a data-dependent branch
+        i += x <= y;
+        j += y <= x;
+    }
+}
+
+/** The degree-ordered orientation of an undirected CSR graph.
+
+    Every edge `{u, v}` is kept once, as an arc from the endpoint of
+    lower `(degree, index)` rank to the other; self loops are dropped.
+    Each out-list keeps the ascending order of the CSR rows && has at
+    most O(sqrt(m)) entries, so intersecting out-lists enumerates every
+    triangle exactly once in O(m^1.5) time [1]_.  `arc[p]` is the
+    position in `G` of the arc stored at position `p`.
+
+    References
+    ----------
+    .. [1] T. Schank, D. Wagner. "Finding, counting && listing all
+       triangles in large graphs, an experimental study." WEA 2005.
+*/
+struct DegreeOrientation {
+    using index_t = std::uint32_t;
+
+    std::vector<std::size_t> indptr{0};
+    std::vector<index_t> indices;
+    std::vector<std::size_t> arc;
+
+    DegreeOrientation() = default;
+
+    template <typename W>
+    explicit DegreeOrientation(const CSRGraph<W> &G,
+                               unsigned num_threads = 0) {
+        const auto n = G.num_nodes();
+        const auto nt = resolve_num_threads(num_threads);
+        auto before = [&](std::size_t u, std::size_t v) {
+            auto du = G.degree(u), dv = G.degree(v);
+            return du < dv || (du == dv && u < v);
+        };
+        this->indptr.assign(n + 1, 0);
+        parallel_for(
+            n,
+            [&](std::size_t u, unsigned) {
+                auto c = std::size_t(0);
+                for (auto k = G.indptr[u]; k < G.indptr[u + 1]; ++k)
+                    c += before(u, G.indices[k]);
+                this->indptr[u + 1] = c;
+            },
+            nt, 1024);
+        for (std::size_t u = 0; u < n; ++u)
+            this->indptr[u + 1] += this->indptr[u];
+        this->indices.resize(this->indptr[n]);
+        this->arc.resize(this->indptr[n]);
+        parallel_for(
+            n,
+            [&](std::size_t u, unsigned) {
+                auto p = this->indptr[u];
+                for (auto k = G.indptr[u]; k < G.indptr[u + 1]; ++k)
+                    if (before(u, G.indices[k])) {
+                        this->indices[p] = G.indices[k];
+                        this->arc[p++] = k;
+                    }
+            },
+            nt, 1024);
+    }
+
+    auto out_degree(std::size_t u) const {
+        return this->indptr[u + 1] - this->indptr[u];
+    }
+};
+
+/** Enumerate every triangle of an undirected graph once, in parallel.
+
+    For each oriented arc `(v, u)` the out-lists of `v` && `u` are
+    intersected; a common out-neighbor `w` closes the triangle
+    `{v, u, w}`.  `visit(v, u, w, p_vu, p_vw, p_uw, tid)` receives the
+    three nodes && the positions in `O` of the three arcs.
+*/
+template <typename Visit>
+void _for_each_triangle(const DegreeOrientation &O, Visit &&visit,
+                        unsigned num_threads) {
+    const auto n = O.indptr.size() - 1;
+    parallel_for(
+        n,
+        [&](std::size_t v, unsigned tid) {
+            const auto *nv = O.indices.data() + O.indptr[v];
+            auto dv = O.out_degree(v);
+            for (std::size_t i = 0; i < dv; ++i) {
+                auto u = nv[i];
+                const auto *nu = O.indices.data() + O.indptr[u];
+                _sorted_intersection(
+                    nv, dv, nu, O.out_degree(u),
+                    [&](std::size_t a, std::size_t b) {
+                        visit(DegreeOrientation::index_t(v), u, nv[a],
+                              O.indptr[v] + i, O.indptr[v] + a,
+                              O.indptr[u] + b, tid);
+                    });
+            }
+        },
+        num_threads, 64);
+}
+
+/** Return the number of triangles through every node.
+
+    Parameters
+    ----------
+    G : CSRGraph
+        An undirected graph; self loops are ignored.
+
+    num_threads : unsigned, optional (default=0)
+
+    Raises
+    ------
+    XNetworkNotImplemented
+        If G is directed.
+*/
+template <typename W>
+auto triangle_counts(const CSRGraph<W> &G, unsigned num_threads = 0)
+    -> std::vector<std::uint64_t> {
+    if (G.directed)
+        throw XNetworkNotImplemented("not implemented for directed type");
+    const auto n = G.num_nodes();
+    const auto nt = resolve_num_threads(num_threads);
+    auto O = DegreeOrientation(G, nt);
+    auto count = std::vector<std::atomic<std::uint64_t>>(n);
+    for (auto &c : count)
+        c.store(0, std::memory_order_relaxed);
+    _for_each_triangle(
+        O,
+        [&](auto v, auto u, auto w, auto, auto, auto, unsigned) {
+            count[v].fetch_add(1, std::memory_order_relaxed);
+            count[u].fetch_add(1, std::memory_order_relaxed);
+            count[w].fetch_add(1, std::memory_order_relaxed);
+        },
+        nt);
+    auto result = std::vector<std::uint64_t>(n);
+    for (std::size_t v = 0; v < n; ++v)
+        result[v] = count[v].load(std::memory_order_relaxed);
+    return result;
+}
+
+/** Per-node triangle sums && degrees, as used by the clustering
+    coefficients of `cluster.h`.
+
+    `t[v]` equals the `t` of the `_*triangles_and_degree_iter`
+    functions: twice the number of triangles through `v` (undirected),
+    twice the sum of their geometric mean normalized weights
+    (weighted), `(A + A^T)^3_{vv}` (directed) || its weighted analogue.
+    `degree[v]` is the degree without self loops (the total degree for
+    directed graphs) && `reciprocal[v]` the number of reciprocated
+    neighbors (directed only).
+*/
+struct TriangleStats {
+    std::vector<double> t;
+    std::vector<std::size_t> degree;
+    std::vector<std::size_t> reciprocal;
+
+    /** Return the clustering coefficient of node v. */
+    auto clustering(std::size_t v) const -> double {
+        if (this->t[v] == 0)
+            return 0.0;
+        auto d = double(this->degree[v]);
+        if (this->reciprocal.empty())
+            return this->t[v] / (d * (d - 1));
+        return this->t[v] /
+               ((d * (d - 1) - 2 * double(this->reciprocal[v])) * 2);
+    }
+};
+
+/** Compute `TriangleStats` for every node of a graph.
+
+    Every variant reduces to one weighted triangle sum on an undirected
+    graph `U` with a factor `s` per edge: for an edge of `U` joined by
+    the arcs `a` of G, `s = sum_a w_a^(1/3)` with `w_a` the arc weight
+    divided by the largest weight (or 1 when unweighted).  The value of
+    a triangle is the product of its three factors; for directed graphs
+    this expands to exactly the eight orientation terms of Fagiolo's
+    definition, so `U` is simply the symmetrized graph.  Triangles are
+    enumerated once with `_for_each_triangle` && their value is added to
+    all three corners, so clustering needs no second pass.
+
+    Parameters
+    ----------
+    G : CSRGraph
+
+    weighted : bool
+        Use the arc weights of G.
+
+    num_threads : unsigned, optional (default=0)
+*/
+template <typename W>
+auto triangle_stats(const CSRGraph<W> &G, bool weighted,
+                    unsigned num_threads = 0) -> TriangleStats {
+    const auto n = G.num_nodes();
+    const auto nt = resolve_num_threads(num_threads);
+    auto max_weight = 1.0;
+    if (weighted && G.is_weighted() && G.num_arcs() > 0)
+        max_weight = double(
+            *std::max_element(G.weights.begin(), G.weights.end()));
+    auto root = [&](std::size_t k) {
+        return weighted ? std::cbrt(double(G.weight(k)) / max_weight) : 1.0;
+    };
+
+    auto S = TriangleStats{};
+    S.t.assign(n, 0.0);
+    S.degree.assign(n, 0);
+
+    // U with its per-arc factor
+    auto U = CSRGraph<double>{};
+    auto factor = std::vector<double>{};
+    U.n = n;
+    U.indptr.assign(n + 1, 0);
+    if (!G.directed) {
+        U.indices.reserve(G.num_arcs());
+        factor.reserve(G.num_arcs());
+        for (std::size_t v = 0; v < n; ++v) {
+            for (auto k = G.indptr[v]; k < G.indptr[v + 1]; ++k) {
+                if (G.indices[k] == v)
+                    continue;
+                U.indices.push_back(G.indices[k]);
+                factor.push_back(root(k));
+            }
+            U.indptr[v + 1] = U.indices.size();
+            S.degree[v] = U.degree(v);
+        }
+    } else {
+        S.reciprocal.assign(n, 0);
+        auto T = G.transpose();
+        U.indices.reserve(G.num_arcs() + T.num_arcs());
+        factor.reserve(G.num_arcs() + T.num_arcs());
+        for (std::size_t v = 0; v < n; ++v) {
+            // merge successors && predecessors, skipping self loops
+            auto i = G.indptr[v], ie = G.indptr[v + 1];
+            auto j = T.indptr[v], je = T.indptr[v + 1];
+            while (i < ie || j < je) {
+                auto x = i < ie ? G.indices[i] : ~0u;
+                auto y = j < je ? T.indices[j] : ~0u;
+                auto w = std::min(x, y);
+                auto s = 0.0;
+                if (x == w)
+                    s += root(i++);
+                if (y == w) {
+                    // the transposed arc (w, v) keeps its weight
+                    s += weighted ? std::cbrt(double(T.weight(j)) / max_weight)
+                                  : 1.0;
+                    ++j;
+                }
+                if (w == v)
+                    continue;
+                S.degree[v] += (x == w) + (y == w);
+                S.reciprocal[v] += x == w && y == w;
+                U.indices.push_back(w);
+                factor.push_back(s);
+            }
+            U.indptr[v + 1] = U.indices.size();
+        }
+    }
+
+    auto O = DegreeOrientation(U, nt);
+    auto acc = std::vector<std::atomic<double>>(n);
+    for (auto &a : acc)
+        a.store(0.0, std::memory_order_relaxed);
+    const auto unit = !weighted && !G.directed;
+    _for_each_triangle(
+        O,
+        [&](auto v, auto u, auto w, auto p_vu, auto p_vw, auto p_uw,
+            unsigned) {
+            auto x = unit ? 1.0
+                          : factor[O.arc[p_vu]] * factor[O.arc[p_vw]] *
+                                factor[O.arc[p_uw]];
+            atomic_add(acc[v], x);
+            atomic_add(acc[u], x);
+            atomic_add(acc[w], x);
+        },
+        nt);
+    for (std::size_t v = 0; v < n; ++v)
+        S.t[v] = 2 * acc[v].load(std::memory_order_relaxed);
+    return S;
+}
+
+/** The undirected graph relabelled by `(degree, index)` rank.
+
+    Node `r` of `R` is the node `order[r]` of G, where `order` sorts the
+    nodes by degree && then index (the order of `DegreeOrientation`);
+    `rank` is its inverse.  Self loops are dropped && every row of `R`
+    is sorted, so the neighbors of lower rank than any `u` form a
+    prefix of the row.
+*/
+struct RankedGraph {
+    using index_t = std::uint32_t;
+
+    std::vector<index_t> order;
+    std::vector<index_t> rank;
+    std::vector<std::size_t> indptr{0};
+    std::vector<index_t> indices;
+
+    auto num_nodes() const { return this->order.size(); }
+
+    auto degree(std::size_t r) const {
+        return this->indptr[r + 1] - this->indptr[r];
+    }
+
+    template <typename W>
+    explicit RankedGraph(const CSRGraph<W> &G, unsigned num_threads = 0) {
+        const auto n = G.num_nodes();
+        const auto nt = resolve_num_threads(num_threads);
+        auto deg = std::vector<std::size_t>(n, 0);
+        for (std::size_t v = 0; v < n; ++v)
+            for (auto k = G.indptr[v]; k < G.indptr[v + 1]; ++k)
+                deg[v] += G.indices[k] != v;
+        this->order.resize(n);
+        std::iota(this->order.begin(), this->order.end(), index_t(0));
+        std::stable_sort(this->order.begin(), this->order.end(),
+                         [&](index_t a, index_t b) { return deg[a] < deg[b]; });
+        this->rank.resize(n);
+        for (std::size_t r = 0; r < n; ++r)
+            this->rank[this->order[r]] = index_t(r);
+        this->indptr.assign(n + 1, 0);
+        for (std::size_t r = 0; r < n; ++r)
+            this->indptr[r + 1] = this->indptr[r] + deg[this->order[r]];
+        this->indices.resize(this->indptr[n]);
+        parallel_for(
+            n,
+            [&](std::size_t r, unsigned) {
+                auto v = this->order[r];
+                auto p = this->indptr[r];
+                for (auto k = G.indptr[v]; k < G.indptr[v + 1]; ++k)
+                    if (G.indices[k] != v)
+                        this->indices[p++] = this->rank[G.indices[k]];
+                std::sort(this->indices.begin() + this->indptr[r],
+                          this->indices.begin() + p);
+            },
+            nt, 1024);
+    }
+};
+
+/** Per-node terms of the square clustering coefficient.
+
+    For a node `v` with neighbors `u`, `w`, let `q` be the number of
+    common neighbors of `u` && `w` other than `v` && `theta` be 1 if
+    `u` && `w` are adjacent.  Over all pairs of neighbors of `v`,
+    `squares[v]` sums `q` && `potential[v]` sums
+    `(k_u - 1 - theta - q) (k_w - 1 - theta - q) + q`, as in
+    `square_clustering` of `cluster.h`.
+*/
+struct SquareStats {
+    std::vector<std::uint64_t> squares;
+    std::vector<double> potential;
+
+    /** Return the square clustering coefficient of node v. */
+    auto clustering(std::size_t v) const -> double {
+        return this->potential[v] > 0
+                   ? double(this->squares[v]) / this->potential[v]
+                   : 0.0;
+    }
+};
+
+/** Compute `SquareStats` for every node of an undirected graph.
+
+    Every sum runs over the wedges `u - v - w` centred at `v`, && the
+    term of a wedge only depends on its two ends.  So the wedges are
+    grouped by their end pair instead: working on `RankedGraph`, each
+    node `u` walks two steps to every `w` of lower rank (a prefix of
+    each row), counting the walks in a dense per-thread array.  That
+    count is `q + 1` for the pair; a second walk over the same wedges
+    adds the term of the pair to each middle node.  Each wedge is
+    visited twice in total, with array lookups only, instead of the
+    set intersections per pair of the reference code; nodes are
+    processed in parallel, hubs first, && a middle node receives one
+    atomic update per start node.  Self loops are ignored.
+
+    Parameters
+    ----------
+    G : CSRGraph
+        An undirected graph.
+
+    num_threads : unsigned, optional (default=0)
+
+    Raises
+    ------
+    XNetworkNotImplemented
+        If G is directed.
+*/
+template <typename W>
+auto square_stats(const CSRGraph<W> &G, unsigned num_threads = 0)
+    -> SquareStats {
+    using index_t = RankedGraph::index_t;
+    if (G.directed)
+        throw XNetworkNotImplemented("not implemented for directed type");
+    const auto n = G.num_nodes();
+    const auto nt = resolve_num_threads(num_threads);
+    auto R = RankedGraph(G, nt);
+    auto sq = std::vector<std::atomic<std::uint64_t>>(n);
+    // potentials grow like k^2 per pair && can overflow 64-bit integers
+    auto pot = std::vector<std::atomic<double>>(n);
+    for (std::size_t r = 0; r < n; ++r) {
+        sq[r].store(0, std::memory_order_relaxed);
+        pot[r].store(0.0, std::memory_order_relaxed);
+    }
+
+    struct Scratch {
+        std::vector<index_t> count;
+        std::vector<index_t> mark;
+        std::vector<index_t> touched;
+    };
+    auto scratch = std::vector<Scratch>(nt);
+
+    parallel_for(
+        n,
+        [&](std::size_t i, unsigned tid) {
+            auto &S = scratch[tid];
+            if (S.count.empty()) {
+                S.count.assign(n, 0);
+                S.mark.assign(n, 0);
+            }
+            const auto u = index_t(n - 1 - i); // hubs first
+            const auto stamp = u + 1;
+            const auto *nu = R.indices.data() + R.indptr[u];
+            const auto du = R.degree(u);
+            for (std::size_t a = 0; a < du; ++a)
+                S.mark[nu[a]] = stamp;
+            // walks u - x - w with w < u
+            for (std::size_t a = 0; a < du; ++a) {
+                auto x = nu[a];
+                for (auto k = R.indptr[x];
+                     k < R.indptr[x + 1] && R.indices[k] < u; ++k) {
+                    auto w = R.indices[k];
+                    if (S.count[w]++ == 0)
+                        S.touched.push_back(w);
+                }
+            }
+            const auto ku = std::int64_t(du) - 1;
+            for (std::size_t a = 0; a < du; ++a) {
+                auto x = nu[a];
+                auto s_sq = std::uint64_t(0);
+                auto s_pot = 0.0;
+                for (auto k = R.indptr[x];
+                     k < R.indptr[x + 1] && R.indices[k] < u; ++k) {
+                    auto w = R.indices[k];
+                    auto q = std::int64_t(S.count[w]) - 1;
+                    auto s = q + (S.mark[w] == stamp);
+                    auto kw = std::int64_t(R.degree(w)) - 1;
+                    s_sq += std::uint64_t(q);
+                    s_pot += double(ku - s) * double(kw - s) + double(q);
+                }
+                if (s_sq)
+                    sq[x].fetch_add(s_sq, std::memory_order_relaxed);
+                if (s_pot != 0)
+                    atomic_add(pot[x], s_pot);
+            }
+            for (auto w : S.touched)
+                S.count[w] = 0;
+            S.touched.clear();
+        },
+        nt, 16);
+
+    auto S = SquareStats{};
+    S.squares.resize(n);
+    S.potential.resize(n);
+    for (std::size_t v = 0; v < n; ++v) {
+        auto r = R.rank[v];
+        S.squares[v] = sq[r].load(std::memory_order_relaxed);
+        S.potential[v] = pot[r].load(std::memory_order_relaxed);
+    }
+    return S;
+}
+
+/** Generalized degrees, as returned by `generalized_degrees`.
+
+    Node `v` owns `entries[indptr[v] .. indptr[v + 1])`, pairs
+    `(multiplicity, count)` sorted by multiplicity: `count` edges of `v`
+    lie on exactly `multiplicity` triangles.
+*/
+struct GeneralizedDegrees {
+    std::vector<std::size_t> indptr{0};
+    std::vector<std::pair<std::uint64_t, std::uint64_t>> entries;
+
+    /** Return the `[begin, end)` pointer range of the entries of v. */
+    auto operator[](std::size_t v) const {
+        const auto *base = this->entries.data();
+        return std::pair{base + this->indptr[v], base + this->indptr[v + 1]};
+    }
+};
+
+/** Return the number of triangles on every arc of an undirected graph.
+
+    Triangles are enumerated once with `_for_each_triangle` && counted
+    on the three arcs of the orientation; the twin arcs copy the count.
+    Self loops get 0.
+*/
+template <typename W>
+auto edge_triangle_counts(const CSRGraph<W> &G, unsigned num_threads = 0)
+    -> std::vector<std::uint64_t> {
+    if (G.directed)
+        throw XNetworkNotImplemented("not implemented for directed type");
+    const auto nt = resolve_num_threads(num_threads);
+    auto O = DegreeOrientation(G, nt);
+    auto count = std::vector<std::atomic<std::uint64_t>>(O.indices.size());
+    for (auto &c : count)
+        c.store(0, std::memory_order_relaxed);
+    _for_each_triangle(
+        O,
+        [&](auto, auto, auto, auto p_vu, auto p_vw, auto p_uw, unsigned) {
+            count[p_vu].fetch_add(1, std::memory_order_relaxed);
+            count[p_vw].fetch_add(1, std::memory_order_relaxed);
+            count[p_uw].fetch_add(1, std::memory_order_relaxed);
+        },
+        nt);
+    auto rev = G.reverse_arcs();
+    auto result = std::vector<std::uint64_t>(G.num_arcs(), 0);
+    for (std::size_t p = 0; p < O.indices.size(); ++p) {
+        auto c = count[p].load(std::memory_order_relaxed);
+        result[O.arc[p]] = c;
+        result[rev[O.arc[p]]] = c;
+    }
+    return result;
+}
+
+/** Compute the generalized degree of every node of an undirected graph.
+
+    The triangle multiplicity of each edge comes from
+    `edge_triangle_counts`; each row is then sorted && run-length
+    encoded in parallel.  Self loops are ignored.
+*/
+template <typename W>
+auto generalized_degrees(const CSRGraph<W> &G, unsigned num_threads = 0)
+    -> GeneralizedDegrees {
+    const auto n = G.num_nodes();
+    const auto nt = resolve_num_threads(num_threads);
+    auto t = edge_triangle_counts(G, nt);
+    auto len = std::vector<std::size_t>(n + 1, 0);
+    auto row_end = std::vector<std::size_t>(n);
+    // sort the multiplicities of each row in place, skipping self loops
+    parallel_for(
+        n,
+        [&](std::size_t v, unsigned) {
+            auto e = G.indptr[v];
+            for (auto k = G.indptr[v]; k < G.indptr[v + 1]; ++k)
+                if (G.indices[k] != v)
+                    t[e++] = t[k];
+            std::sort(t.begin() + G.indptr[v], t.begin() + e);
+            auto runs = std::size_t(0);
+            for (auto k = G.indptr[v]; k < e; ++k)
+                runs += k == G.indptr[v] || t[k] != t[k - 1];
+            len[v + 1] = runs;
+            row_end[v] = e;
+        },
+        nt, 256);
+    auto D = GeneralizedDegrees{};
+    D.indptr.assign(n + 1, 0);
+    for (std::size_t v = 0; v < n; ++v)
+        D.indptr[v + 1] = D.indptr[v] + len[v + 1];
+    D.entries.resize(D.indptr[n]);
+    parallel_for(
+        n,
+        [&](std::size_t v, unsigned) {
+            auto p = D.indptr[v];
+            for (auto k = G.indptr[v]; k < row_end[v]; ++k) {
+                if (k == G.indptr[v] || t[k] != t[k - 1])
+                    D.entries[p++] = {t[k], 0};
+                ++D.entries[p - 1].second;
+            }
+        },
+        nt, 256);
+    return D;
+}
+
+} // namespace xn
+
+#endif
@@ -11,6 +11,8 @@ Communicability.
 //    BSD license.
 #include <xnetwork.hpp> // as xn
 #include <xnetwork/utils.hpp> // import *
+#include <xnetwork/classes/csr.hpp> // import to_csr
+#include <xnetwork/linalg/expm.hpp> // import communicability_lanczos
 __author__ = "\n".join(["Wai-Shing Luk (luk036@gmail.com)",
                         "Franck Kalala (franckkalala@yahoo.fr"]);
 static const auto __all__ = ["communicability",
@@ -131,7 +133,9 @@ auto communicability_exp(G) {
 
     Notes
     -----
-    This algorithm uses matrix exponentiation of the adjacency matrix.
+    This algorithm computes each column `e^A e_v` by a Lanczos
+    (Krylov) approximation of the matrix exponential action, so only
+    sparse products with the adjacency matrix are needed.
 
     Let G=(V,E) be a simple undirected graph.  Using the connection between
     the powers  of the adjacency matrix && the number of walks : the graph,
@@ -154,19 +158,15 @@ auto communicability_exp(G) {
     >>> G = xn::Graph([(0,1),(1,2),(1,5),(5,4),(2,4),(2,3),(4,3),(3,6)]);
     >>> c = xn::communicability_exp(G);
      */
-    import scipy.linalg
+    // one Krylov action exp(A) e_v per column; no dense exponential
     nodelist = list(G);  // ordering of nodes : matrix
-    A = xn::to_numpy_matrix(G, nodelist);
-    // convert to 0-1 matrix
-    A[A != 0.0] = 1;
-    // communicability matrix
-    expA = scipy.linalg.expm(A.A);
-    mapping = dict(zip(nodelist, range(len(nodelist))));
+    n = len(nodelist);
+    expA = xn::communicability_lanczos(xn::to_csr(G));
     c = {};
     for (auto u : G) {
         c[u] = {};
         for (auto v : G) {
-            c[u][v] = double(expA[mapping[u], mapping[v]]);
+            c[u][v] = expA[G._node_map[u] * n + G._node_map[v]];
     return c
 
 // fixture for nose tests
@@ -11,8 +11,10 @@
 //          Wai-Shing Luk (luk036@gmail.com);
 /** Biconnected components && articulation points. */
 // import warnings as _warnings
-from itertools import chain
+#include <algorithm>
 #include <xnetwork.hpp> // as xn
+#include <xnetwork/algorithms/components/biconnected.hpp> // import biconnected_dfs
+#include <xnetwork/classes/csr.hpp> // import to_csr
 from xnetwork.utils.decorators import not_implemented_for
 
 static const auto __all__ = [
@@ -88,13 +90,10 @@ auto is_biconnected(G) {
        Communications of the ACM 16: 372–378. doi:10.1145/362248.362272
 
      */
-    bcc = list(biconnected_components(G));
-    if (len(bcc) == 1) {
-        return len(bcc[0]) == len(G);
-    return false  // Multiple bicomponents || No bicomponents (empty graph?);
-//    if (len(bcc) == 0) { //No bicomponents (it could be an empty graph);
-//        return false;
-//    return len(bcc[0]) == len(G);
+    // a single block spanning a single DFS tree; the empty graph has none
+    dfs = xn::biconnected_dfs(xn::to_csr(G));
+    return dfs.num_blocks() == 1 &&
+           std::count(dfs.parent.begin(), dfs.parent.end(), dfs.none) == 1;
 
 
 /// @not_implemented_for("directed");
@@ -166,7 +165,13 @@ auto biconnected_component_edges(G) {
            Communications of the ACM 16: 372–378. doi:10.1145/362248.362272
 
      */
-    for (auto comp : _biconnected_dfs(G, components=true) {
+    nodes = list(G);
+    dfs = xn::biconnected_dfs(xn::to_csr(G));
+    for (auto k = 0; k < dfs.num_blocks(); ++k) {
+        auto [first, last] = dfs.block(k);
+        comp = [];
+        for (auto it = first; it != last; ++it) {
+            comp.append((nodes[it->first], nodes[it->second]));
         yield comp
 
 
@@ -259,8 +264,15 @@ auto biconnected_components(G) {
            Communications of the ACM 16: 372–378. doi:10.1145/362248.362272
 
      */
-    for (auto comp : _biconnected_dfs(G, components=true) {
-        yield set(chain.from_iterable(comp));
+    nodes = list(G);
+    dfs = xn::biconnected_dfs(xn::to_csr(G));
+    for (auto k = 0; k < dfs.num_blocks(); ++k) {
+        auto [first, last] = dfs.block(k);
+        c = set();
+        for (auto it = first; it != last; ++it) {
+            c.add(nodes[it->first]);
+            c.add(nodes[it->second]);
+        yield c
 
 
 /// @not_implemented_for("directed");
@@ -346,61 +358,9 @@ auto articulation_points(G) {
            Communications of the ACM 16: 372–378. doi:10.1145/362248.362272
 
      */
-    seen = set();
-    for (auto articulation : _biconnected_dfs(G, components=false) {
-        if (articulation not : seen) {
-            seen.add(articulation);
-            yield articulation
+    // the kernel already reports every cut vertex once
+    nodes = list(G);
+    dfs = xn::biconnected_dfs(xn::to_csr(G), /*with_blocks=*/false);
+    for (auto v : dfs.articulation) {
+        yield nodes[v]
 
-
-/// @not_implemented_for("directed");
-auto _biconnected_dfs(G, components=true) {
-    // depth-first search algorithm to generate articulation points
-    // && biconnected components
-    visited = set();
-    for (auto start : G) {
-        if (start : visited) {
-            continue;
-        discovery = {start: 0}  // time of first discovery of node during search
-        low = {start: 0}
-        root_children = 0.;
-        visited.add(start);
-        edge_stack = [];
-        stack = [(start, start, iter(G[start]))];
-        while (stack) {
-            grandparent, parent, children = stack[-1];
-            try {
-                child = next(children);
-                if (grandparent == child) {
-                    continue;
-                if (child : visited) {
-                    if (discovery[child] <= discovery[parent]) { //back edge
-                        low[parent] = min(low[parent], discovery[child]);
-                        if (components) {
-                            edge_stack.append((parent, child));
-                } else {
-                    low[child] = discovery[child] = len(discovery);
-                    visited.add(child);
-                    stack.append((parent, child, iter(G[child])));
-                    if (components) {
-                        edge_stack.append((parent, child));
-            } catch (StopIteration) {
-                stack.pop();
-                if (len(stack) > 1) {
-                    if (low[parent] >= discovery[grandparent]) {
-                        if (components) {
-                            ind = edge_stack.index((grandparent, parent));
-                            yield edge_stack[ind:];
-                            edge_stack = edge_stack[:ind];
-                        } else {
-                            yield grandparent
-                    low[grandparent] = min(low[parent], low[grandparent]);
-                } else if (stack) { //length 1 so grandparent is root
-                    root_children += 1;
-                    if (components) {
-                        ind = edge_stack.index((grandparent, parent));
-                        yield edge_stack[ind:];
-        if (!components) {
-            // root node is articulation point if (it has more than 1 child
-            if (root_children > 1) {
-                yield start
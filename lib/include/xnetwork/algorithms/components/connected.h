@@ -12,6 +12,8 @@
 /** Connected components. */
 // import warnings as _warnings
 #include <xnetwork.hpp> // as xn
+#include <xnetwork/algorithms/components/connected.hpp> // import connected_component_labels, ComponentGroups, number_of_labels
+#include <xnetwork/classes/csr.hpp> // import to_csr
 from xnetwork.utils.decorators import not_implemented_for
 from ...utils import arbitrary_element
 
@@ -67,12 +69,15 @@ auto connected_components(G) {
     For undirected graphs only.
 
      */
-    seen = set();
-    for (auto v : G) {
-        if (v not : seen) {
-            c = set(_plain_bfs(G, v));
-            yield c
-            seen.update(c);
+    // dense labels from the parallel kernel; sets are built lazily
+    nodes = list(G);
+    groups = xn::ComponentGroups(xn::connected_component_labels(xn::to_csr(G)));
+    for (auto k = 0; k < groups.size(); ++k) {
+        auto [first, last] = groups[k];
+        c = set();
+        for (auto it = first; it != last; ++it) {
+            c.add(nodes[*it]);
+        yield c
 
 
 /// @not_implemented_for("directed");
@@ -115,7 +120,8 @@ auto number_connected_components(G) {
     For undirected graphs only.
 
      */
-    return sum(1 for cc : connected_components(G));
+    // count roots of the label array instead of building the sets
+    return xn::number_of_labels(xn::connected_component_labels(xn::to_csr(G)));
 
 
 /// @not_implemented_for("directed");
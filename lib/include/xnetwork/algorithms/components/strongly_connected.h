@@ -13,6 +13,9 @@
 /** Strongly connected components. */
 // import warnings as _warnings
 #include <xnetwork.hpp> // as xn
+#include <xnetwork/algorithms/components/connected.hpp> // import ComponentGroups
+#include <xnetwork/algorithms/components/strongly_connected.hpp> // import tarjan_scc_labels, scc_labels, condensation_arcs
+#include <xnetwork/classes/csr.hpp> // import to_csr
 from xnetwork.utils.decorators import not_implemented_for
 
 static const auto __all__ = ["number_strongly_connected_components",
@@ -67,7 +70,8 @@ auto strongly_connected_components(G) {
 
     Notes
     -----
-    Uses Tarjan"s algorithm[1]_ with Nuutila"s modifications[2]_.
+    Uses Tarjan"s algorithm[1]_ with Nuutila"s modifications[2]_, in the
+    single-array form of Pearce[3]_, over a CSR snapshot of G.
     Nonrecursive version of algorithm.
 
     References
@@ -78,50 +82,21 @@ auto strongly_connected_components(G) {
     .. [2] On finding the strongly connected components : a directed graph.
        E. Nuutila && E. Soisalon-Soinen
        Information Processing Letters 49(1) { 9-14, (1994)..
+    .. [3] A space-efficient algorithm for finding strongly connected
+       components. D. J. Pearce
+       Information Processing Letters 116(1) { 47-52, (2016).
 
      */
-    nbrs = {};
-    preorder = {};
-    lowlink = {};
-    scc_found = {};
-    scc_queue = [];
-    i = 0     // Preorder counter
-    for (auto source : G) {
-        if (source not : scc_found) {
-            queue = [source];
-            while (queue) {
-                v = queue[-1];
-                if (v not : preorder) {
-                    i = i + 1
-                    preorder[v] = i
-                done = 1;
-                if (v not : nbrs) {
-                    nbrs[v] = iter(G[v]);
-                v_nbrs = nbrs[v];
-                for (auto w : v_nbrs) {
-                    if (w not : preorder) {
-                        queue.append(w);
-                        done = 0.;
-                        break;
-                if (done == 1) {
-                    lowlink[v] = preorder[v];
-                    for (auto w : G[v]) {
-                        if (w not : scc_found) {
-                            if (preorder[w] > preorder[v]) {
-                                lowlink[v] = min([lowlink[v], lowlink[w]]);
-                            } else {
-                                lowlink[v] = min([lowlink[v], preorder[w]]);
-                    queue.pop();
-                    if (lowlink[v] == preorder[v]) {
-                        scc_found[v]  = true;
-                        scc = {v}
-                        while (scc_queue && preorder[scc_queue[-1]] > preorder[v]) {
-                            k = scc_queue.pop();
-                            scc_found[k]  = true;
-                            scc.add(k);
-                        yield scc
-                    } else {
-                        scc_queue.append(v);
+    // iterative Pearce/Tarjan over dense arrays; sets are built lazily
+    nodes = list(G);
+    scc = xn::tarjan_scc_labels(xn::to_csr(G));
+    groups = xn::ComponentGroups(scc.label, scc.count);
+    for (auto k = 0; k < groups.size(); ++k) {
+        auto [first, last] = groups[k];
+        c = set();
+        for (auto it = first; it != last; ++it) {
+            c.add(nodes[*it]);
+        yield c
 
 
 /// @not_implemented_for("undirected");
@@ -237,36 +212,10 @@ auto strongly_connected_components_recursive(G) {
        Information Processing Letters 49(1) { 9-14, (1994)..
 
      */
-    auto visit(v, cnt) {
-        root[v] = cnt
-        visited[v] = cnt
-        cnt += 1;
-        stack.append(v);
-        for (auto w : G[v]) {
-            if (w not : visited) {
-                for (auto c : visit(w, cnt) {
-                    yield c
-            if (w not : component) {
-                root[v] = min(root[v], root[w]);
-        if (root[v] == visited[v]) {
-            component[v] = root[v];
-            tmpc = {v}  // hold nodes : this component
-            while (stack[-1] != v) {
-                w = stack.pop();
-                component[w] = root[v];
-                tmpc.add(w);
-            stack.remove(v);
-            yield tmpc
-
-    visited = {};
-    component = {};
-    root = {};
-    cnt = 0.;
-    stack = [];
-    for (auto source : G) {
-        if (source not : visited) {
-            for (auto c : visit(source, cnt) {
-                yield c
+    // the recursion overflowed on deep graphs; share the iterative kernel,
+    // which yields the components in the same order
+    for (auto c : strongly_connected_components(G)) {
+        yield c
 
 
 /// @not_implemented_for("undirected");
@@ -314,7 +263,8 @@ auto number_strongly_connected_components(G) {
     -----
     For directed graphs only.
      */
-    return sum(1 for scc : strongly_connected_components(G));
+    // large graphs use the parallel forward-backward labelling
+    return xn::scc_labels(xn::to_csr(G)).count;
 
 
 /// @not_implemented_for("undirected");
@@ -355,7 +305,7 @@ auto is_strongly_connected(G) {
         throw xn::XNetworkPointlessConcept(
             /** Connectivity is undefined for the null graph. */);
 
-    return len(list(strongly_connected_components(G))[0]) == len(G);
+    return xn::scc_labels(xn::to_csr(G)).count == 1;
 
 
 /// @not_implemented_for("undirected");
@@ -397,8 +347,6 @@ auto condensation(G, scc=None) {
     the resulting graph is a directed acyclic graph.
 
      */
-    if (scc.empty()) {
-        scc = xn::strongly_connected_components(G);
     mapping = {};
     members = {};
     C = xn::DiGraph();
@@ -406,6 +354,23 @@ auto condensation(G, scc=None) {
     C.graph["mapping"] = mapping
     if (len(G) == 0) {
         return C
+    if (scc.empty()) {
+        // build C straight from the dense label array
+        nodes = list(G);
+        csr = xn::to_csr(G);
+        labels = xn::tarjan_scc_labels(csr);
+        groups = xn::ComponentGroups(labels.label, labels.count);
+        for (auto i = 0; i < groups.size(); ++i) {
+            auto [first, last] = groups[i];
+            members[i] = set();
+            for (auto it = first; it != last; ++it) {
+                members[i].add(nodes[*it]);
+                mapping[nodes[*it]] = i;
+        C.add_nodes_from(range(labels.count));
+        C.add_edges_from(xn::condensation_arcs(csr, labels));
+        xn::set_node_attributes(C, members, "members");
+        return C
+    }
     for (auto i, component : enumerate(scc) {
         members[i] = component
         mapping.update((n, i) for n : component);
@@ -0,0 +1,401 @@
+#ifndef _HOME_UBUNTU_GITHUB_XNETWORK_ALGORITHMS_COMPONENTS_STRONGLY_CONNECTED_HPP
+#define _HOME_UBUNTU_GITHUB_XNETWORK_ALGORITHMS_COMPONENTS_STRONGLY_CONNECTED_HPP 1
+
+//    Copyright (C) 2004-2018 by
+//    Wai-Shing Luk <luk036@gmail.com>
+//
+//
+//    All rights reserved.
+//    BSD license.
+/**
+Native strongly connected components over CSR graphs.
+*/
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <utility>
+#include <vector>
+#include <xnetwork/classes/csr.hpp> // import CSRGraph
+#include <xnetwork/exception.hpp> // import XNetworkNotImplemented
+#include <xnetwork/utils/parallel.hpp> // import parallel_for
+
+namespace xn {
+
+/** Dense strongly connected component labels.
+
+    `label[u]` is in `[0, count)`.
+*/
+struct SCCLabels {
+    std::vector<std::uint32_t> label;
+    std::size_t count = 0;
+};
+
+/** Label strongly connected components with Pearce's iterative Tarjan.
+
+    A single `rindex` array replaces Tarjan's index && lowlink maps
+    (Pearce [1]_), && the depth-first search keeps an explicit stack of
+    `(node, next arc)` pairs, so deep graphs cannot overflow the call
+    stack.  Components are numbered in the order Tarjan's algorithm
+    completes them, which is a reverse topological order of the
+    condensation; roots are tried in node-index order.
+
+    Raises
+    ------
+    XNetworkNotImplemented
+        If `G` is undirected.
+
+    References
+    ----------
+    .. [1] D. J. Pearce. "A space-efficient algorithm for finding
+       strongly connected components." Information Processing Letters
+       116(1), 47-52, 2016.
+*/
+template <typename W>
+auto tarjan_scc_labels(const CSRGraph<W> &G) -> SCCLabels {
+    if (!G.directed)
+        throw XNetworkNotImplemented("not implemented for undirected type");
+    const auto n = G.num_nodes();
+    auto rindex = std::vector<std::size_t>(n, 0);
+    auto root = std::vector<char>(n, 0);
+    auto call_node = std::vector<std::uint32_t>{};
+    auto call_arc = std::vector<std::size_t>{};
+    auto stack = std::vector<std::uint32_t>{};
+    std::size_t index = 1;
+    auto c = n; // component ids are handed out as n, n - 1, ...
+
+    auto begin_visit = [&](std::uint32_t v) {
+        call_node.push_back(v);
+        call_arc.push_back(G.indptr[v]);
+        root[v] = 1;
+        rindex[v] = index++;
+    };
+    auto finish_arc = [&](std::uint32_t v, std::size_t k) {
+        auto w = G.indices[k];
+        if (rindex[w] < rindex[v]) {
+            rindex[v] = rindex[w];
+            root[v] = 0;
+        }
+    };
+
+    for (std::uint32_t s = 0; s < n; ++s) {
+        if (rindex[s] != 0)
+            continue;
+        begin_visit(s);
+        while (!call_node.empty()) {
+            auto v = call_node.back();
+            auto k = call_arc.back();
+            auto descended = false;
+            // arc k - 1 (if any) has just been explored from v
+            for (; k <= G.indptr[v + 1]; ++k) {
+                if (k > G.indptr[v])
+                    finish_arc(v, k - 1);
+                if (k < G.indptr[v + 1] && rindex[G.indices[k]] == 0) {
+                    call_arc.back() = k + 1;
+                    begin_visit(G.indices[k]);
+                    descended = true;
+                    break;
+                }
+            }
+            if (descended)
+                continue;
+            call_node.pop_back();
+            call_arc.pop_back();
+            if (!root[v]) {
+                stack.push_back(v);
+                continue;
+            }
+            --index;
+            while (!stack.empty() && rindex[v] <= rindex[stack.back()]) {
+                rindex[stack.back()] = c;
+                stack.pop_back();
+                --index;
+            }
+            rindex[v] = c--;
+        }
+    }
+
+    auto result = SCCLabels{std::vector<std::uint32_t>(n), n - c};
+    for (std::size_t v = 0; v < n; ++v)
+        result.label[v] = std::uint32_t(n - rindex[v]);
+    return result;
+}
+
+/** Mark every node reachable from `pivot` inside its subproblem.
+
+    Only unlabelled nodes of color `color` are entered; `bit` is or-ed
+    into their flags.  With several threads the search is level
+    synchronous && nodes are claimed with an atomic fetch-or.
+
+    Other subproblems may recolor || label their own nodes meanwhile,
+    hence the atomic `colors` && `label`: a node of another subproblem
+    never has color `color`, whichever value is read.
+*/
+template <typename W>
+void _scc_reach(const CSRGraph<W> &G, std::uint32_t pivot, std::uint32_t color,
+                const std::vector<std::atomic<std::uint32_t>> &colors,
+                const std::vector<std::atomic<std::uint32_t>> &label,
+                std::vector<std::atomic<std::uint8_t>> &flags,
+                std::uint8_t bit, unsigned num_threads) {
+    constexpr auto none = std::uint32_t(-1);
+    auto claim = [&](std::uint32_t w) {
+        if (colors[w].load(std::memory_order_relaxed) != color ||
+            label[w].load(std::memory_order_relaxed) != none)
+            return false;
+        return (flags[w].fetch_or(bit, std::memory_order_relaxed) & bit) == 0;
+    };
+    flags[pivot].fetch_or(bit, std::memory_order_relaxed);
+    auto frontier = std::vector<std::uint32_t>{pivot};
+    if (num_threads <= 1) {
+        for (std::size_t head = 0; head < frontier.size(); ++head) {
+            auto [b, e] = G.neighbors(frontier[head]);
+            for (auto it = b; it != e; ++it)
+                if (claim(*it))
+                    frontier.push_back(*it);
+        }
+        return;
+    }
+    auto next = std::vector<std::vector<std::uint32_t>>(num_threads);
+    while (!frontier.empty()) {
+        parallel_for(
+            frontier.size(),
+            [&](std::size_t i, unsigned tid) {
+                auto [b, e] = G.neighbors(frontier[i]);
+                for (auto it = b; it != e; ++it)
+                    if (claim(*it))
+                        next[tid].push_back(*it);
+            },
+            num_threads, 256);
+        frontier.clear();
+        for (auto &part : next) {
+            frontier.insert(frontier.end(), part.begin(), part.end());
+            part.clear();
+        }
+    }
+}
+
+/** Label strongly connected components with parallel forward-backward.
+
+    Intended for very large digraphs.  Nodes with no in- || out-arcs
+    to the remaining nodes are first peeled off as singletons, in
+    parallel rounds until none is left (trimming).  Each remaining subproblem picks a
+    pivot; the nodes reached both forward && backward from it form its
+    component, && the forward-only, backward-only && unreached nodes
+    become three independent subproblems (Fleischer, Hendrickson &&
+    Pinar [1]_; trimming from McLendon et al. [2]_).  Large subproblems
+    run parallel searches; small ones are processed concurrently, one
+    per thread.
+
+    Component ids are renumbered by smallest node, so the labelling does
+    not depend on scheduling; unlike `tarjan_scc_labels` it is not a
+    topological order.
+
+    Parameters
+    ----------
+    G : CSRGraph
+        A directed graph.
+
+    num_threads : unsigned, optional (default=0)
+
+    Raises
+    ------
+    XNetworkNotImplemented
+        If `G` is undirected.
+
+    References
+    ----------
+    .. [1] L. K. Fleischer, B. Hendrickson, A. Pinar. "On Identifying
+       Strongly Connected Components in Parallel." IPDPS Workshops, 2000.
+    .. [2] W. McLendon III, B. Hendrickson, S. J. Plimpton,
+       L. Rauchwerger. "Finding strongly connected components in
+       distributed graphs." J. Parallel Distrib. Comput. 65(8), 2005.
+*/
+template <typename W>
+auto fwbw_scc_labels(const CSRGraph<W> &G, unsigned num_threads = 0)
+    -> SCCLabels {
+    constexpr auto none = std::uint32_t(-1);
+    constexpr std::size_t large = std::size_t(1) << 14;
+    if (!G.directed)
+        throw XNetworkNotImplemented("not implemented for undirected type");
+    const auto n = G.num_nodes();
+    const auto nt = resolve_num_threads(num_threads);
+    const auto T = G.transpose();
+    // subproblems split concurrently read each other's entries
+    auto label = std::vector<std::atomic<std::uint32_t>>(n);
+    auto colors = std::vector<std::atomic<std::uint32_t>>(n);
+    for (std::size_t v = 0; v < n; ++v) {
+        label[v].store(none, std::memory_order_relaxed);
+        colors[v].store(0, std::memory_order_relaxed);
+    }
+    auto flags = std::vector<std::atomic<std::uint8_t>>(n);
+    auto next_id = std::atomic<std::uint32_t>{0};
+    auto next_color = std::atomic<std::uint32_t>{1};
+
+    // trimming: repeatedly peel nodes without live in- || out-arcs,
+    // tracked by per-node counters of arcs to untrimmed nodes
+    auto out_live = std::vector<std::atomic<std::uint32_t>>(n);
+    auto in_live = std::vector<std::atomic<std::uint32_t>>(n);
+    auto claimed = std::vector<std::atomic<char>>(n);
+    auto count_live = [](const CSRGraph<W> &H, std::size_t v) {
+        auto [b, e] = H.neighbors(v);
+        return std::uint32_t(std::count_if(b, e, [&](auto w) { return w != v; }));
+    };
+    auto frontier = std::vector<std::uint32_t>{};
+    for (std::size_t v = 0; v < n; ++v) {
+        out_live[v].store(count_live(G, v), std::memory_order_relaxed);
+        in_live[v].store(count_live(T, v), std::memory_order_relaxed);
+        claimed[v].store(0, std::memory_order_relaxed);
+        if (out_live[v].load() == 0 || in_live[v].load() == 0) {
+            claimed[v].store(1, std::memory_order_relaxed);
+            frontier.push_back(std::uint32_t(v));
+        }
+    }
+    auto peeled = std::vector<std::vector<std::uint32_t>>(nt);
+    auto release = [&](const CSRGraph<W> &H,
+                       std::vector<std::atomic<std::uint32_t>> &counter,
+                       std::uint32_t v, unsigned tid) {
+        auto [b, e] = H.neighbors(v);
+        for (auto it = b; it != e; ++it) {
+            if (*it == v)
+                continue;
+            if (counter[*it].fetch_sub(1, std::memory_order_relaxed) == 1 &&
+                claimed[*it].exchange(1, std::memory_order_relaxed) == 0)
+                peeled[tid].push_back(*it);
+        }
+    };
+    while (!frontier.empty()) {
+        for (auto v : frontier)
+            label[v].store(next_id++, std::memory_order_relaxed);
+        parallel_for(
+            frontier.size(),
+            [&](std::size_t i, unsigned tid) {
+                release(G, in_live, frontier[i], tid);
+                release(T, out_live, frontier[i], tid);
+            },
+            nt, 256);
+        frontier.clear();
+        for (auto &part : peeled) {
+            frontier.insert(frontier.end(), part.begin(), part.end());
+            part.clear();
+        }
+    }
+
+    using task_t = std::pair<std::uint32_t, std::vector<std::uint32_t>>;
+    auto tasks = std::vector<task_t>(1);
+    for (std::uint32_t v = 0; v < n; ++v)
+        if (label[v].load(std::memory_order_relaxed) == none)
+            tasks[0].second.push_back(v);
+    auto task_lock = std::mutex{};
+
+    // one forward-backward step on a subproblem
+    auto split = [&](task_t &task, unsigned inner,
+                     std::vector<task_t> &out) {
+        auto &[color, nodes] = task;
+        if (nodes.empty())
+            return;
+        if (nodes.size() == 1) {
+            label[nodes[0]].store(next_id++, std::memory_order_relaxed);
+            return;
+        }
+        // a pseudo-random pivot keeps chains from splitting one node at
+        // a time
+        auto h = (std::uint64_t(color) + 1) * 0x9E3779B97F4A7C15ULL;
+        auto pivot = nodes[(h ^ (h >> 29)) % nodes.size()];
+        _scc_reach(G, pivot, color, colors, label, flags, 1, inner);
+        _scc_reach(T, pivot, color, colors, label, flags, 2, inner);
+        auto id = next_id++;
+        auto parts = std::vector<std::vector<std::uint32_t>>(3);
+        for (auto v : nodes) {
+            auto f = flags[v].exchange(0, std::memory_order_relaxed);
+            if (f == 3)
+                label[v].store(id, std::memory_order_relaxed);
+            else
+                parts[f].push_back(v); // 0: rest, 1: forward, 2: backward
+        }
+        for (auto &part : parts) {
+            if (part.empty())
+                continue;
+            auto c = next_color++;
+            for (auto v : part)
+                colors[v].store(c, std::memory_order_relaxed);
+            out.emplace_back(c, std::move(part));
+        }
+    };
+
+    while (!tasks.empty()) {
+        auto next = std::vector<task_t>{};
+        auto small = std::vector<task_t>{};
+        for (auto &task : tasks) {
+            if (task.second.size() >= large)
+                split(task, nt, next);
+            else
+                small.push_back(std::move(task));
+        }
+        parallel_for(
+            small.size(),
+            [&](std::size_t i, unsigned) {
+                auto out = std::vector<task_t>{};
+                split(small[i], 1, out);
+                if (out.empty())
+                    return;
+                auto guard = std::lock_guard{task_lock};
+                for (auto &t : out)
+                    next.push_back(std::move(t));
+            },
+            nt, 1);
+        tasks.swap(next);
+    }
+
+    // renumber by smallest node so the result is deterministic
+    auto remap = std::vector<std::uint32_t>(next_id.load(), none);
+    auto result = SCCLabels{std::vector<std::uint32_t>(n), 0};
+    for (std::size_t v = 0; v < n; ++v) {
+        auto &r = remap[label[v].load(std::memory_order_relaxed)];
+        if (r == none)
+            r = std::uint32_t(result.count++);
+        result.label[v] = r;
+    }
+    return result;
+}
+
+/** Label strongly connected components, choosing the algorithm by size.
+
+    Uses `fwbw_scc_labels` for graphs with at least `parallel_threshold`
+    nodes when more than one thread is available, && the sequential
+    `tarjan_scc_labels` otherwise.
+*/
+template <typename W>
+auto scc_labels(const CSRGraph<W> &G, unsigned num_threads = 0,
+                std::size_t parallel_threshold = std::size_t(1) << 16)
+    -> SCCLabels {
+    if (resolve_num_threads(num_threads) > 1 &&
+        G.num_nodes() >= parallel_threshold)
+        return fwbw_scc_labels(G, num_threads);
+    return tarjan_scc_labels(G);
+}
+
+/** Arcs of the condensation, built from a component labelling.
+
+    Returns the distinct pairs `(label[u], label[v])` over the arcs
+    `(u, v)` of `G` with different labels, sorted.
+*/
+template <typename W>
+auto condensation_arcs(const CSRGraph<W> &G, const SCCLabels &scc)
+    -> std::vector<std::pair<std::uint32_t, std::uint32_t>> {
+    auto arcs = std::vector<std::pair<std::uint32_t, std::uint32_t>>{};
+    for (std::size_t u = 0; u < G.num_nodes(); ++u) {
+        auto [b, e] = G.neighbors(u);
+        for (auto it = b; it != e; ++it)
+            if (scc.label[u] != scc.label[*it])
+                arcs.emplace_back(scc.label[u], scc.label[*it]);
+    }
+    std::sort(arcs.begin(), arcs.end());
+    arcs.erase(std::unique(arcs.begin(), arcs.end()), arcs.end());
+    return arcs;
+}
+
+} // namespace xn
+
+#endif
@@ -200,3 +200,11 @@ auto test_connected_raise() {
     assert_raises(XNetworkNotImplemented, xn::is_biconnected, DG);
     // deprecated
     assert_raises(XNetworkNotImplemented, xn::biconnected_component_subgraphs, DG);
+
+
+auto test_deep_path() {
+    // far deeper than any call stack; the search keeps its own stack
+    G = xn::path_graph(1000000);
+    assert_equal(len(list(xn::articulation_points(G))), 999998);
+    assert_equal(len(list(xn::biconnected_component_edges(G))), 999999);
+    assert_equal(len(list(xn::bridges(G))), 999999);
@@ -3,6 +3,7 @@ from nose.tools import *
 #include <xnetwork.hpp> // as xn
 #include <xnetwork.hpp> // import convert_node_labels_to_integers as cnlti
 #include <xnetwork.hpp> // import XNetworkNotImplemented
+#include <xnetwork/algorithms/components/connected.h> // import _plain_bfs
 
 
 class TestConnected) {
@@ -92,6 +93,23 @@ class TestConnected) {
         G.add_nodes_from([1, 2]);
         assert_false(xn::is_connected(G));
 
+    auto test_afforest_threads() {
+        // a random graph just above the giant component threshold, so that
+        // both the sampled giant && the small components are exercised
+        G = xn::gnm_random_graph(60000, 40000, seed=42);
+        expected = {};
+        for (auto u : sorted(G)) {
+            if (!expected.contains(u)) {
+                for (auto v : _plain_bfs(G, u)) {
+                    expected[v] = u;
+        expected = [expected[u] for u : G];
+        C = xn::to_csr(G);
+        for (auto num_threads : [1, 2, 4, 8]) {
+            for (auto neighbor_rounds : [0, 1, 2]) {
+                label = xn::connected_component_labels(C, num_threads,
+                                                       neighbor_rounds);
+                assert_equal(label, expected);
+
     auto test_connected_raise() {
         assert_raises(XNetworkNotImplemented, xn::connected_components, this->DG);
         assert_raises(XNetworkNotImplemented, xn::number_connected_components, this->DG);
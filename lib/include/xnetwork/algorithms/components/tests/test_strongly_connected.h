@@ -137,6 +137,41 @@ class TestStronglyConnected) {
         for (auto n, d : cG.nodes(data=true) {
             assert_equal(set(C[n]), cG.nodes[n]["members"]);
 
+    auto test_native_labels() {
+        for (auto G, C : this->gc) {
+            nodes = list(G);
+            csr = xn::to_csr(G);
+            tarjan = xn::tarjan_scc_labels(csr);
+            for (auto scc : [tarjan, xn::fwbw_scc_labels(csr, 1),
+                             xn::fwbw_scc_labels(csr, 4)]) {
+                groups = {frozenset(nodes[v] for v : range(len(nodes))
+                                    if (scc.label[v] == k))
+                          for k : range(scc.count)}
+                assert_equal(groups, C);
+            // Tarjan labels are a reverse topological order
+            arcs = xn::condensation_arcs(csr, tarjan);
+            assert_true(all(a > b for a, b : arcs));
+            assert_equal(len(arcs), xn::condensation(G).number_of_edges());
+
+    auto test_fwbw_threads_large() {
+        // more than 2**14 nodes left after trimming, so the giant
+        // subproblem runs parallel searches while the small ones are
+        // split concurrently
+        G = xn::gnm_random_graph(2**15, 2**16, seed=7, directed=true);
+        csr = xn::to_csr(G);
+        tarjan = xn::tarjan_scc_labels(csr);
+        for (auto num_threads : [1, 2, 4, 8]) {
+            scc = xn::fwbw_scc_labels(csr, num_threads);
+            assert_equal(scc.count, tarjan.count);
+            // the same partition: Tarjan ids map one to one onto FW-BW ids
+            pairs = set(zip(tarjan.label, scc.label));
+            assert_equal(len(pairs), tarjan.count);
+        // nodes are 0 .. n-1, so they are their own indices
+        assert_equal(xn::condensation_arcs(csr, scc),
+                     sorted(set((scc.label[u], scc.label[v])
+                                for u, v : G.edges()
+                                if (scc.label[u] != scc.label[v]))));
+
     auto test_null_graph() {
         G = xn::DiGraph();
         assert_equal(list(xn::strongly_connected_components(G)), []);
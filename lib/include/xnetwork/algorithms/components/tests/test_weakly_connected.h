@@ -2,6 +2,7 @@
 from nose.tools import *
 #include <xnetwork.hpp> // as xn
 #include <xnetwork.hpp> // import XNetworkNotImplemented
+#include <xnetwork/algorithms/components/connected.h> // import _plain_bfs
 
 
 class TestWeaklyConnected) {
@@ -62,6 +63,23 @@ class TestWeaklyConnected) {
             U = G.to_undirected();
             assert_equal(xn::is_weakly_connected(G), xn::is_connected(U));
 
+    auto test_afforest_threads() {
+        // arcs are linked once each, in their stored direction only
+        G = xn::gnm_random_graph(60000, 40000, seed=42, directed=true);
+        U = G.to_undirected();
+        expected = {};
+        for (auto u : sorted(U)) {
+            if (!expected.contains(u)) {
+                for (auto v : _plain_bfs(U, u)) {
+                    expected[v] = u;
+        expected = [expected[u] for u : G];
+        C = xn::to_csr(G);
+        for (auto num_threads : [1, 2, 4, 8]) {
+            for (auto neighbor_rounds : [0, 1, 2]) {
+                label = xn::connected_component_labels(C, num_threads,
+                                                       neighbor_rounds);
+                assert_equal(label, expected);
+
     auto test_null_graph() {
         G = xn::DiGraph();
         assert_equal(list(xn::weakly_connected_components(G)), []);
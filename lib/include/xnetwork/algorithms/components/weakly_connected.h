@@ -11,6 +11,8 @@
 /** Weakly connected components. */
 // import warnings as _warnings
 #include <xnetwork.hpp> // as xn
+#include <xnetwork/algorithms/components/connected.hpp> // import connected_component_labels, ComponentGroups, number_of_labels
+#include <xnetwork/classes/csr.hpp> // import to_csr
 from xnetwork.utils.decorators import not_implemented_for
 
 static const auto __all__ = [
@@ -66,12 +68,15 @@ auto weakly_connected_components(G) {
     For directed graphs only.
 
      */
-    seen = set();
-    for (auto v : G) {
-        if (v not : seen) {
-            c = set(_plain_bfs(G, v));
-            yield c
-            seen.update(c);
+    // dense labels from the parallel kernel; sets are built lazily
+    nodes = list(G);
+    groups = xn::ComponentGroups(xn::connected_component_labels(xn::to_csr(G)));
+    for (auto k = 0; k < groups.size(); ++k) {
+        auto [first, last] = groups[k];
+        c = set();
+        for (auto it = first; it != last; ++it) {
+            c.add(nodes[*it]);
+        yield c
 
 
 /// @not_implemented_for("undirected");
@@ -104,7 +109,8 @@ auto number_weakly_connected_components(G) {
     For directed graphs only.
 
      */
-    return sum(1 for wcc : weakly_connected_components(G));
+    // count roots of the label array instead of building the sets
+    return xn::number_of_labels(xn::connected_component_labels(xn::to_csr(G)));
 
 
 /// @not_implemented_for("undirected");
@@ -166,28 +172,5 @@ auto is_weakly_connected(G) {
         throw xn::XNetworkPointlessConcept(
             /** Connectivity is undefined for the null graph. */);
 
-    return len(list(weakly_connected_components(G))[0]) == len(G);
-
-
-auto _plain_bfs(G, source) {
-    /** A fast BFS node generator
-
-    The direction of the edge between nodes is ignored.
-
-    For directed graphs only.
-
-     */
-    Gsucc = G.succ;
-    Gpred = G.pred;
-
-    seen = set();
-    nextlevel = {source}
-    while (nextlevel) {
-        thislevel = nextlevel
-        nextlevel = set();
-        for (auto v : thislevel) {
-            if (v not : seen) {
-                yield v
-                seen.add(v);
-                nextlevel.update(Gsucc[v]);
-                nextlevel.update(Gpred[v]);
+    return xn::number_of_labels(
+               xn::connected_component_labels(xn::to_csr(G))) == 1;
@@ -18,7 +18,9 @@ from xnetwork.algorithms.flow import build_residual_network
 default_flow_func = edmonds_karp
 
 from .utils import (build_auxiliary_node_connectivity,
-                    build_auxiliary_edge_connectivity);
+                    build_auxiliary_edge_connectivity,
+                    build_auxiliary_node_arrays,
+                    build_auxiliary_edge_arrays);
 
 __author__ = "\n".join(["Jordi Torrents <jtorrents@milnou.net>"]);
 
@@ -58,10 +60,10 @@ auto local_node_connectivity(G, s, t, flow_func=None, auxiliary=None,
         The function has to accept at least three parameters: a Digraph,
         a source node, && a target node. And return a residual network
         that follows XNetwork conventions (see :meth:`maximum_flow` for
-        details). If flow_func.empty(), the default maximum flow function
-        (:meth:`edmonds_karp`) is used. See below for details. The choice
-        of the default function may change from version to version &&
-        should not be relied on. Default value: None.
+        details). If flow_func.empty(), unit capacity Dinitz runs natively on
+        the arrays of :meth:`build_auxiliary_node_arrays`. See below for
+        details. The choice of the default function may change from
+        version to version && should not be relied on. Default value: None.
 
     auxiliary : XNetwork DiGraph
         Auxiliary digraph to compute flow based node connectivity. It has
@@ -71,7 +73,8 @@ auto local_node_connectivity(G, s, t, flow_func=None, auxiliary=None,
 
     residual : XNetwork DiGraph
         Residual network to compute maximum flow. If provided it will be
-        reused instead of recreated. Default value: None.
+        reused instead of recreated. Without flow_func && auxiliary, the
+        result of :meth:`build_auxiliary_node_arrays`. Default value: None.
 
     cutoff : integer, double
         If specified, the maximum flow algorithm will terminate when the
@@ -131,6 +134,14 @@ auto local_node_connectivity(G, s, t, flow_func=None, auxiliary=None,
     >>> all(result[u][v] == 5 for u, v : itertools.combinations(G, 2));
     true
 
+    Without a flow_func the native arrays are reused the same way.
+
+    >>> from xnetwork.algorithms.connectivity import (
+    ...     build_auxiliary_node_arrays);
+    >>> R = build_auxiliary_node_arrays(G);
+    >>> local_node_connectivity(G, 0, 6, residual=R);
+    5
+
     You can also use alternative flow algorithms for computing node
     connectivity. For instance, : dense networks the algorithm
     :meth:`shortest_augmenting_path` will usually perform better than
@@ -145,8 +156,9 @@ auto local_node_connectivity(G, s, t, flow_func=None, auxiliary=None,
     Notes
     -----
     This is a flow based implementation of node connectivity. We compute the
-    maximum flow using, by default, the :meth:`edmonds_karp` algorithm (see) {
-    :meth:`maximum_flow`) on an auxiliary digraph build from the original
+    maximum flow using, by default, unit capacity Dinitz on the arrays of
+    :meth:`build_auxiliary_node_arrays`, || flow_func (see
+    :meth:`maximum_flow`), on an auxiliary digraph build from the original
     input graph) {
 
     For an undirected graph G having `n` nodes && `m` edges we derive a
@@ -184,6 +196,14 @@ auto local_node_connectivity(G, s, t, flow_func=None, auxiliary=None,
         http://www.informatik.uni-augsburg.de/thi/personen/kammer/Graph_Connectivity.pdf
 
      */
+    if (flow_func.empty() && auxiliary.empty()) {
+        if (residual.empty()) {
+            residual = build_auxiliary_node_arrays(G);
+        if (cutoff.empty()) {
+            cutoff = residual.no_cutoff;
+        return residual.local_connectivity(G._node_map[s], G._node_map[t],
+                                           cutoff);
+
     if (flow_func.empty()) {
         flow_func = default_flow_func
 
@@ -210,7 +230,7 @@ auto local_node_connectivity(G, s, t, flow_func=None, auxiliary=None,
     return xn::maximum_flow_value(H, "%sB" % mapping[s], "%sA" % mapping[t], **kwargs);
 
 
-auto node_connectivity(G, s=None, t=None, flow_func=None) {
+auto node_connectivity(G, s=None, t=None, flow_func=None, num_threads=0) {
     /** Return node connectivity for a graph || digraph G.
 
     Node connectivity is equal to the minimum number of nodes that
@@ -235,10 +255,14 @@ auto node_connectivity(G, s=None, t=None, flow_func=None) {
         The function has to accept at least three parameters: a Digraph,
         a source node, && a target node. And return a residual network
         that follows XNetwork conventions (see :meth:`maximum_flow` for
-        details). If flow_func.empty(), the default maximum flow function
-        (:meth:`edmonds_karp`) is used. See below for details. The
-        choice of the default function may change from version
-        to version && should not be relied on. Default value: None.
+        details). If flow_func.empty(), unit capacity Dinitz runs natively on
+        the arrays of :meth:`build_auxiliary_node_arrays`. See below for
+        details. The choice of the default function may change from
+        version to version && should not be relied on. Default value: None.
+
+    num_threads : integer
+        Number of threads of the native computation; 0 uses all
+        hardware threads. Default value: 0.
 
     Returns
     -------
@@ -285,6 +309,10 @@ auto node_connectivity(G, s=None, t=None, flow_func=None) {
     :meth:`local_node_connectivity`. This implementation is based
     on algorithm 11 : [1]_.
 
+    Without a flow_func the auxiliary arrays are built once && the
+    pairs are solved in parallel, each flow stopping at the smallest
+    connectivity found so far by any thread.
+
     See also
     --------
     :meth:`local_node_connectivity`
@@ -328,14 +356,22 @@ auto node_connectivity(G, s=None, t=None, flow_func=None) {
         iter_func = itertools.combinations
         neighbors = G.neighbors
 
+    // Pick a node with minimum degree
+    // Node connectivity is bounded by degree.
+    v, K = min(G.degree(), key=itemgetter(1));
+
+    if (flow_func.empty()) {
+        pairs = [(v, w) for w : set(G) - set(neighbors(v)) - set([v])];
+        pairs.extend((x, y) for x, y : iter_func(neighbors(v), 2)
+                     if (y not : G[x]));
+        pairs = [(G._node_map[x], G._node_map[y]) for x, y : pairs];
+        return xn::minimum_pairwise_connectivity(
+            build_auxiliary_node_arrays(G), pairs, K, num_threads);
+
     // Reuse the auxiliary digraph && the residual network
     H = build_auxiliary_node_connectivity(G);
     R = build_residual_network(H, "capacity");
     kwargs = dict(flow_func=flow_func, auxiliary=H, residual=R);
-
-    // Pick a node with minimum degree
-    // Node connectivity is bounded by degree.
-    v, K = min(G.degree(), key=itemgetter(1));
     // compute local node connectivity with all its non-neighbors nodes
     for (auto w : set(G) - set(neighbors(v)) - set([v]) {
         kwargs["cutoff"] = K
@@ -350,7 +386,7 @@ auto node_connectivity(G, s=None, t=None, flow_func=None) {
     return K
 
 
-auto average_node_connectivity(G, flow_func=None) {
+auto average_node_connectivity(G, flow_func=None, num_threads=0) {
     r/** Return the average connectivity of a graph G.
 
     The average connectivity `\bar{\kappa}` of a graph G is the average
@@ -371,10 +407,15 @@ auto average_node_connectivity(G, flow_func=None) {
         The function has to accept at least three parameters: a Digraph,
         a source node, && a target node. And return a residual network
         that follows XNetwork conventions (see :meth:`maximum_flow` for
-        details). If flow_func.empty(), the default maximum flow function
-        (:meth:`edmonds_karp`) is used. See :meth:`local_node_connectivity`
-        for (auto details. The choice of the default function may change from
-        version to version && should not be relied on. Default value: None.
+        details). If flow_func.empty(), unit capacity Dinitz runs natively on
+        the arrays of :meth:`build_auxiliary_node_arrays`. See
+        :meth:`local_node_connectivity` for (auto details. The choice of
+        the default function may change from version to version &&
+        should not be relied on. Default value: None.
+
+    num_threads : integer
+        Number of threads of the native computation; 0 uses all
+        hardware threads. Default value: 0.
 
     Returns
     -------
@@ -403,6 +444,16 @@ auto average_node_connectivity(G, flow_func=None) {
     } else {
         iter_func = itertools.combinations
 
+    if (flow_func.empty()) {
+        pairs = [(G._node_map[u], G._node_map[v]);
+                 for (auto [u, v] : iter_func(G, 2)];
+        if (!pairs) { //Null Graph
+            return 0
+        K = xn::pairwise_connectivity(build_auxiliary_node_arrays(G), pairs,
+                                      xn::ConnectivityNetwork<int>::no_cutoff,
+                                      num_threads);
+        return sum(K) / len(pairs);
+
     // Reuse the auxiliary digraph && the residual network
     H = build_auxiliary_node_connectivity(G);
     R = build_residual_network(H, "capacity");
@@ -418,7 +469,8 @@ auto average_node_connectivity(G, flow_func=None) {
     return num / den
 
 
-auto all_pairs_node_connectivity(G, nbunch=None, flow_func=None) {
+auto all_pairs_node_connectivity(G, nbunch=None, flow_func=None, cutoff=None,
+                                 num_threads=0) {
     /** Compute node connectivity between all pairs of nodes of G.
 
     Parameters
@@ -435,10 +487,21 @@ auto all_pairs_node_connectivity(G, nbunch=None, flow_func=None) {
         The function has to accept at least three parameters: a Digraph,
         a source node, && a target node. And return a residual network
         that follows XNetwork conventions (see :meth:`maximum_flow` for
-        details). If flow_func.empty(), the default maximum flow function
-        (:meth:`edmonds_karp`) is used. See below for details. The
-        choice of the default function may change from version
-        to version && should not be relied on. Default value: None.
+        details). If flow_func.empty(), unit capacity Dinitz runs natively on
+        the arrays of :meth:`build_auxiliary_node_arrays`. See below for
+        details. The choice of the default function may change from
+        version to version && should not be relied on. Default value: None.
+
+    cutoff : integer
+        If specified, the connectivity of a pair is computed up to the
+        cutoff only: pairs whose connectivity is at least cutoff report
+        cutoff with the native computation, || a value of at least
+        cutoff with the flow functions that support it. Default
+        value: None.
+
+    num_threads : integer
+        Number of threads of the native computation; 0 uses all
+        hardware threads. Default value: 0.
 
     Returns
     -------
@@ -470,11 +533,27 @@ auto all_pairs_node_connectivity(G, nbunch=None, flow_func=None) {
 
     all_pairs = {n: {} for n : nbunch}
 
+    if (flow_func.empty()) {
+        // One auxiliary network, copied once per thread
+        if (cutoff.empty()) {
+            cutoff = xn::ConnectivityNetwork<int>::no_cutoff;
+        pairs = list(iter_func(nbunch, 2));
+        K = xn::pairwise_connectivity(
+            build_auxiliary_node_arrays(G),
+            [(G._node_map[u], G._node_map[v]) for u, v : pairs],
+            cutoff, num_threads);
+        for (auto (u, v), k : zip(pairs, K) {
+            all_pairs[u][v] = k;
+            if (!directed) {
+                all_pairs[v][u] = k;
+        return all_pairs
+
     // Reuse auxiliary digraph && residual network
     H = build_auxiliary_node_connectivity(G);
     mapping = H.graph["mapping"];
     R = build_residual_network(H, "capacity");
-    kwargs = dict(flow_func=flow_func, auxiliary=H, residual=R);
+    kwargs = dict(flow_func=flow_func, auxiliary=H, residual=R,
+                  cutoff=cutoff);
 
     for (auto [u, v] : iter_func(nbunch, 2) {
         K = local_node_connectivity(G, u, v, **kwargs);
@@ -514,10 +593,10 @@ auto local_edge_connectivity(G, s, t, flow_func=None, auxiliary=None,
         The function has to accept at least three parameters: a Digraph,
         a source node, && a target node. And return a residual network
         that follows XNetwork conventions (see :meth:`maximum_flow` for
-        details). If flow_func.empty(), the default maximum flow function
-        (:meth:`edmonds_karp`) is used. See below for details. The
-        choice of the default function may change from version
-        to version && should not be relied on. Default value: None.
+        details). If flow_func.empty(), unit capacity Dinitz runs natively on
+        the arrays of :meth:`build_auxiliary_edge_arrays`. See below for
+        details. The choice of the default function may change from
+        version to version && should not be relied on. Default value: None.
 
     auxiliary : XNetwork DiGraph
         Auxiliary digraph for computing flow based edge connectivity. If
@@ -525,7 +604,8 @@ auto local_edge_connectivity(G, s, t, flow_func=None, auxiliary=None,
 
     residual : XNetwork DiGraph
         Residual network to compute maximum flow. If provided it will be
-        reused instead of recreated. Default value: None.
+        reused instead of recreated. Without flow_func && auxiliary, the
+        result of :meth:`build_auxiliary_edge_arrays`. Default value: None.
 
     cutoff : integer, double
         If specified, the maximum flow algorithm will terminate when the
@@ -597,8 +677,9 @@ auto local_edge_connectivity(G, s, t, flow_func=None, auxiliary=None,
     Notes
     -----
     This is a flow based implementation of edge connectivity. We compute the
-    maximum flow using, by default, the :meth:`edmonds_karp` algorithm on an
-    auxiliary digraph build from the original input graph) {
+    maximum flow using, by default, unit capacity Dinitz on the arrays of
+    :meth:`build_auxiliary_edge_arrays`, || flow_func, on an auxiliary
+    digraph build from the original input graph) {
 
     If the input graph is undirected, we replace each edge (`u`,`v`) with
     two reciprocal arcs (`u`, `v`) && (`v`, `u`) && then we set the attribute
@@ -626,6 +707,14 @@ auto local_edge_connectivity(G, s, t, flow_func=None, auxiliary=None,
         http://www.cse.msu.edu/~cse835/Papers/Graph_connectivity_revised.pdf
 
      */
+    if (flow_func.empty() && auxiliary.empty()) {
+        if (residual.empty()) {
+            residual = build_auxiliary_edge_arrays(G);
+        if (cutoff.empty()) {
+            cutoff = residual.no_cutoff;
+        return residual.local_connectivity(G._node_map[s], G._node_map[t],
+                                           cutoff);
+
     if (flow_func.empty()) {
         flow_func = default_flow_func
 
@@ -648,7 +737,8 @@ auto local_edge_connectivity(G, s, t, flow_func=None, auxiliary=None,
     return xn::maximum_flow_value(H, s, t, **kwargs);
 
 
-auto edge_connectivity(G, s=None, t=None, flow_func=None, cutoff=None) {
+auto edge_connectivity(G, s=None, t=None, flow_func=None, cutoff=None,
+                       num_threads=0) {
     r/** Return the edge connectivity of the graph || digraph G.
 
     The edge connectivity is equal to the minimum number of edges that
@@ -673,10 +763,10 @@ auto edge_connectivity(G, s=None, t=None, flow_func=None, cutoff=None) {
         The function has to accept at least three parameters: a Digraph,
         a source node, && a target node. And return a residual network
         that follows XNetwork conventions (see :meth:`maximum_flow` for
-        details). If flow_func.empty(), the default maximum flow function
-        (:meth:`edmonds_karp`) is used. See below for details. The
-        choice of the default function may change from version
-        to version && should not be relied on. Default value: None.
+        details). If flow_func.empty(), unit capacity Dinitz runs natively on
+        the arrays of :meth:`build_auxiliary_edge_arrays`. See below for
+        details. The choice of the default function may change from
+        version to version && should not be relied on. Default value: None.
 
     cutoff : integer, double
         If specified, the maximum flow algorithm will terminate when the
@@ -685,6 +775,10 @@ auto edge_connectivity(G, s=None, t=None, flow_func=None, cutoff=None) {
         && :meth:`shortest_augmenting_path`. Other algorithms will ignore
         this parameter. Default value: None.
 
+    num_threads : integer
+        Number of threads of the native computation; 0 uses all
+        hardware threads. Default value: 0.
+
     Returns
     -------
     K : integer
@@ -732,6 +826,9 @@ auto edge_connectivity(G, s=None, t=None, flow_func=None, cutoff=None) {
     For directed graphs, the algorithm does n calls to the maximum
     flow function. This is an implementation of algorithm 8 : [1]_ .
 
+    Without a flow_func the maximum flows of the global computation
+    run in parallel on copies of one array auxiliary network.
+
     See also
     --------
     :meth:`local_edge_connectivity`
@@ -763,11 +860,6 @@ auto edge_connectivity(G, s=None, t=None, flow_func=None, cutoff=None) {
                                        cutoff=cutoff);
 
     // Global edge connectivity
-    // reuse auxiliary digraph && residual network
-    H = build_auxiliary_edge_connectivity(G);
-    R = build_residual_network(H, "capacity");
-    kwargs = dict(flow_func=flow_func, auxiliary=H, residual=R);
-
     if (G.is_directed() {
         // Algorithm 8 : [1];
         if (!xn::is_weakly_connected(G) {
@@ -781,15 +873,7 @@ auto edge_connectivity(G, s=None, t=None, flow_func=None, cutoff=None) {
         if (cutoff is not None) {
             L = min(cutoff, L);
 
-        for (auto i : range(n) {
-            kwargs["cutoff"] = L
-            try {
-                L = min(L, local_edge_connectivity(G, nodes[i], nodes[i + 1],
-                                                   **kwargs));
-            } catch (IndexError) { //last node!
-                L = min(L, local_edge_connectivity(G, nodes[i], nodes[0],
-                                                   **kwargs));
-        return L
+        pairs = [(nodes[i], nodes[(i + 1) % n]) for i : range(n)];
     } else { //undirected
         // Algorithm 6 : [1];
         if (!xn::is_connected(G) {
@@ -813,8 +897,21 @@ auto edge_connectivity(G, s=None, t=None, flow_func=None, cutoff=None) {
             // thus we return min degree
             return L
 
-        for (auto w : D) {
-            kwargs["cutoff"] = L
-            L = min(L, local_edge_connectivity(G, v, w, **kwargs));
+        pairs = [(v, w) for w : D];
+
+    if (flow_func.empty()) {
+        // The pairs run in parallel, sharing the smallest value so far
+        // as the cutoff of their flows
+        pairs = [(G._node_map[u], G._node_map[w]) for u, w : pairs];
+        return xn::minimum_pairwise_connectivity(
+            build_auxiliary_edge_arrays(G), pairs, L, num_threads);
+
+    // reuse auxiliary digraph && residual network
+    H = build_auxiliary_edge_connectivity(G);
+    R = build_residual_network(H, "capacity");
+    kwargs = dict(flow_func=flow_func, auxiliary=H, residual=R);
 
-        return L
+    for (auto [u, w] : pairs) {
+        kwargs["cutoff"] = L
+        L = min(L, local_edge_connectivity(G, u, w, **kwargs));
+    return L
@@ -0,0 +1,229 @@
+#ifndef _HOME_UBUNTU_GITHUB_XNETWORK_ALGORITHMS_CONNECTIVITY_CONNECTIVITY_HPP
+#define _HOME_UBUNTU_GITHUB_XNETWORK_ALGORITHMS_CONNECTIVITY_CONNECTIVITY_HPP 1
+
+//    Copyright (C) 2004-2018 by
+//    Wai-Shing Luk <luk036@gmail.com>
+//
+//
+//    All rights reserved.
+//    BSD license.
+/**
+Native flow based node && edge connectivity on reusable auxiliary arrays.
+*/
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <limits>
+#include <tuple>
+#include <utility>
+#include <vector>
+#include <xnetwork/algorithms/flow/dinitz_alg.hpp> // import _Dinitz
+#include <xnetwork/algorithms/flow/utils.hpp> // import ResidualNetwork
+#include <xnetwork/exception.hpp> // import XNetworkError
+#include <xnetwork/utils/parallel.hpp> // import parallel_for, resolve_num_threads
+
+namespace xn {
+
+/** The auxiliary network of a connectivity problem, built once &&
+    reused for any number of node pairs.
+
+    With `split_nodes` node `v` of the graph is the arc `(2v, 2v+1)` of
+    R, as the `vA`, `vB` nodes of `build_auxiliary_node_connectivity`,
+    && the connectivity of `(s, t)` is the maximum flow from `2s+1` to
+    `2t`; otherwise nodes map to themselves && it is the local edge
+    connectivity.  Each query resets the flow of R && runs unit
+    capacity Dinitz (`_Dinitz`), whose level && current arc arrays are
+    kept between queries.
+
+    A copy owns its own arrays, so threads can each work on one.
+*/
+template <typename Cap = int> class ConnectivityNetwork {
+  public:
+    using pair_t = std::pair<std::size_t, std::size_t>;
+    static constexpr auto no_cutoff = std::numeric_limits<Cap>::max();
+
+    ConnectivityNetwork(ResidualNetwork<Cap> R, bool split_nodes)
+        : _R{std::move(R)}, _split{split_nodes}, _dinitz{this->_R, 0, 0} {}
+
+    ConnectivityNetwork(const ConnectivityNetwork &other)
+        : ConnectivityNetwork(other._R, other._split) {}
+
+    ConnectivityNetwork &operator=(const ConnectivityNetwork &) = delete;
+
+    /** Number of nodes of the original graph. */
+    auto num_nodes() const {
+        return this->_split ? this->_R.num_nodes() / 2 : this->_R.num_nodes();
+    }
+
+    auto residual() const -> const ResidualNetwork<Cap> & { return this->_R; }
+
+    /** Return the local connectivity of s && t, || a value of at least
+        `cutoff` once the flow reaches it.  Unit augmentations make that
+        value exactly `min(kappa(s, t), cutoff)`.
+    */
+    auto local_connectivity(std::size_t s, std::size_t t,
+                            Cap cutoff = no_cutoff) -> Cap {
+        if (s >= this->num_nodes() || t >= this->num_nodes())
+            throw XNetworkError("node not in graph");
+        if (s == t)
+            throw XNetworkError("source and sink are the same node");
+        if (this->_split) {
+            s = 2 * s + 1;
+            t = 2 * t;
+        }
+        // the flow cannot exceed the capacity around s || t; stopping
+        // there saves the last, fruitless, phase
+        auto &R = this->_R;
+        auto out = Cap(0), in = Cap(0);
+        for (auto a = R.indptr[s]; a < R.indptr[s + 1]; ++a)
+            out += R.cap[a];
+        for (auto a = R.indptr[t]; a < R.indptr[t + 1]; ++a)
+            in += R.cap[R.rev[a]];
+        cutoff = std::min({cutoff, out, in});
+        R.reset();
+        this->_dinitz.set_terminals(s, t);
+        R.flow_value = this->_dinitz.run(cutoff);
+        return R.flow_value;
+    }
+
+  private:
+    ResidualNetwork<Cap> _R;
+    bool _split;
+    _Dinitz<Cap, true> _dinitz;
+};
+
+/** Build the auxiliary network of node connectivity.
+
+    Node `v` is split into `vA = 2v` && `vB = 2v+1` joined by a unit
+    arc; an edge `(u, v)` gives the arc `(uB, vA)`, && `(vB, uA)` too if
+    the graph is undirected.  This is `build_auxiliary_node_connectivity`
+    of `utils.h` on arrays.
+
+    Parameters
+    ----------
+    num_nodes : size_t
+
+    first, last : iterators over `(u, v)` pairs of node indices
+
+    directed : bool
+*/
+template <typename Cap = int, typename EdgeIter>
+auto node_connectivity_network(std::size_t num_nodes, EdgeIter first,
+                               EdgeIter last, bool directed)
+    -> ConnectivityNetwork<Cap> {
+    auto arcs = std::vector<std::tuple<std::size_t, std::size_t, Cap>>{};
+    for (std::size_t v = 0; v < num_nodes; ++v)
+        arcs.emplace_back(2 * v, 2 * v + 1, Cap(1));
+    for (auto it = first; it != last; ++it) {
+        auto [u, v] = *it;
+        if (u == v)
+            continue;
+        arcs.emplace_back(2 * u + 1, 2 * v, Cap(1));
+        if (!directed)
+            arcs.emplace_back(2 * v + 1, 2 * u, Cap(1));
+    }
+    return ConnectivityNetwork<Cap>(
+        ResidualNetwork<Cap>(2 * num_nodes, arcs.begin(), arcs.end(), true),
+        true);
+}
+
+/** Build the auxiliary network of edge connectivity: every edge is an
+    arc of capacity one, in both directions if the graph is undirected,
+    as `build_auxiliary_edge_connectivity` of `utils.h`.
+*/
+template <typename Cap = int, typename EdgeIter>
+auto edge_connectivity_network(std::size_t num_nodes, EdgeIter first,
+                               EdgeIter last, bool directed)
+    -> ConnectivityNetwork<Cap> {
+    auto arcs = std::vector<std::tuple<std::size_t, std::size_t, Cap>>{};
+    for (auto it = first; it != last; ++it) {
+        auto [u, v] = *it;
+        arcs.emplace_back(u, v, Cap(1));
+    }
+    return ConnectivityNetwork<Cap>(
+        ResidualNetwork<Cap>(num_nodes, arcs.begin(), arcs.end(), directed),
+        false);
+}
+
+/** One copy of N per thread that has pairs to work on. */
+template <typename Cap>
+auto _worker_copies(const ConnectivityNetwork<Cap> &N, std::size_t num_pairs,
+                    unsigned num_threads) {
+    auto nt = std::min<std::size_t>(resolve_num_threads(num_threads),
+                                    std::max<std::size_t>(num_pairs, 1));
+    auto workers = std::vector<ConnectivityNetwork<Cap>>{};
+    workers.reserve(nt);
+    for (std::size_t k = 0; k < nt; ++k)
+        workers.push_back(N);
+    return workers;
+}
+
+/** Compute the local connectivity of every pair.
+
+    The pairs are independent: each thread works on its own copy of N,
+    so the values do not depend on the number of threads.  Values
+    are capped at `cutoff`.
+
+    Parameters
+    ----------
+    N : ConnectivityNetwork
+
+    pairs : vector of `(s, t)` node indices
+
+    cutoff : Cap, optional
+
+    num_threads : unsigned, optional (default=0)
+        Number of threads; 0 uses all hardware threads.
+*/
+template <typename Cap>
+auto pairwise_connectivity(
+    const ConnectivityNetwork<Cap> &N,
+    const std::vector<typename ConnectivityNetwork<Cap>::pair_t> &pairs,
+    Cap cutoff = ConnectivityNetwork<Cap>::no_cutoff, unsigned num_threads = 0)
+    -> std::vector<Cap> {
+    auto values = std::vector<Cap>(pairs.size());
+    auto workers = _worker_copies(N, pairs.size(), num_threads);
+    parallel_for(
+        pairs.size(),
+        [&](std::size_t i, unsigned tid) {
+            auto [s, t] = pairs[i];
+            values[i] = workers[tid].local_connectivity(s, t, cutoff);
+        },
+        unsigned(workers.size()), 1);
+    return values;
+}
+
+/** Return `min(bound, kappa(s, t) for (s, t) in pairs)`.
+
+    Every flow stops as soon as it reaches the smallest value found so
+    far, which the threads share; a pair whose connectivity is below it
+    is still computed exactly, so the result does not depend on the
+    order || the number of threads.
+*/
+template <typename Cap>
+auto minimum_pairwise_connectivity(
+    const ConnectivityNetwork<Cap> &N,
+    const std::vector<typename ConnectivityNetwork<Cap>::pair_t> &pairs,
+    Cap bound = ConnectivityNetwork<Cap>::no_cutoff, unsigned num_threads = 0)
+    -> Cap {
+    auto best = std::atomic<Cap>{bound};
+    auto workers = _worker_copies(N, pairs.size(), num_threads);
+    parallel_for(
+        pairs.size(),
+        [&](std::size_t i, unsigned tid) {
+            auto cutoff = best.load(std::memory_order_relaxed);
+            if (cutoff == Cap(0))
+                return;
+            auto [s, t] = pairs[i];
+            auto k = workers[tid].local_connectivity(s, t, cutoff);
+            while (k < cutoff && !best.compare_exchange_weak(cutoff, k))
+                ;
+        },
+        unsigned(workers.size()), 1);
+    return best.load();
+}
+
+} // namespace xn
+
+#endif
@@ -7,35 +7,58 @@
 /**
 Stoer-Wagner minimum cut algorithm.
 */
-from itertools import islice
+import random
 
 #include <xnetwork.hpp> // as xn
 from ...utils import BinaryHeap
+from ...utils import PairingHeap
 from ...utils import not_implemented_for
-from ...utils import arbitrary_element
+#include <xnetwork/algorithms/connectivity/stoerwagner.hpp> // import stoer_wagner_cut, nagamochi_ibaraki_cut, karger_stein_cut
+#include <xnetwork/utils/heaps.hpp> // import IndexedPairingHeap
 
 __author__ = "ysitu <ysitu@users.noreply.github.com>";
 
 static const auto __all__ = ["stoer_wagner"];
 
 
+template <typename W>
+auto _global_min_cut(n, edges, heap, method, trials, seed, num_threads) {
+    /** Run the native cut `method` with `W` weights. */
+    if (method == "stoer_wagner" && heap is PairingHeap) {
+        return xn::stoer_wagner_cut<W,
+                   xn::IndexedPairingHeap<W, std::greater<W>>>(
+            n, edges.begin(), edges.end());
+    } else if (method == "stoer_wagner") {
+        return xn::stoer_wagner_cut<W>(n, edges.begin(), edges.end());
+    } else if (method == "nagamochi_ibaraki") {
+        return xn::nagamochi_ibaraki_cut<W>(n, edges.begin(), edges.end());
+    } else if (method == "karger_stein") {
+        return xn::karger_stein_cut<W>(n, edges.begin(), edges.end(),
+                                       0 if trials is None else trials,
+                                       seed, num_threads);
+    } else {
+        throw xn::XNetworkError("unknown method %r." % method);
+
+
 /// @not_implemented_for("directed");
 /// @not_implemented_for("multigraph");
-auto stoer_wagner(G, weight="weight", heap=BinaryHeap) {
+auto stoer_wagner(G, weight="weight", heap=BinaryHeap, method="stoer_wagner",
+                  trials=None, seed=None, num_threads=0) {
     /** Return the weighted minimum edge cut using the Stoer-Wagner algorithm.
 
     Determine the minimum edge cut of a connected graph using the
     Stoer-Wagner algorithm. In weighted cases, all weights must be
     nonnegative.
 
+    The cut is computed natively on integer node indices (see Notes).
     The running time of the algorithm depends on the type of heaps used) {
 
     ============== =============================================
     Type of heap   Running time
     ============== =============================================
-    Binary heap    $O(n (m + n) \log n)$
-    Fibonacci heap $O(nm + n^2 \log n)$
+    4-ary heap     $O(n m \log n)$
     Pairing heap   $O(2^{2 \sqrt{\log \log n}} nm + n^2 \log n)$
+    Bucket queue   $O(n (n + m))$, small integer weights only
     ============== =============================================
 
     Parameters
@@ -50,15 +73,28 @@ auto stoer_wagner(G, weight="weight", heap=BinaryHeap) {
         present, unit weight is assumed. Default value: "weight".
 
     heap : class
-        Type of heap to be used : the algorithm. It should be a subclass of
-        :class:`MinHeap` || implement a compatible interface.
+        Type of heap of the native computation. :class:`PairingHeap`
+        selects `xn::IndexedPairingHeap`; any other class lets the
+        algorithm pick a bucket queue when every weight is an int &&
+        their total is small, && an indexed 4-ary heap otherwise,
+        which is usually the fastest. Default value: :class:`BinaryHeap`.
+
+    method : string
+        "stoer_wagner" (default), "nagamochi_ibaraki" || "karger_stein".
+        The two first ones are exact; "karger_stein" is a parallel Monte
+        Carlo method that finds a minimum cut with high probability.
+
+    trials : integer, optional
+        Number of Karger-Stein trials. None (default) runs
+        `ceil(log2(n))` of them.
+
+    seed : integer, optional
+        Seed of the Karger-Stein trials. The result depends only on the
+        seed, not on num_threads.
 
-        If a stock heap implementation is to be used, :class:`BinaryHeap` is
-        recommended over :class:`PairingHeap` for Python implementations without
-        optimized attribute accesses (e.g., CPython) despite a slower
-        asymptotic running time. For Python implementations with optimized
-        attribute accesses (e.g., PyPy), :class:`PairingHeap` provides better
-        performance. Default value: :class:`BinaryHeap`.
+    num_threads : integer
+        Number of threads of the Karger-Stein trials; 0 (default) uses
+        all hardware threads.
 
     Returns
     -------
@@ -74,8 +110,8 @@ auto stoer_wagner(G, weight="weight", heap=BinaryHeap) {
         If the graph is directed || a multigraph.
 
     XNetworkError
-        If the graph has less than two nodes, is not connected || has a
-        negative-weighted edge.
+        If the graph has less than two nodes, is not connected, has a
+        negative-weighted edge || method is unknown.
 
     Examples
     --------
@@ -91,67 +127,48 @@ auto stoer_wagner(G, weight="weight", heap=BinaryHeap) {
     >>> cut_value, partition = xn::stoer_wagner(G);
     >>> cut_value
     4
+
+    Notes
+    -----
+    Self loops are ignored. Contracted nodes keep their adjacency in
+    lists that are merged on contraction, with a union-find mapping the
+    old neighbors to the merged node, so the graph is never densified.
+
+    On large sparse graphs "nagamochi_ibaraki" is usually much faster:
+    each round computes one maximum adjacency ordering && contracts
+    every edge whose endpoints are at least as tightly connected as the
+    best cut found so far, removing many nodes at once [2]_.
+
+    "karger_stein" contracts random edges, recursing on two copies of
+    the contracted graph, && solves the small leaves by
+    Nagamochi-Ibaraki [3]_. Trials run in parallel.
+
+    References
+    ----------
+    .. [1] M. Stoer, F. Wagner. A simple min-cut algorithm. Journal of
+           the ACM 44(4):585--591. 1997.
+    .. [2] H. Nagamochi, T. Ibaraki. Computing edge-connectivity in
+           multigraphs && capacitated graphs. SIAM J. Discrete Math.
+           5(1):54--66. 1992.
+    .. [3] D. R. Karger, C. Stein. A new approach to the minimum cut
+           problem. Journal of the ACM 43(4):601--640. 1996.
      */
-    n = len(G);
-    if (n < 2) {
-        throw xn::XNetworkError("graph has less than two nodes.");
-    if (!xn::is_connected(G) {
-        throw xn::XNetworkError("graph is not connected.");
-
-    // Make a copy of the graph for internal use.
-    G = xn::Graph((u, v, {"weight": e.get(weight, 1)});
-                 for (auto [u, v, e] : G.edges(data=true) if (u != v);
-
-    for (auto u, v, e, : G.edges(data=true) {
-        if (e["weight"] < 0) {
-            throw xn::XNetworkError("graph has a negative-weighted edge.");
-
-    cut_value = double("inf");
-    nodes = set(G);
-    contractions = [];  // contracted node pairs
-
-    // Repeatedly pick a pair of nodes to contract until only one node is left.
-    for (auto i : range(n - 1) {
-        // Pick an arbitrary node u && create a set A = {u}.
-        u = arbitrary_element(G);
-        A = set([u]);
-        // Repeatedly pick the node "most tightly connected" to A && add it to
-        // A. The tightness of connectivity of a node not : A is defined by the
-        // of edges connecting it to nodes : A.
-        h = heap();  // min-heap emulating a max-heap
-        for (auto v, e : G[u].items() {
-            h.insert(v, -e["weight"]);
-        // Repeat until all but one node has been added to A.
-        for (auto j : range(n - i - 2) {
-            u = h.pop()[0];
-            A.add(u);
-            for (auto v, e, : G[u].items() {
-                if (v not : A) {
-                    h.insert(v, h.get(v, 0) - e["weight"]);
-        // A && the remaining node v define a "cut of the phase". There is a
-        // minimum cut of the original graph that is also a cut of the phase.
-        // Due to contractions : earlier phases, v may : fact represent
-        // multiple nodes : the original graph.
-        v, w = h.min();
-        w = -w
-        if (w < cut_value) {
-            cut_value = w;
-            best_phase = i
-        // Contract v && the last node added to A.
-        contractions.append((u, v));
-        for (auto w, e : G[v].items() {
-            if (w != u) {
-                if (w not : G[u]) {
-                    G.add_edge(u, w, weight=e["weight"]);
-                } else {
-                    G[u][w]["weight"] += e["weight"];
-        G.remove_node(v);
-
-    // Recover the optimal partitioning from the contractions.
-    G = xn::Graph(islice(contractions, best_phase));
-    v = contractions[best_phase][1];
-    G.add_node(v);
-    reachable = set(xn::single_source_shortest_path_length(G, v));
-    partition = (list(reachable), list(nodes - reachable));
-
-    return cut_value, partition
+    nodes = list(G);
+    index = {u: i for i, u : enumerate(nodes)};
+    edges = [(index[u], index[v], e.get(weight, 1));
+             for (auto [u, v, e] : G.edges(data=true)];
+
+    if (method == "karger_stein" && seed is None) {
+        seed = random.getrandbits(64);
+    // Integer weights keep integer keys, which lets the native code use
+    // a bucket queue.
+    if (all(isinstance(w, int) for (auto [u, v, w] : edges))) {
+        cut = _global_min_cut<long>(len(nodes), edges, heap, method,
+                                    trials, seed, num_threads);
+    } else {
+        cut = _global_min_cut<double>(len(nodes), edges, heap, method,
+                                      trials, seed, num_threads);
+
+    partition = ([u for i, u : enumerate(nodes) if (cut.side[i]],
+                 [u for i, u : enumerate(nodes) if (!cut.side[i]]);
+    return cut.value, partition
@@ -0,0 +1,654 @@
+#ifndef _HOME_UBUNTU_GITHUB_XNETWORK_ALGORITHMS_CONNECTIVITY_STOERWAGNER_HPP
+#define _HOME_UBUNTU_GITHUB_XNETWORK_ALGORITHMS_CONNECTIVITY_STOERWAGNER_HPP 1
+
+//    Copyright (C) 2004-2018 by
+//    Wai-Shing Luk <luk036@gmail.com>
+//
+//
+//    All rights reserved.
+//    BSD license.
+/**
+Native global minimum cuts: Stoer-Wagner, Nagamochi-Ibaraki && Karger-Stein.
+*/
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <random>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include <xnetwork/exception.hpp> // import XNetworkError
+#include <xnetwork/utils/heaps.hpp> // import IndexedQuaternaryHeap
+#include <xnetwork/utils/parallel.hpp> // import parallel_for, resolve_num_threads
+#include <xnetwork/utils/union_find.hpp> // import DenseUnionFind
+
+namespace xn {
+
+/** A global minimum cut: its value && one side (`side[u]` is true for
+    the nodes of that side).
+*/
+template <typename W> struct GlobalMinCut {
+    W value = std::numeric_limits<W>::max();
+    std::vector<bool> side;
+};
+
+/** Indexed max-heap for small non-negative integer keys, with the
+    interface of `IndexedDaryHeap`: one doubly linked list per key && a
+    top pointer, so every operation of a maximum adjacency ordering is
+    O(1) amortized.  `clear` costs the number of entries && the top key.
+*/
+template <typename W> class _BucketHeap {
+  public:
+    using index_t = std::uint32_t;
+    using key_type = W;
+    static constexpr auto none = std::numeric_limits<index_t>::max();
+
+    explicit _BucketHeap(std::size_t n)
+        : _next(n, none), _prev(n, none), _key(n), _in(n, false) {}
+
+    auto size() const { return this->_size; }
+    auto empty() const { return this->_size == 0; }
+    auto contains(std::size_t x) const -> bool { return this->_in[x]; }
+    auto key(std::size_t x) const { return W(this->_key[x]); }
+    auto top() const { return this->_first[this->_top]; }
+    auto top_key() const { return W(this->_top); }
+
+    void push(std::size_t x, W k) {
+        this->_in[x] = true;
+        ++this->_size;
+        this->_link(index_t(x), std::size_t(k));
+    }
+
+    auto pop() -> index_t {
+        auto x = this->top();
+        this->remove(x);
+        return x;
+    }
+
+    void update(std::size_t x, W k) {
+        if (!this->_in[x]) {
+            this->push(x, k);
+            return;
+        }
+        this->_unlink(index_t(x));
+        this->_link(index_t(x), std::size_t(k));
+        this->_settle();
+    }
+
+    void remove(std::size_t x) {
+        this->_unlink(index_t(x));
+        this->_in[x] = false;
+        --this->_size;
+        this->_settle();
+    }
+
+    void clear() {
+        for (auto k = std::size_t(0);
+             k <= this->_top && k < this->_first.size(); ++k) {
+            for (auto x = this->_first[k]; x != none; x = this->_next[x])
+                this->_in[x] = false;
+            this->_first[k] = none;
+        }
+        this->_top = 0;
+        this->_size = 0;
+    }
+
+  private:
+    std::vector<index_t> _next, _prev, _first;
+    std::vector<std::size_t> _key;
+    std::vector<bool> _in;
+    std::size_t _top = 0, _size = 0;
+
+    void _link(index_t x, std::size_t k) {
+        if (k >= this->_first.size())
+            this->_first.resize(k + 1, none);
+        this->_key[x] = k;
+        this->_prev[x] = none;
+        this->_next[x] = this->_first[k];
+        if (this->_first[k] != none)
+            this->_prev[this->_first[k]] = x;
+        this->_first[k] = x;
+        this->_top = std::max(this->_top, k);
+    }
+
+    void _unlink(index_t x) {
+        auto k = this->_key[x];
+        if (this->_prev[x] != none)
+            this->_next[this->_prev[x]] = this->_next[x];
+        else
+            this->_first[k] = this->_next[x];
+        if (this->_next[x] != none)
+            this->_prev[this->_next[x]] = this->_prev[x];
+    }
+
+    /** Lower the top pointer to the highest nonempty bucket. */
+    void _settle() {
+        if (this->_size == 0)
+            this->_top = 0;
+        else
+            while (this->_first[this->_top] == none)
+                --this->_top;
+    }
+};
+
+/** Add d to the key of x in a max-heap, inserting x with key d if it
+    is not there, keeping keys at most `cap`; return the new key.
+*/
+template <typename Heap, typename W>
+auto _increase(Heap &heap, std::uint32_t x, W d, W cap) -> W {
+    if (!heap.contains(x)) {
+        auto k = std::min(d, cap);
+        heap.push(x, k);
+        return k;
+    }
+    auto k = heap.key(x);
+    if (k < cap) {
+        k = k < cap - d ? k + d : cap;
+        heap.update(x, k);
+    }
+    return k;
+}
+
+/** The max-heap used when no bucket queue applies; the 4-ary heap
+    beats the binary one on the update-heavy orderings.
+*/
+template <typename W>
+using _MaxHeap = IndexedQuaternaryHeap<W, std::greater<W>>;
+
+/** The simple weighted graph of a cut problem: edges `(u, v, w)` with
+    `u < v`, no self loops && parallel edges merged.
+*/
+template <typename W> struct _CutGraph {
+    using index_t = std::uint32_t;
+    std::size_t n = 0;
+    std::vector<std::tuple<index_t, index_t, W>> edges;
+
+    void merge_parallel() {
+        auto &E = this->edges;
+        std::sort(E.begin(), E.end(), [](const auto &x, const auto &y) {
+            return std::tie(std::get<0>(x), std::get<1>(x)) <
+                   std::tie(std::get<0>(y), std::get<1>(y));
+        });
+        auto k = std::size_t(0);
+        for (std::size_t i = 0; i < E.size(); ++i) {
+            if (k > 0 && std::get<0>(E[k - 1]) == std::get<0>(E[i]) &&
+                std::get<1>(E[k - 1]) == std::get<1>(E[i]))
+                std::get<2>(E[k - 1]) += std::get<2>(E[i]);
+            else
+                E[k++] = E[i];
+        }
+        E.resize(k);
+    }
+
+    auto total_weight() const {
+        auto s = W(0);
+        for (const auto &e : this->edges)
+            s += std::get<2>(e);
+        return s;
+    }
+
+    /** Whether a bucket queue with keys up to `cap` pays off. */
+    auto small_integer_keys(W cap) const {
+        return std::is_integral_v<W> &&
+               double(cap) <= 4.0 * double(this->n + this->edges.size());
+    }
+};
+
+/** Check && simplify the edges of a cut problem.
+
+    Raises `XNetworkError` if there are fewer than two nodes, a negative
+    weight || if the graph is not connected.
+*/
+template <typename W, typename EdgeIter>
+auto _make_cut_graph(std::size_t num_nodes, EdgeIter first, EdgeIter last)
+    -> _CutGraph<W> {
+    using index_t = std::uint32_t;
+    if (num_nodes < 2)
+        throw XNetworkError("graph has less than two nodes.");
+    auto G = _CutGraph<W>{};
+    G.n = num_nodes;
+    auto uf = DenseUnionFind(num_nodes);
+    for (auto it = first; it != last; ++it) {
+        auto [u, v, w] = *it;
+        if (W(w) < 0)
+            throw XNetworkError("graph has a negative-weighted edge.");
+        if (u == v)
+            continue;
+        uf.unite(index_t(u), index_t(v));
+        G.edges.emplace_back(index_t(std::min(u, v)), index_t(std::max(u, v)),
+                             W(w));
+    }
+    if (uf.num_sets() != 1)
+        throw XNetworkError("graph is not connected.");
+    G.merge_parallel();
+    return G;
+}
+
+/** Stoer-Wagner on a connected `_CutGraph` with the given heap type. */
+template <typename W, typename Heap>
+auto _stoer_wagner(const _CutGraph<W> &G, W cap) -> GlobalMinCut<W> {
+    using index_t = std::uint32_t;
+    constexpr auto none = std::numeric_limits<index_t>::max();
+    auto n = G.n;
+
+    // contractible adjacency: lists of (node, weight) whose nodes are
+    // mapped to their current super node through the union-find
+    auto adj = std::vector<std::vector<std::pair<index_t, W>>>(n);
+    for (const auto &[u, v, w] : G.edges) {
+        adj[u].emplace_back(v, w);
+        adj[v].emplace_back(u, w);
+    }
+    auto uf = DenseUnionFind(n);
+    auto alive = std::vector<index_t>(n);
+    auto where = std::vector<index_t>(n);
+    for (std::size_t u = 0; u < n; ++u)
+        alive[u] = where[u] = index_t(u);
+    auto stamp = std::vector<std::size_t>(n, 0);
+    auto pos = std::vector<index_t>(n, none);
+    auto heap = Heap(n);
+    auto contractions = std::vector<std::pair<index_t, index_t>>{};
+    contractions.reserve(n - 1);
+
+    auto best = GlobalMinCut<W>{};
+    auto best_phase = std::size_t(0);
+    for (std::size_t i = 0; i + 1 < n; ++i) {
+        auto k = n - i;
+        heap.clear();
+        auto scan = [&](index_t u) {
+            stamp[u] = i + 1;
+            for (auto &[x, w] : adj[u]) {
+                x = uf.find(x);
+                if (stamp[x] != i + 1)
+                    _increase(heap, x, w, cap);
+            }
+        };
+        auto prev = alive[0];
+        scan(prev);
+        for (std::size_t j = 0; j + 2 < k; ++j) {
+            if (heap.empty())
+                throw XNetworkError("graph is not connected.");
+            prev = heap.pop();
+            scan(prev);
+        }
+        if (heap.empty())
+            throw XNetworkError("graph is not connected.");
+        // the last node && its key give the cut of the phase
+        auto v = heap.top();
+        auto w = heap.top_key();
+        if (w < best.value) {
+            best.value = w;
+            best_phase = i;
+        }
+        contractions.emplace_back(prev, v);
+
+        // contract v && prev, merging their lists
+        uf.unite(prev, v);
+        auto r = uf.find(prev);
+        auto o = r == prev ? v : prev;
+        auto merged = std::vector<std::pair<index_t, W>>{};
+        merged.reserve(adj[r].size() + adj[o].size());
+        for (auto *list : {&adj[r], &adj[o]}) {
+            for (const auto &[x, c] : *list) {
+                auto y = uf.find(x);
+                if (y == r)
+                    continue;
+                if (pos[y] == none) {
+                    pos[y] = index_t(merged.size());
+                    merged.emplace_back(y, c);
+                } else {
+                    merged[pos[y]].second += c;
+                }
+            }
+        }
+        for (const auto &e : merged)
+            pos[e.first] = none;
+        adj[r] = std::move(merged);
+        adj[o] = {};
+        auto at = where[o];
+        alive[at] = alive.back();
+        where[alive[at]] = at;
+        alive.pop_back();
+    }
+
+    // recover the side of the best phase from the contractions
+    auto side = DenseUnionFind(n);
+    for (std::size_t p = 0; p < best_phase; ++p)
+        side.unite(contractions[p].first, contractions[p].second);
+    auto root = side.find(contractions[best_phase].second);
+    best.side.assign(n, false);
+    for (std::size_t u = 0; u < n; ++u)
+        best.side[u] = side.find(index_t(u)) == root;
+    return best;
+}
+
+template <typename W>
+auto _stoer_wagner(const _CutGraph<W> &G) -> GlobalMinCut<W> {
+    auto cap = G.total_weight();
+    if constexpr (std::is_integral_v<W>) {
+        if (G.small_integer_keys(cap))
+            return _stoer_wagner<W, _BucketHeap<W>>(G, cap);
+    }
+    return _stoer_wagner<W, _MaxHeap<W>>(G, cap);
+}
+
+/** Compute a global minimum cut with the Stoer-Wagner algorithm.
+
+    Each phase builds a maximum adjacency ordering with a heap that is
+    allocated once && cleared in time proportional to its entries: a
+    bucket queue when the weights are integers whose total is
+    O(n + m), an indexed 4-ary heap otherwise.  The two last nodes of
+    the ordering are contracted by merging their adjacency lists;
+    neighbors find the merged node through a union-find, so a phase
+    costs O(m log n) (O(n + m) with buckets).
+
+    Parameters
+    ----------
+    Heap : max-heap type, optional
+        A heap with the interface of `IndexedDaryHeap` ordering the
+        keys by `std::greater<W>`, e.g. `IndexedPairingHeap<W,
+        std::greater<W>>`; the default (void) picks as above.
+
+    num_nodes : size_t
+
+    first, last : iterators over `(u, v, weight)` triples
+        The undirected edges; self loops are ignored && parallel edges
+        add up.
+
+    Raises
+    ------
+    XNetworkError
+        If there are fewer than two nodes, a negative weight || the
+        graph is not connected.
+*/
+template <typename W = double, typename Heap = void, typename EdgeIter>
+auto stoer_wagner_cut(std::size_t num_nodes, EdgeIter first, EdgeIter last)
+    -> GlobalMinCut<W> {
+    auto G = _make_cut_graph<W>(num_nodes, first, last);
+    if constexpr (std::is_void_v<Heap>)
+        return _stoer_wagner(G);
+    else
+        return _stoer_wagner<W, Heap>(G, std::numeric_limits<W>::max());
+}
+
+/** Nagamochi-Ibaraki on a connected `_CutGraph`. */
+template <typename W, typename Heap>
+auto _nagamochi_ibaraki(_CutGraph<W> G) -> GlobalMinCut<W> {
+    using index_t = std::uint32_t;
+    auto n0 = G.n;
+    auto label = std::vector<index_t>(n0);
+    for (std::size_t u = 0; u < n0; ++u)
+        label[u] = index_t(u);
+    auto best = GlobalMinCut<W>{};
+
+    auto indptr = std::vector<std::size_t>{};
+    auto adj = std::vector<index_t>{};
+    auto wt = std::vector<W>{};
+    auto heap = Heap(n0);
+    auto stamp = std::vector<std::size_t>(n0, 0);
+    for (std::size_t round = 1; G.n > 1; ++round) {
+        auto n = G.n;
+        // CSR of the current graph && the trivial cuts
+        indptr.assign(n + 1, 0);
+        auto degree = std::vector<W>(n, W(0));
+        for (const auto &[u, v, w] : G.edges) {
+            ++indptr[u + 1];
+            ++indptr[v + 1];
+            degree[u] += w;
+            degree[v] += w;
+        }
+        auto argmin = std::size_t(
+            std::min_element(degree.begin(), degree.end()) - degree.begin());
+        if (degree[argmin] < best.value) {
+            best.value = degree[argmin];
+            best.side.assign(n0, false);
+            for (std::size_t u = 0; u < n0; ++u)
+                best.side[u] = label[u] == argmin;
+        }
+        if (n <= 2 || best.value == W(0))
+            break;
+        for (std::size_t u = 0; u < n; ++u)
+            indptr[u + 1] += indptr[u];
+        adj.resize(indptr[n]);
+        wt.resize(indptr[n]);
+        auto fill = std::vector<std::size_t>(indptr.begin(), indptr.end() - 1);
+        for (const auto &[u, v, w] : G.edges) {
+            adj[fill[u]] = v;
+            wt[fill[u]++] = w;
+            adj[fill[v]] = u;
+            wt[fill[v]++] = w;
+        }
+
+        // maximum adjacency ordering with keys capped at the bound;
+        // an edge whose key reaches it joins nodes that no cut below
+        // the bound separates, so it is contracted
+        auto uf = DenseUnionFind(n);
+        heap.clear();
+        auto x = index_t(0), last = index_t(0);
+        for (std::size_t k = 0; k < n; ++k) {
+            if (k > 0) {
+                if (heap.empty())
+                    throw XNetworkError("graph is not connected.");
+                x = heap.pop();
+            }
+            stamp[x] = round;
+            for (auto e = indptr[x]; e < indptr[x + 1]; ++e) {
+                auto y = adj[e];
+                if (stamp[y] != round &&
+                    !(_increase(heap, y, wt[e], best.value) < best.value))
+                    uf.unite(x, y);
+            }
+            if (k + 1 < n)
+                last = x;
+        }
+        if (uf.num_sets() == n)
+            uf.unite(last, x); // cannot happen with exact keys
+
+        // contract
+        auto id = std::vector<index_t>(n, DenseUnionFind::index_t(-1));
+        auto m = std::size_t(0);
+        for (std::size_t u = 0; u < n; ++u) {
+            auto r = uf.find(index_t(u));
+            if (id[r] == index_t(-1))
+                id[r] = index_t(m++);
+            id[u] = id[r];
+        }
+        for (auto &l : label)
+            l = id[l];
+        auto k = std::size_t(0);
+        for (std::size_t i = 0; i < G.edges.size(); ++i) {
+            auto [u, v, w] = G.edges[i];
+            auto a = id[u], b = id[v];
+            if (a != b)
+                G.edges[k++] = {std::min(a, b), std::max(a, b), w};
+        }
+        G.edges.resize(k);
+        G.n = m;
+        G.merge_parallel();
+    }
+    return best;
+}
+
+template <typename W>
+auto _nagamochi_ibaraki(_CutGraph<W> G) -> GlobalMinCut<W> {
+    if constexpr (std::is_integral_v<W>) {
+        // keys never exceed the minimum degree
+        auto degree = std::vector<W>(G.n, W(0));
+        for (const auto &[u, v, w] : G.edges) {
+            degree[u] += w;
+            degree[v] += w;
+        }
+        if (G.small_integer_keys(*std::min_element(degree.begin(),
+                                                   degree.end())))
+            return _nagamochi_ibaraki<W, _BucketHeap<W>>(std::move(G));
+    }
+    return _nagamochi_ibaraki<W, _MaxHeap<W>>(std::move(G));
+}
+
+/** Compute a global minimum cut with the Nagamochi-Ibaraki algorithm.
+
+    Every round computes one maximum adjacency ordering of the current
+    graph with keys capped at the best cut value found so far (the
+    bounded priority queue of [2]) && contracts all the edges whose key
+    reaches that bound, not just the last two nodes; the minimum
+    weighted degree of the contracted graph updates the bound.  It is
+    exact && needs far fewer rounds than Stoer-Wagner needs phases on
+    large sparse graphs.
+
+    Parameters
+    ----------
+    num_nodes : size_t
+
+    first, last : iterators over `(u, v, weight)` triples
+
+    Raises
+    ------
+    XNetworkError
+        As `stoer_wagner_cut`.
+
+    References
+    ----------
+    .. [1] H. Nagamochi, T. Ono, T. Ibaraki. Implementing an efficient
+           minimum capacity cut algorithm. Mathematical Programming
+           67:325--341. 1994.
+    .. [2] M. Henzinger, A. Noe, C. Schulz, D. Strash. Practical
+           minimum cut algorithms. ACM JEA 23. 2018.
+*/
+template <typename W = double, typename EdgeIter>
+auto nagamochi_ibaraki_cut(std::size_t num_nodes, EdgeIter first,
+                           EdgeIter last) -> GlobalMinCut<W> {
+    return _nagamochi_ibaraki(_make_cut_graph<W>(num_nodes, first, last));
+}
+
+/** One recursive Karger-Stein contraction trial. */
+template <typename W, typename Rng>
+auto _karger_stein(const _CutGraph<W> &G, Rng &rng, std::size_t leaf)
+    -> GlobalMinCut<W> {
+    using index_t = std::uint32_t;
+    if (G.n <= leaf)
+        return _nagamochi_ibaraki(G);
+    auto target = std::size_t(std::ceil(1 + double(G.n) / std::sqrt(2.0)));
+    auto exp = std::exponential_distribution<double>{};
+    auto order = std::vector<std::pair<double, std::size_t>>{};
+    auto best = GlobalMinCut<W>{};
+    for (int branch = 0; branch < 2; ++branch) {
+        // contracting edges in the order of exponential keys divided by
+        // the weights picks each next edge with probability
+        // proportional to its weight
+        order.clear();
+        for (std::size_t i = 0; i < G.edges.size(); ++i) {
+            auto w = std::get<2>(G.edges[i]);
+            if (w > W(0))
+                order.emplace_back(exp(rng) / double(w), i);
+        }
+        std::sort(order.begin(), order.end());
+        auto uf = DenseUnionFind(G.n);
+        for (std::size_t j = 0; j < order.size() && uf.num_sets() > target;
+             ++j) {
+            const auto &e = G.edges[order[j].second];
+            uf.unite(std::get<0>(e), std::get<1>(e));
+        }
+        if (uf.num_sets() == G.n)
+            return _nagamochi_ibaraki(G);
+        auto id = std::vector<index_t>(G.n, index_t(-1));
+        auto H = _CutGraph<W>{};
+        for (std::size_t u = 0; u < G.n; ++u) {
+            auto r = uf.find(index_t(u));
+            if (id[r] == index_t(-1))
+                id[r] = index_t(H.n++);
+            id[u] = id[r];
+        }
+        for (const auto &[u, v, w] : G.edges)
+            if (id[u] != id[v])
+                H.edges.emplace_back(std::min(id[u], id[v]),
+                                     std::max(id[u], id[v]), w);
+        H.merge_parallel();
+        auto cut = _karger_stein(H, rng, leaf);
+        if (cut.value < best.value) {
+            best.value = cut.value;
+            best.side.assign(G.n, false);
+            for (std::size_t u = 0; u < G.n; ++u)
+                best.side[u] = cut.side[id[u]];
+        }
+    }
+    return best;
+}
+
+/** Compute a global minimum cut with high probability by the
+    Karger-Stein recursive contraction algorithm.
+
+    Each trial contracts random edges, picked with probability
+    proportional to their weights, down to `1 + n / sqrt(2)` nodes
+    twice && recurses on both results.  The recursion stops at
+    `max(24, n / 8)` nodes, six levels down, where Nagamochi-Ibaraki
+    solves the contracted graph exactly; a given minimum cut then
+    survives a trial with probability at least 0.36, so the default
+    `ceil(log2(n))` trials miss it with probability below
+    `0.64^log2(n)`.  Trials run in parallel; trial `i` draws from
+    `mt19937_64{seed + i}` && the cut of the lowest trial among the
+    best ones is returned, so the result does not depend on the number
+    of threads.
+
+    Parameters
+    ----------
+    num_nodes : size_t
+
+    first, last : iterators over `(u, v, weight)` triples
+
+    trials : size_t, optional (default=0)
+        Number of trials; 0 means `ceil(log2(n))`.
+
+    seed : uint64_t, optional (default=0)
+
+    num_threads : unsigned, optional (default=0)
+        Number of threads; 0 uses all hardware threads.
+
+    Raises
+    ------
+    XNetworkError
+        As `stoer_wagner_cut`.
+
+    References
+    ----------
+    .. [1] D. R. Karger, C. Stein. A new approach to the minimum cut
+           problem. Journal of the ACM 43(4):601--640. 1996.
+*/
+template <typename W = double, typename EdgeIter>
+auto karger_stein_cut(std::size_t num_nodes, EdgeIter first, EdgeIter last,
+                      std::size_t trials = 0, std::uint64_t seed = 0,
+                      unsigned num_threads = 0) -> GlobalMinCut<W> {
+    auto G = _make_cut_graph<W>(num_nodes, first, last);
+    if (trials == 0)
+        trials = std::size_t(std::ceil(std::log2(double(G.n))));
+    auto leaf = std::max<std::size_t>(24, (G.n + 7) / 8);
+    auto nt = resolve_num_threads(num_threads);
+    nt = unsigned(std::min<std::size_t>(nt, trials));
+    auto best = std::vector<GlobalMinCut<W>>(nt);
+    auto best_trial = std::vector<std::size_t>(nt, trials);
+    parallel_for(
+        trials,
+        [&](std::size_t i, unsigned tid) {
+            auto rng = std::mt19937_64{seed + i};
+            auto cut = _karger_stein(G, rng, leaf);
+            if (cut.value < best[tid].value ||
+                (cut.value == best[tid].value && i < best_trial[tid])) {
+                best[tid] = std::move(cut);
+                best_trial[tid] = i;
+            }
+        },
+        nt, 1);
+    auto b = std::size_t(0);
+    for (std::size_t k = 1; k < nt; ++k)
+        if (best[k].value < best[b].value ||
+            (best[k].value == best[b].value && best_trial[k] < best_trial[b]))
+            b = k;
+    return std::move(best[b]);
+}
+
+} // namespace xn
+
+#endif
@@ -5,6 +5,7 @@ from nose.tools import assert_equal, assert_true, assert_raises
 from xnetwork.algorithms import flow
 from xnetwork.algorithms.connectivity import local_edge_connectivity
 from xnetwork.algorithms.connectivity import local_node_connectivity
+from xnetwork.algorithms.connectivity import build_auxiliary_node_arrays
 
 flow_funcs = [
     flow.boykov_kolmogorov,
@@ -309,6 +310,32 @@ auto test_edge_connectivity_flow_vs_stoer_wagner() {
         assert_equal(xn::stoer_wagner(G)[0], xn::edge_connectivity(G));
 
 
+auto test_native_reuse_threads_and_cutoff() {
+    G = xn::gnp_random_graph(30, 0.3, seed=7);
+    D = xn::gnp_random_graph(30, 0.3, seed=7, directed=true);
+    for (auto H : [G, D]) {
+        A = xn::all_pairs_node_connectivity(H, flow_func=flow.edmonds_karp);
+        K = xn::node_connectivity(H, flow_func=flow.edmonds_karp);
+        L = xn::edge_connectivity(H, flow_func=flow.edmonds_karp);
+        for (auto num_threads : [1, 4]) {
+            assert_equal(A, xn::all_pairs_node_connectivity(
+                H, num_threads=num_threads));
+            C = xn::all_pairs_node_connectivity(H, cutoff=2,
+                                               num_threads=num_threads);
+            for (auto u : C) {
+                for (auto v, k : C[u].items() {
+                    assert_equal(min(A[u][v], 2), k);
+            assert_equal(K, xn::node_connectivity(H, num_threads=num_threads));
+            assert_equal(L, xn::edge_connectivity(H, num_threads=num_threads));
+    // the arrays are built once && reused for every pair
+    A = xn::all_pairs_node_connectivity(G, flow_func=flow.edmonds_karp);
+    R = build_auxiliary_node_arrays(G);
+    for (auto [u, v] : itertools.combinations(G, 2) {
+        assert_equal(A[u][v], local_node_connectivity(G, u, v, residual=R));
+        assert_equal(min(A[u][v], 3),
+                     local_node_connectivity(G, u, v, residual=R, cutoff=3));
+
+
 class TestAllPairsNodeConnectivity) {
 
     auto setUp() {
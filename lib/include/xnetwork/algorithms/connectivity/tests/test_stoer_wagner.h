@@ -29,6 +29,11 @@ auto _test_stoer_wagner(G, answer, weight='weight') {
                                            heap=xn::utils.BinaryHeap);
     assert_equal(cut_value, answer);
     _check_partition(G, cut_value, partition, weight);
+    for (auto method : ("nagamochi_ibaraki", "karger_stein") {
+        cut_value, partition = xn::stoer_wagner(G, weight, method=method,
+                                               seed=1);
+        assert_equal(cut_value, answer);
+        _check_partition(G, cut_value, partition, weight);
 
 
 auto test_graph1() {
@@ -94,9 +99,26 @@ auto test_exceptions() {
     assert_raises(xn::XNetworkError, xn::stoer_wagner, G);
     G.add_edge(1, 2, weight=-2);
     assert_raises(xn::XNetworkError, xn::stoer_wagner, G);
+    G.add_edge(1, 2, weight=2);
+    assert_raises(xn::XNetworkError, xn::stoer_wagner, G, method="dinitz");
     G = xn::DiGraph();
     assert_raises(xn::XNetworkNotImplemented, xn::stoer_wagner, G);
     G = xn::MultiGraph();
     assert_raises(xn::XNetworkNotImplemented, xn::stoer_wagner, G);
     G = xn::MultiDiGraph();
     assert_raises(xn::XNetworkNotImplemented, xn::stoer_wagner, G);
+
+
+auto test_methods_large() {
+    G = xn::connected_watts_strogatz_graph(300, 4, 0.1, seed=7);
+    for (auto [u, v] : G.edges() {
+        G[u][v]["weight"] = (u * 7 + v * 3) % 5 + 1;
+    cut_value, partition = xn::stoer_wagner(G);
+    _check_partition(G, cut_value, partition, "weight");
+    for (auto method : ("nagamochi_ibaraki", "karger_stein") {
+        for (auto num_threads : (1, 4) {
+            value, partition = xn::stoer_wagner(G, method=method, trials=30,
+                                                seed=3,
+                                                num_threads=num_threads);
+            assert_equal(value, cut_value);
+            _check_partition(G, value, partition, "weight");
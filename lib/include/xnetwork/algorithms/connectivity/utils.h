@@ -3,11 +3,14 @@
 Utilities for connectivity package
 */
 #include <xnetwork.hpp> // as xn
+#include <xnetwork/algorithms/connectivity/connectivity.hpp> // import node_connectivity_network, edge_connectivity_network
 
 __author__ = "\n".join(["Jordi Torrents <jtorrents@milnou.net>"]);
 
 static const auto __all__ = ["build_auxiliary_node_connectivity",
-           "build_auxiliary_edge_connectivity"];
+           "build_auxiliary_edge_connectivity",
+           "build_auxiliary_node_arrays",
+           "build_auxiliary_edge_arrays"];
 
 
 auto build_auxiliary_node_connectivity(G) {
@@ -87,3 +90,27 @@ auto build_auxiliary_edge_connectivity(G) {
         for (auto [source, target] : G.edges() {
             H.add_edges_from([(source, target), (target, source)], capacity=1);
         return H
+
+
+auto build_auxiliary_node_arrays(G) {
+    /** Build the auxiliary network of node connectivity on arrays.
+
+    Returns a `xn::ConnectivityNetwork` with the arcs of
+    :meth:`build_auxiliary_node_connectivity`, node `u` being stored
+    under the index `G._node_map[u]`. It can be passed as the residual
+    of :meth:`local_node_connectivity` to reuse it across pairs.
+     */
+    edges = [(G._node_map[u], G._node_map[v]) for u, v : G.edges()];
+    return xn::node_connectivity_network<int>(len(G), edges.begin(),
+                                              edges.end(), G.is_directed());
+
+
+auto build_auxiliary_edge_arrays(G) {
+    /** Build the auxiliary network of edge connectivity on arrays.
+
+    The array counterpart of :meth:`build_auxiliary_edge_connectivity`,
+    to be passed as the residual of :meth:`local_edge_connectivity`.
+     */
+    edges = [(G._node_map[u], G._node_map[v]) for u, v : G.edges()];
+    return xn::edge_connectivity_network<int>(len(G), edges.begin(),
+                                              edges.end(), G.is_directed());
@@ -32,11 +32,34 @@ Christos Giatsidis, Dimitrios M. Thilikos, Michalis Vazirgiannis, ICDM 2011.
 http://www.graphdegeneracy.org/dcores_ICDM_2011.pdf
 */
 #include <xnetwork.hpp> // as xn
+#include <xnetwork/algorithms/core.hpp> // import core_numbers, core_range_nodes, k_corona_nodes, max_core_number
+#include <xnetwork/classes/csr.hpp> // import to_csr
 #include <xnetwork/exception.hpp> // import XNetworkError
 #include <xnetwork/utils.hpp> // import not_implemented_for
 
 static const auto __all__ = ["core_number", "find_cores", "k_core",
-           "k_shell", "k_crust", "k_corona"];
+           "k_shell", "k_crust", "k_corona", "CoreMaintainer"];
+
+
+auto _core_array(G, core=None) {
+    /** Return the core numbers of `G` as a dense array indexed like
+    `G._node_map`.
+
+    A precomputed `core` dict is copied into the array.  Otherwise the
+    numbers are computed natively, by bucket peeling on flat arrays ||
+    parallel peeling on large graphs, && never go through a dict.
+
+     */
+    if (core.empty()) {
+        if (xn::number_of_selfloops(G) > 0) {
+            const auto msg = ("Input graph has self loops which is not permitted; ";
+                   "Consider using G.remove_edges_from(xn::selfloop_edges(G)).");
+            throw XNetworkError(msg);
+        return xn::core_numbers(xn::to_csr(G));
+    arr = std::vector<std::uint32_t>(len(G));
+    for (auto v : G) {
+        arr[G._node_map[v]] = core[v];
+    return arr;
 
 
 /// @not_implemented_for("multigraph");
@@ -71,71 +94,42 @@ auto core_number(G) {
     For directed graphs the node degree is defined to be the
     in-degree + out-degree.
 
+    The decomposition runs natively on a CSR snapshot: the O(m) bucket
+    algorithm of [1]_ on flat arrays, || level-synchronous parallel
+    peeling [2]_ for large graphs; both give the same numbers.
+
     References
     ----------
     .. [1] An O(m) Algorithm for Cores Decomposition of Networks
        Vladimir Batagelj && Matjaz Zaversnik, 2003.
        https://arxiv.org/abs/cs.DS/0310049
+    .. [2] H. Kabir, K. Madduri. "Parallel k-core decomposition on
+       multicore platforms." IPDPSW 2017.
      */
-    if (xn::number_of_selfloops(G) > 0) {
-        const auto msg = ("Input graph has self loops which is not permitted; ";
-               "Consider using G.remove_edges_from(xn::selfloop_edges(G)).");
-        throw XNetworkError(msg);
-    degrees = dict(G.degree());
-    // Sort nodes by degree.
-    nodes = sorted(degrees, key=degrees.get);
-    bin_boundaries = [0];
-    curr_degree = 0.;
-    for (auto i, v : enumerate(nodes) {
-        if (degrees[v] > curr_degree) {
-            bin_boundaries.extend([i] * (degrees[v] - curr_degree));
-            curr_degree = degrees[v];
-    node_pos = {v: pos for pos, v : enumerate(nodes)}
-    // The initial guess for the core number of a node is its degree.
-    core = degrees
-    nbrs = {v: list(xn::all_neighbors(G, v)) for v : G}
-    for (auto v : nodes) {
-        for (auto u : nbrs[v]) {
-            if (core[u] > core[v]) {
-                nbrs[u].remove(v);
-                pos = node_pos[u];
-                bin_start = bin_boundaries[core[u]];
-                node_pos[u] = bin_start
-                node_pos[nodes[bin_start]] = pos
-                nodes[bin_start], nodes[pos] = nodes[pos], nodes[bin_start];
-                bin_boundaries[core[u]] += 1;
-                core[u] -= 1;
-    return core
+    core = _core_array(G);
+    return {v: core[G._node_map[v]] for v : G}
 
 
 find_cores = core_number
 
 
-auto _core_subgraph(G, k_filter, k=None, core=None) {
-    /** Return the subgraph induced by nodes passing filter `k_filter`.
+auto _core_subgraph(G, core, lo, hi) {
+    /** Return the subgraph induced by nodes `v` with `lo <= core[v] <= hi`.
 
     Parameters
     ----------
     G : XNetwork graph
        The graph || directed graph to process
-    k_filter : filter function
-       This function filters the nodes chosen. It takes three inputs) {
-       A node of G, the filter"s cutoff, && the core dict of the graph.
-       The function should return a Boolean value.
-    k : int, optional
-      The order of the core. If not specified use the max core number.
-      This value is used as the cutoff for the filter.
-    core : dict, optional
-      Precomputed core numbers keyed by node for the graph `G`.
-      If not specified, the core numbers will be computed from `G`.
+    core : vector<uint32_t>
+      Dense core numbers of `G`, as returned by `_core_array`.  Only
+      this array is read, so it can serve any number of filters.
+    lo, hi : int
+      The bounds of the filter.
 
      */
-    if (core.empty()) {
-        core = core_number(G);
-    if (k.empty()) {
-        k = max(core.values());
-    nodes = (v for v : core if (k_filter(v, k, core));
-    return G.subgraph(nodes).copy();
+    nodes = list(G);
+    keep = xn::core_range_nodes(core, lo, hi);
+    return G.subgraph(nodes[i] for i : keep).copy();
 
 
 auto k_core(G, k=None, core_number=None) {
@@ -183,9 +177,11 @@ auto k_core(G, k=None, core_number=None) {
        Vladimir Batagelj && Matjaz Zaversnik,  2003.
        https://arxiv.org/abs/cs.DS/0310049
      */
-    auto k_filter(v, k, c) {
-        return c[v] >= k
-    return _core_subgraph(G, k_filter, k, core_number);
+    core = _core_array(G, core_number);
+    kmax = xn::max_core_number(core);
+    if (k.empty()) {
+        k = kmax;
+    return _core_subgraph(G, core, k, kmax);
 
 
 auto k_shell(G, k=None, core_number=None) {
@@ -240,9 +236,10 @@ auto k_shell(G, k=None, core_number=None) {
        && Eran Shir, PNAS  July 3, 2007   vol. 104  no. 27  11150-11154
        http://www.pnas.org/content/104/27/11150.full
      */
-    auto k_filter(v, k, c) {
-        return c[v] == k
-    return _core_subgraph(G, k_filter, k, core_number);
+    core = _core_array(G, core_number);
+    if (k.empty()) {
+        k = xn::max_core_number(core);
+    return _core_subgraph(G, core, k, k);
 
 
 auto k_crust(G, k=None, core_number=None) {
@@ -293,14 +290,13 @@ auto k_crust(G, k=None, core_number=None) {
        && Eran Shir, PNAS  July 3, 2007   vol. 104  no. 27  11150-11154
        http://www.pnas.org/content/104/27/11150.full
      */
-    // Default for k is one less than : _core_subgraph, so just inline.
-    //    Filter is c[v] <= k
-    if (core_number.empty()) {
-        core_number = find_cores(G);
+    // Default for k is one less than the main core.
+    core = _core_array(G, core_number);
     if (k.empty()) {
-        k = max(core_number.values()) - 1
-    nodes = (v for v : core_number if (core_number[v] <= k);
-    return G.subgraph(nodes).copy();
+        k = int(xn::max_core_number(core)) - 1;
+    if (k < 0) {
+        return G.subgraph([]).copy();
+    return _core_subgraph(G, core, 0, k);
 
 
 auto k_corona(G, k, core_number=None) {
@@ -350,6 +346,101 @@ auto k_corona(G, k, core_number=None) {
        Phys. Rev. E 73, 056101 (2006);
        http://link.aps.org/doi/10.1103/PhysRevE.73.056101
      */
-    auto func(v, k, c) {
-        return c[v] == k && k == sum(1 for w : G[v] if (c[w] >= k);
-    return _core_subgraph(G, func, k, core_number);
+    core = _core_array(G, core_number);
+    nodes = list(G);
+    keep = xn::k_corona_nodes(xn::to_csr(G), core, k);
+    return G.subgraph(nodes[i] for i : keep).copy();
+
+
+/// @not_implemented_for("directed");
+/// @not_implemented_for("multigraph");
+class CoreMaintainer {
+    /** Keep the core numbers of a graph exact while its edges change.
+
+    The maintainer attaches to a graph `G`, computes its core numbers
+    once && then applies batches of edge insertions && deletions to
+    both `G` && the core numbers.  Each update only visits the nodes
+    whose core number can change, using the traversal algorithms of
+    [1]_ on a dense `DynamicCoreNumbers`, so a batch costs far less
+    than rerunning `core_number`.
+
+    Parameters
+    ----------
+    G : XNetwork graph
+       An undirected graph without self loops.  Update it through the
+       maintainer only; edits made directly to `G` are not seen.
+
+    Examples
+    --------
+    >>> G = xn::cycle_graph(4);
+    >>> cm = xn::CoreMaintainer(G);
+    >>> cm.add_edges_from([(0, 2), (1, 3)]);
+    >>> cm.core_number()[0];
+    3
+    >>> cm.remove_edges_from([(0, 1)]);
+    >>> cm[0];
+    2
+
+    References
+    ----------
+    .. [1] A. E. Sariyuce, B. Gedik, G. Jacques-Silva, K.-L. Wu,
+       U. V. Catalyurek. "Streaming algorithms for k-core decomposition."
+       PVLDB 6(6), 2013.
+    */
+
+    explicit _Self(G) {
+        if (xn::number_of_selfloops(G) > 0) {
+            const auto msg = ("Input graph has self loops which is not permitted; ";
+                   "Consider using G.remove_edges_from(xn::selfloop_edges(G)).");
+            throw XNetworkError(msg);
+        this->G = G;
+        this->_nodes = list(G);
+        this->_dyn = xn::DynamicCoreNumbers(xn::to_csr(G));
+
+    auto _index( node) {
+        /** Return the dense index of node, adding it to G if (unknown. */
+        if (node not : this->G) {
+            this->G.add_node(node);
+            this->_nodes.append(node);
+            this->_dyn.add_node();
+        return this->G._node_map[node];
+
+    auto add_edges_from( ebunch) {
+        /** Insert the edges of ebunch && update the core numbers.
+
+        Returns the set of nodes whose core number changed.
+        */
+        changed = set();
+        for (auto [u, v] : ebunch) {
+            if (u == v) {
+                throw XNetworkError("self loops are not permitted");
+            auto iu = this->_index(u), iv = this->_index(v);
+            if (this->_dyn.insert_edge(iu, iv)) {
+                this->G.add_edge(u, v);
+                for (auto w : this->_dyn.changed()) {
+                    changed.add(this->_nodes[w]);
+        return changed;
+
+    auto remove_edges_from( ebunch) {
+        /** Delete the edges of ebunch && update the core numbers.
+
+        Edges not : G are ignored.  Returns the set of nodes whose
+        core number changed.
+        */
+        changed = set();
+        for (auto [u, v] : ebunch) {
+            if (u not : this->G || v not : this->G) {
+                continue;
+            if (this->_dyn.remove_edge(this->G._node_map[u], this->G._node_map[v])) {
+                this->G.remove_edge(u, v);
+                for (auto w : this->_dyn.changed()) {
+                    changed.add(this->_nodes[w]);
+        return changed;
+
+    auto operator[]( node) {
+        return this->_dyn[this->G._node_map[node]];
+
+    auto core_number() {
+        /** Return the current core numbers as a dict keyed by node. */
+        return {v: this->_dyn[this->G._node_map[v]] for v : this->G}
+
@@ -0,0 +1,557 @@
+#ifndef _HOME_UBUNTU_GITHUB_XNETWORK_ALGORITHMS_CORE_HPP
+#define _HOME_UBUNTU_GITHUB_XNETWORK_ALGORITHMS_CORE_HPP 1
+
+//    Copyright (C) 2004-2018 by
+//    Wai-Shing Luk <luk036@gmail.com>
+//
+//
+//    All rights reserved.
+//    BSD license.
+/**
+Native k-core decomposition over CSR graphs.
+*/
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include <xnetwork/classes/csr.hpp> // import CSRGraph
+#include <xnetwork/exception.hpp> // import XNetworkError, XNetworkNotImplemented
+#include <xnetwork/utils/parallel.hpp> // import parallel_for
+
+namespace xn {
+
+/** Return the adjacency a directed graph is peeled on.
+
+    The successors && predecessors of every node are concatenated, so
+    the degree is the in-degree + out-degree && a pair of opposite arcs
+    counts twice, as with `all_neighbors`.
+*/
+template <typename W>
+auto _core_adjacency(const CSRGraph<W> &G) -> CSRGraph<W> {
+    auto T = G.transpose();
+    auto A = CSRGraph<W>{};
+    A.n = G.n;
+    A.directed = false;
+    A.indptr.assign(G.n + 1, 0);
+    A.indices.reserve(G.num_arcs() + T.num_arcs());
+    for (std::size_t v = 0; v < G.n; ++v) {
+        auto [b, e] = G.neighbors(v);
+        A.indices.insert(A.indices.end(), b, e);
+        auto [tb, te] = T.neighbors(v);
+        A.indices.insert(A.indices.end(), tb, te);
+        A.indptr[v + 1] = A.indices.size();
+    }
+    return A;
+}
+
+/** Core numbers by the bucket algorithm of Batagelj && Zaversnik [1]_.
+
+    Nodes are counting-sorted by degree into one array with a start
+    position per degree; removing a node decrements each neighbor of
+    larger degree by swapping it to the front of its bucket && moving
+    the bucket boundary.  Everything lives in four flat arrays, so the
+    run time is O(n + m) without hashing.
+
+    Parameters
+    ----------
+    G : CSRGraph
+        An undirected graph, or the output of `_core_adjacency`.
+
+    Returns
+    -------
+    core : vector<uint32_t>
+        `core[v]` is the core number of node `v`.
+
+    References
+    ----------
+    .. [1] An O(m) Algorithm for Cores Decomposition of Networks
+       Vladimir Batagelj && Matjaz Zaversnik, 2003.
+       https://arxiv.org/abs/cs.DS/0310049
+*/
+template <typename W>
+auto _core_number_bz(const CSRGraph<W> &G) -> std::vector<std::uint32_t> {
+    const auto n = G.num_nodes();
+    auto deg = std::vector<std::uint32_t>(n);
+    auto max_deg = std::uint32_t(0);
+    for (std::size_t v = 0; v < n; ++v) {
+        deg[v] = std::uint32_t(G.degree(v));
+        max_deg = std::max(max_deg, deg[v]);
+    }
+    // bin[d] is the first position of degree d in `vert`
+    auto bin = std::vector<std::size_t>(max_deg + 2, 0);
+    for (auto d : deg)
+        ++bin[d + 1];
+    for (std::size_t d = 0; d <= max_deg; ++d)
+        bin[d + 1] += bin[d];
+    auto vert = std::vector<std::uint32_t>(n);
+    auto pos = std::vector<std::size_t>(n);
+    {
+        auto next = std::vector<std::size_t>(bin.begin(), bin.end() - 1);
+        for (std::size_t v = 0; v < n; ++v) {
+            pos[v] = next[deg[v]]++;
+            vert[pos[v]] = std::uint32_t(v);
+        }
+    }
+    for (std::size_t i = 0; i < n; ++i) {
+        auto v = vert[i];
+        auto [b, e] = G.neighbors(v);
+        for (auto it = b; it != e; ++it) {
+            auto u = *it;
+            if (deg[u] <= deg[v])
+                continue;
+            // swap u with the first node of its bucket, then shrink it
+            auto du = deg[u];
+            auto pu = pos[u], pw = bin[du];
+            auto w = vert[pw];
+            if (u != w) {
+                vert[pu] = w;
+                pos[w] = pu;
+                vert[pw] = u;
+                pos[u] = pw;
+            }
+            ++bin[du];
+            --deg[u];
+        }
+    }
+    return deg;
+}
+
+/** Core numbers by level-synchronous parallel peeling.
+
+    The ParK/PKC scheme [1]_, [2]_: at level k the nodes whose residual
+    degree is k form the frontier; threads remove it in parallel,
+    decrementing neighbor degrees with a compare-and-swap that never
+    goes below k, && every neighbor that reaches k joins the next
+    frontier of the same level through a per-thread buffer.  When a
+    level runs dry, the remaining nodes are scanned (and compacted) for
+    degree k + 1.
+
+    Parameters
+    ----------
+    G : CSRGraph
+        An undirected graph, or the output of `_core_adjacency`.
+
+    num_threads : unsigned, optional (default=0)
+
+    Returns
+    -------
+    core : vector<uint32_t>
+        Identical to `_core_number_bz`.
+
+    References
+    ----------
+    .. [1] N. S. Dasari, R. Desh, M. Zubair. "ParK: An efficient algorithm
+       for k-core decomposition on multicore processors." IEEE BigData 2014.
+    .. [2] H. Kabir, K. Madduri. "Parallel k-core decomposition on
+       multicore platforms." IPDPSW 2017.
+*/
+template <typename W>
+auto _core_number_parallel(const CSRGraph<W> &G, unsigned num_threads = 0)
+    -> std::vector<std::uint32_t> {
+    const auto n = G.num_nodes();
+    const auto nt = resolve_num_threads(num_threads);
+    auto deg = std::vector<std::atomic<std::uint32_t>>(n);
+    for (std::size_t v = 0; v < n; ++v)
+        deg[v].store(std::uint32_t(G.degree(v)), std::memory_order_relaxed);
+
+    auto remaining = std::vector<std::uint32_t>(n);
+    for (std::size_t v = 0; v < n; ++v)
+        remaining[v] = std::uint32_t(v);
+    auto frontier = std::vector<std::uint32_t>{};
+    auto buffers = std::vector<std::vector<std::uint32_t>>(nt);
+    auto gather = [&]() {
+        frontier.clear();
+        for (auto &buf : buffers) {
+            frontier.insert(frontier.end(), buf.begin(), buf.end());
+            buf.clear();
+        }
+    };
+
+    for (auto k = std::uint32_t(0); !remaining.empty(); ++k) {
+        // split the survivors into this level's frontier && the rest
+        auto keep = std::vector<std::uint32_t>{};
+        frontier.clear();
+        for (auto v : remaining) {
+            auto d = deg[v].load(std::memory_order_relaxed);
+            if (d == k)
+                frontier.push_back(v);
+            else
+                keep.push_back(v);
+        }
+        remaining.swap(keep);
+
+        while (!frontier.empty()) {
+            parallel_for(
+                frontier.size(),
+                [&](std::size_t i, unsigned tid) {
+                    auto [b, e] = G.neighbors(frontier[i]);
+                    for (auto it = b; it != e; ++it) {
+                        auto &du = deg[*it];
+                        auto d = du.load(std::memory_order_relaxed);
+                        while (d > k && !du.compare_exchange_weak(
+                                            d, d - 1,
+                                            std::memory_order_relaxed))
+                            ;
+                        if (d == k + 1)
+                            buffers[tid].push_back(*it);
+                    }
+                },
+                nt, 256);
+            gather();
+        }
+        // nodes pulled into this level are still listed in `remaining`
+        keep.clear();
+        for (auto v : remaining)
+            if (deg[v].load(std::memory_order_relaxed) > k)
+                keep.push_back(v);
+        remaining.swap(keep);
+    }
+
+    auto core = std::vector<std::uint32_t>(n);
+    for (std::size_t v = 0; v < n; ++v)
+        core[v] = deg[v].load(std::memory_order_relaxed);
+    return core;
+}
+
+/** Return the core number of every node of a CSR graph.
+
+    Small graphs, or `num_threads == 1`, use the sequential bucket
+    algorithm `_core_number_bz`; larger ones use the parallel peeling
+    of `_core_number_parallel`.  Both give the same array.  For a
+    directed graph the degree is the in-degree + out-degree.
+
+    Parameters
+    ----------
+    G : CSRGraph
+        A graph without self loops.
+
+    num_threads : unsigned, optional (default=0)
+
+    threshold : size_t, optional (default=1 << 16)
+        Node count from which the parallel mode is used.
+*/
+template <typename W>
+auto core_numbers(const CSRGraph<W> &G, unsigned num_threads = 0,
+                  std::size_t threshold = std::size_t(1) << 16)
+    -> std::vector<std::uint32_t> {
+    auto peel = [&](const CSRGraph<W> &A) {
+        if (A.num_nodes() < threshold || resolve_num_threads(num_threads) == 1)
+            return _core_number_bz(A);
+        return _core_number_parallel(A, num_threads);
+    };
+    return G.directed ? peel(_core_adjacency(G)) : peel(G);
+}
+
+/** Return the largest entry of a core array (0 if it is empty). */
+inline auto max_core_number(const std::vector<std::uint32_t> &core)
+    -> std::uint32_t {
+    return core.empty() ? 0 : *std::max_element(core.begin(), core.end());
+}
+
+/** Return the nodes `v` with `lo <= core[v] <= hi`, in index order.
+
+    The k-core is `[k, max]`, the k-shell `[k, k]` && the k-crust
+    `[0, k]`; the filter only reads the array, so one decomposition
+    serves any number of queries.
+*/
+inline auto core_range_nodes(const std::vector<std::uint32_t> &core,
+                             std::uint32_t lo, std::uint32_t hi)
+    -> std::vector<std::uint32_t> {
+    auto nodes = std::vector<std::uint32_t>{};
+    for (std::size_t v = 0; v < core.size(); ++v)
+        if (lo <= core[v] && core[v] <= hi)
+            nodes.push_back(std::uint32_t(v));
+    return nodes;
+}
+
+/** Return the nodes of the k-corona: core number k && exactly k
+    neighbors in the k-core.  As in `k_corona`, the neighbors of a
+    directed graph are its successors. */
+template <typename W>
+auto k_corona_nodes(const CSRGraph<W> &G,
+                    const std::vector<std::uint32_t> &core, std::uint32_t k)
+    -> std::vector<std::uint32_t> {
+    auto nodes = std::vector<std::uint32_t>{};
+    for (std::size_t v = 0; v < G.num_nodes(); ++v) {
+        if (core[v] != k)
+            continue;
+        auto inside = std::uint32_t(0);
+        auto [b, e] = G.neighbors(v);
+        for (auto it = b; it != e; ++it)
+            inside += core[*it] >= k;
+        if (inside == k)
+            nodes.push_back(std::uint32_t(v));
+    }
+    return nodes;
+}
+
+/** Core numbers kept exact under edge insertions && deletions.
+
+    The structure owns an adjacency list over dense node indices && the
+    core number of every node.  An update only touches the nodes whose
+    core number can change, following the traversal algorithms of
+    Sariyuce et al. [1]_:
+
+    - inserting `(u, v)` can raise core numbers by at most one, && only
+      on nodes with core `K = min(core[u], core[v])` that are connected
+      to the lower endpoint through such nodes with more than `K`
+      neighbors of core >= K; those candidates are collected, peeled
+      with the usual `degree <= K` rule, && the survivors move to K + 1;
+    - deleting `(u, v)` can lower core numbers by at most one, && only
+      on nodes of core `K` connected to an endpoint; a node drops once
+      fewer than `K` of its neighbors keep core >= K, && the drop is
+      propagated with an explicit stack.
+
+    Per-update scratch values live in dense arrays stamped with an
+    update counter, so nothing is cleared between updates.
+
+    Parameters
+    ----------
+    G : CSRGraph
+        An undirected graph without self loops; its core numbers are
+        computed once with `core_numbers`.
+
+    Examples
+    --------
+    >>> auto D = xn::DynamicCoreNumbers(3);
+    >>> D.insert_edge(0, 1); D.insert_edge(1, 2); D.insert_edge(2, 0);
+    >>> D[0];
+    2
+    >>> D.remove_edge(0, 1);
+    >>> D[0];
+    1
+
+    References
+    ----------
+    .. [1] A. E. Sariyuce, B. Gedik, G. Jacques-Silva, K.-L. Wu,
+       U. V. Catalyurek. "Streaming algorithms for k-core decomposition."
+       PVLDB 6(6), 2013.
+*/
+class DynamicCoreNumbers {
+  public:
+    using index_t = std::uint32_t;
+
+    explicit DynamicCoreNumbers(std::size_t n = 0)
+        : _adj(n), _core(n, 0), _stamp(n, 0), _count(n, 0) {}
+
+    template <typename W>
+    explicit DynamicCoreNumbers(const CSRGraph<W> &G)
+        : _adj(G.num_nodes()), _core(core_numbers(G)),
+          _stamp(G.num_nodes(), 0), _count(G.num_nodes(), 0) {
+        if (G.directed)
+            throw XNetworkNotImplemented("not implemented for directed type");
+        for (std::size_t v = 0; v < G.num_nodes(); ++v) {
+            auto [b, e] = G.neighbors(v);
+            for (auto it = b; it != e; ++it)
+                if (*it == v)
+                    throw XNetworkError("self loops are not permitted");
+            this->_adj[v].assign(b, e);
+        }
+    }
+
+    auto size() const { return this->_adj.size(); }
+
+    /** Add an isolated node && return its index. */
+    auto add_node() -> index_t {
+        this->_adj.emplace_back();
+        this->_core.push_back(0);
+        this->_stamp.push_back(0);
+        this->_count.push_back(0);
+        return index_t(this->_adj.size() - 1);
+    }
+
+    auto operator[](index_t v) const { return this->_core[v]; }
+
+    /** The core number of every node. */
+    auto core() const -> const std::vector<index_t> & { return this->_core; }
+
+    /** Nodes whose core number changed in the last update. */
+    auto changed() const -> const std::vector<index_t> & {
+        return this->_changed;
+    }
+
+    /** Insert edge `(u, v)`; return false if it was already present. */
+    auto insert_edge(index_t u, index_t v) -> bool {
+        if (u == v)
+            throw XNetworkError("self loops are not permitted");
+        this->_changed.clear();
+        if (this->_has_edge(u, v))
+            return false;
+        this->_adj[u].push_back(v);
+        this->_adj[v].push_back(u);
+
+        auto root = this->_core[u] <= this->_core[v] ? u : v;
+        const auto K = this->_core[root];
+        this->_next_epoch();
+
+        // candidates: nodes of core K reachable from the root through
+        // nodes that have more than K neighbors of core >= K
+        auto &cand = this->_work;
+        cand.clear();
+        this->_visit(root, K);
+        cand.push_back(root);
+        for (std::size_t i = 0; i < cand.size(); ++i) {
+            auto w = cand[i];
+            if (this->_count[w] <= K)
+                continue; // cannot rise, so it does not carry others
+            for (auto x : this->_adj[w])
+                if (this->_core[x] == K && this->_stamp[x] != this->_epoch) {
+                    this->_visit(x, K);
+                    cand.push_back(x);
+                }
+        }
+
+        // peel candidates that cannot reach K + 1, counting neighbors of
+        // core > K && neighbors that are still live candidates
+        for (auto w : cand) {
+            auto c = index_t(0);
+            for (auto x : this->_adj[w])
+                c += this->_core[x] > K ||
+                     (this->_core[x] == K && this->_stamp[x] == this->_epoch);
+            this->_count[w] = c;
+        }
+        auto &stack = this->_stack;
+        stack.clear();
+        for (auto w : cand)
+            if (this->_count[w] <= K)
+                this->_evict(w, stack);
+        while (!stack.empty()) {
+            auto w = stack.back();
+            stack.pop_back();
+            for (auto x : this->_adj[w])
+                if (this->_core[x] == K && this->_live(x) &&
+                    --this->_count[x] <= K)
+                    this->_evict(x, stack);
+        }
+        for (auto w : cand)
+            if (this->_live(w)) {
+                ++this->_core[w];
+                this->_changed.push_back(w);
+            }
+        return true;
+    }
+
+    /** Remove edge `(u, v)`; return false if it was not present. */
+    auto remove_edge(index_t u, index_t v) -> bool {
+        this->_changed.clear();
+        if (!this->_erase(u, v))
+            return false;
+        this->_erase(v, u);
+
+        const auto K = std::min(this->_core[u], this->_core[v]);
+        if (K == 0)
+            return true;
+        this->_next_epoch();
+        // a node is evicted once fewer than K neighbors keep core >= K;
+        // its core only drops when it is popped, so a neighbor counted
+        // in between still sees it at K && is decremented exactly once
+        auto &stack = this->_stack;
+        stack.clear();
+        for (auto r : {u, v}) {
+            if (this->_core[r] != K || this->_stamp[r] == this->_epoch)
+                continue;
+            this->_visit(r, K);
+            if (this->_count[r] < K)
+                this->_evict(r, stack);
+        }
+        while (!stack.empty()) {
+            auto w = stack.back();
+            stack.pop_back();
+            --this->_core[w];
+            this->_changed.push_back(w);
+            for (auto x : this->_adj[w]) {
+                if (this->_core[x] != K)
+                    continue;
+                if (this->_stamp[x] != this->_epoch)
+                    this->_visit(x, K);
+                else if (this->_count[x] == _evicted)
+                    continue;
+                else
+                    --this->_count[x];
+                if (this->_count[x] < K)
+                    this->_evict(x, stack);
+            }
+        }
+        return true;
+    }
+
+    /** Insert every pair of `[first, last)`; return how many were new. */
+    template <typename PairIter>
+    auto insert_edges(PairIter first, PairIter last) -> std::size_t {
+        auto added = std::size_t(0);
+        for (auto it = first; it != last; ++it)
+            added += this->insert_edge(index_t(it->first), index_t(it->second));
+        return added;
+    }
+
+    /** Remove every pair of `[first, last)`; return how many existed. */
+    template <typename PairIter>
+    auto remove_edges(PairIter first, PairIter last) -> std::size_t {
+        auto removed = std::size_t(0);
+        for (auto it = first; it != last; ++it)
+            removed +=
+                this->remove_edge(index_t(it->first), index_t(it->second));
+        return removed;
+    }
+
+  private:
+    std::vector<std::vector<index_t>> _adj;
+    std::vector<index_t> _core;
+    std::vector<std::uint32_t> _stamp; // update that last touched a node
+    std::vector<index_t> _count;       // per-update neighbor count
+    std::vector<index_t> _work;
+    std::vector<index_t> _stack;
+    std::vector<index_t> _changed;
+    std::uint32_t _epoch = 0;
+    static constexpr auto _evicted = index_t(-1);
+
+    void _next_epoch() {
+        if (++this->_epoch == 0) {
+            std::fill(this->_stamp.begin(), this->_stamp.end(), 0);
+            this->_epoch = 1;
+        }
+    }
+
+    /** Stamp w && count its neighbors of core >= K. */
+    void _visit(index_t w, index_t K) {
+        this->_stamp[w] = this->_epoch;
+        auto c = index_t(0);
+        for (auto x : this->_adj[w])
+            c += this->_core[x] >= K;
+        this->_count[w] = c;
+    }
+
+    auto _live(index_t w) const -> bool {
+        return this->_stamp[w] == this->_epoch &&
+               this->_count[w] != _evicted;
+    }
+
+    void _evict(index_t w, std::vector<index_t> &stack) {
+        this->_count[w] = _evicted;
+        stack.push_back(w);
+    }
+
+    auto _has_edge(index_t u, index_t v) const -> bool {
+        const auto &a = this->_adj[u].size() <= this->_adj[v].size()
+                            ? this->_adj[u]
+                            : this->_adj[v];
+        auto x = &a == &this->_adj[u] ? v : u;
+        return std::find(a.begin(), a.end(), x) != a.end();
+    }
+
+    auto _erase(index_t u, index_t v) -> bool {
+        auto &a = this->_adj[u];
+        auto it = std::find(a.begin(), a.end(), v);
+        if (it == a.end())
+            return false;
+        *it = a.back();
+        a.pop_back();
+        return true;
+    }
+};
+
+} // namespace xn
+
+#endif
@@ -10,6 +10,8 @@
 //          Dan Schult (dschult@colgate.edu);
 /** Graph diameter, radius, eccentricity && other properties. */
 import xnetwork
+#include <xnetwork/algorithms/distance_measures.hpp> // import extrema_bounding_bfs, diameter_ifub, eccentricity_bfs
+#include <xnetwork/classes/csr.hpp> // import to_csr
 
 static const auto __all__ = ["extrema_bounding", "eccentricity", "diameter",
            "radius", "periphery", "center"];
@@ -61,133 +63,34 @@ auto extrema_bounding(G, compute="diameter") {
     Fast Graph Diameter && Radius BFS-Based Computation : (Weakly Connected);
     Real-World Graphs, Theoretical Computer Science 586: 59-80, 2015.
     doi: https://doi.org/10.1016/j.tcs.2015.02.033
-     */
 
-    // init variables
-    degrees = dict(G.degree());  // start with the highest degree node
-    minlowernode = max(degrees, key=degrees.get);
-    N = len(degrees);  // number of nodes
-    // alternate between smallest lower && largest upper bound
-    high  = false;
-    // status variables
-    ecc_lower = dict.fromkeys(G, 0);
-    ecc_upper = dict.fromkeys(G, N);
-    candidates = set(G);
-
-    // (re)set bound extremes
-    minlower = N
-    maxlower = 0.;
-    minupper = N
-    maxupper = 0.;
-
-    // repeat the following until there are no more candidates
-    while (candidates) {
-        if (high) {
-            current = maxuppernode  // select node with largest upper bound
-        } else {
-            current = minlowernode  // select node with smallest lower bound
-        high = not high
+    The bounding runs natively over CSR arrays (`extrema_bounding_bfs`),
+    with several BFS sweeps per round on worker threads.
+     */
 
-        // get distances from/to current node && derive eccentricity
-        dist = dict(xnetwork.single_source_shortest_path_length(G, current));
-        if (len(dist) != N) {
-            const auto msg = ("Cannot compute metric because graph is not connected.");
-            throw xnetwork.XNetworkError(msg);
-        current_ecc = max(dist.values());
-
-        // print status update
-//        print ("ecc of " + str(current) + " (" + str(ecc_lower[current]) + "/"
-//        + str(ecc_upper[current]) + ", deg: " + str(dist[current]) + ") is "
-//        + str(current_ecc));
-//        print(ecc_upper);
-
-        // (re)set bound extremes
-        maxuppernode = None;
-        minlowernode = None;
-
-        // update node bounds
-        for (auto i : candidates) {
-            // update eccentricity bounds
-            d = dist[i];
-            ecc_lower[i] = low = max(ecc_lower[i], max(d, (current_ecc - d)));
-            ecc_upper[i] = upp = min(ecc_upper[i], current_ecc + d);
-
-            // update min/max values of lower && upper bounds
-            minlower = min(ecc_lower[i], minlower);
-            maxlower = max(ecc_lower[i], maxlower);
-            minupper = min(ecc_upper[i], minupper);
-            maxupper = max(ecc_upper[i], maxupper);
-
-        // update candidate set
-        if (compute == "diameter") {
-            ruled_out = {i for i : candidates if (ecc_upper[i] <= maxlower &&
-                         2 * ecc_lower[i] >= maxupper}
-
-        } else if (compute == "radius") {
-            ruled_out = {i for i : candidates if (ecc_lower[i] >= minupper &&
-                         ecc_upper[i] + 1 <= 2 * minlower}
-
-        } else if (compute == "periphery") {
-            ruled_out = {i for i : candidates if (ecc_upper[i] < maxlower &&
-                         (maxlower == maxupper || ecc_lower[i] > maxupper)}
-
-        } else if (compute == "center") {
-            ruled_out = {i for i : candidates if (ecc_lower[i] > minupper &&
-                         (minlower == minupper || ecc_upper[i] + 1 < 2 * minlower)}
-
-        } else if (compute == "eccentricities") {
-            ruled_out = {};
-
-        ruled_out.update(i for i : candidates if (ecc_lower[i] == ecc_upper[i]);
-        candidates -= ruled_out
-
-//        for (auto i : ruled_out) {
-//            print("removing %g: ecc_u: %g maxl: %g ecc_l: %g maxu: %g"%
-//                    (i,ecc_upper[i],maxlower,ecc_lower[i],maxupper));
-//        print("node %g: ecc_u: %g maxl: %g ecc_l: %g maxu: %g"%
-//                    (4,ecc_upper[4],maxlower,ecc_lower[4],maxupper));
-//        print("NODE 4: %g"%(ecc_upper[4] <= maxlower));
-//        print("NODE 4: %g"%(2 * ecc_lower[4] >= maxupper));
-//        print("NODE 4: %g"%(ecc_upper[4] <= maxlower
-//                            && 2 * ecc_lower[4] >= maxupper));
-
-        // updating maxuppernode && minlowernode for selection : next round
-        for (auto i : candidates) {
-            if (minlowernode.empty() \
-                    || (ecc_lower[i] == ecc_lower[minlowernode];
-                        && degrees[i] > degrees[minlowernode]) \
-                    || (ecc_lower[i] < ecc_lower[minlowernode]) {
-                minlowernode = i
-
-            if (maxuppernode.empty() \
-                    || (ecc_upper[i] == ecc_upper[maxuppernode];
-                        && degrees[i] > degrees[maxuppernode]) \
-                    || (ecc_upper[i] > ecc_upper[maxuppernode]) {
-                maxuppernode = i
-
-        // print status update
-//        print (" min=" + str(minlower) + "/" + str(minupper) +
-//        " max=" + str(maxlower) + "/" + str(maxupper) +
-//        " candidates: " + str(len(candidates)));
-//        print("cand:",candidates);
-//        print("ecc_l",ecc_lower);
-//        print("ecc_u",ecc_upper);
-//        wait = input("press Enter to continue");
+    static const auto metrics = {{"diameter", xn::Extremum::diameter},
+                                 {"radius", xn::Extremum::radius},
+                                 {"periphery", xn::Extremum::periphery},
+                                 {"center", xn::Extremum::center},
+                                 {"eccentricities", xn::Extremum::eccentricities}};
+    if (!metrics.contains(compute)) {
+        return None;
+    }
+    // bounds live : dense arrays indexed by G._node_map
+    B = xn::extrema_bounding_bfs(xn::to_csr(G), metrics[compute]);
+    nodes = list(G);
 
     // return the correct value of the requested metric
     if (compute == "diameter") {
-        return maxlower
+        return B.diameter();
     } else if (compute == "radius") {
-        return minupper
+        return B.radius();
     } else if (compute == "periphery") {
-        p = [v for v : G if (ecc_lower[v] == maxlower];
-        return p
+        return [nodes[i] for i : B.periphery()];
     } else if (compute == "center") {
-        c = [v for v : G if (ecc_upper[v] == minupper];
-        return c
-    } else if (compute == "eccentricities") {
-        return ecc_lower
-    return None;
+        return [nodes[i] for i : B.center()];
+    }
+    return {v: B.lower[G._node_map[v]] for v : G};
 
 
 auto eccentricity(G, v=None, sp=None) {
@@ -218,6 +121,11 @@ auto eccentricity(G, v=None, sp=None) {
 //        nodes=[v];
 //    } else {                      // assume v is a container of nodes
 //        nodes=v
+    if (v.empty() && sp.empty()) {
+        // all nodes: bounding for graphs, bit-parallel BFS for digraphs
+        ecc = xn::eccentricity_bfs(xn::to_csr(G));
+        return {n: ecc[G._node_map[n]] for n : G};
+    }
     order = G.order();
 
     e = {};
@@ -269,9 +177,14 @@ auto diameter(G, e=None, usebounds=false) {
     See Also
     --------
     eccentricity
+
+    Notes
+    -----
+    With `usebounds` an undirected graph is handled by iFUB
+    (`diameter_ifub`), which typically needs a handful of BFS calls.
      */
     if (usebounds is true && e.empty() && !G.is_directed() {
-        return extrema_bounding(G, compute="diameter");
+        return xn::diameter_ifub(xn::to_csr(G));
     if (e.empty()) {
         e = eccentricity(G);
     return max(e.values());
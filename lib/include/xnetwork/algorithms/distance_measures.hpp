@@ -0,0 +1,371 @@
+#ifndef _HOME_UBUNTU_GITHUB_XNETWORK_ALGORITHMS_DISTANCE_MEASURES_HPP
+#define _HOME_UBUNTU_GITHUB_XNETWORK_ALGORITHMS_DISTANCE_MEASURES_HPP 1
+
+//    Copyright (C) 2004-2018 by
+//    Wai-Shing Luk <luk036@gmail.com>
+//
+//
+//    All rights reserved.
+//    BSD license.
+//
+// Authors: Wai-Shing Luk (luk036@gmail.com);
+//          Dan Schult (dschult@colgate.edu);
+/** Native diameter, radius and eccentricity on CSR graphs. */
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <vector>
+#include <xnetwork/algorithms/shortest_paths/unweighted.hpp> // import BFSWorkspace, multi_source_bfs_sums
+#include <xnetwork/classes/csr.hpp> // import CSRGraph
+#include <xnetwork/exception.hpp> // import XNetworkError
+#include <xnetwork/utils/parallel.hpp> // import parallel_for
+
+namespace xn {
+
+/** Metric requested from `extrema_bounding_bfs`. */
+enum class Extremum { diameter, radius, periphery, center, eccentricities };
+
+/** Eccentricity bounds left by `extrema_bounding_bfs`.
+
+    `lower[v] <= ecc(v) <= upper[v]` for every node.  The summary fields
+    hold the extremes over all nodes; `num_bfs` counts the searches run.
+*/
+struct ExtremaBounds {
+    std::vector<std::int64_t> lower;
+    std::vector<std::int64_t> upper;
+    std::int64_t minlower = 0, maxlower = 0, minupper = 0, maxupper = 0;
+    std::size_t num_bfs = 0;
+
+    /** Diameter (resp. radius) once the bounding has finished. */
+    auto diameter() const { return this->maxlower; }
+    auto radius() const { return this->minupper; }
+
+    /** Nodes with eccentricity equal to the diameter. */
+    auto periphery() const {
+        auto p = std::vector<std::uint32_t>{};
+        for (std::size_t v = 0; v < this->lower.size(); ++v)
+            if (this->lower[v] == this->maxlower)
+                p.push_back(std::uint32_t(v));
+        return p;
+    }
+
+    /** Nodes with eccentricity equal to the radius. */
+    auto center() const {
+        auto c = std::vector<std::uint32_t>{};
+        for (std::size_t v = 0; v < this->upper.size(); ++v)
+            if (this->upper[v] == this->minupper)
+                c.push_back(std::uint32_t(v));
+        return c;
+    }
+};
+
+inline void _update_extremes(ExtremaBounds &B) {
+    B.minlower = B.minupper = std::int64_t(B.lower.size());
+    B.maxlower = B.maxupper = 0;
+    for (std::size_t i = 0; i < B.lower.size(); ++i) {
+        B.minlower = std::min(B.minlower, B.lower[i]);
+        B.maxlower = std::max(B.maxlower, B.lower[i]);
+        B.minupper = std::min(B.minupper, B.upper[i]);
+        B.maxupper = std::max(B.maxupper, B.upper[i]);
+    }
+}
+
+inline void _throw_not_connected() {
+    throw XNetworkError(
+        "Cannot compute metric because graph is not connected.");
+}
+
+/** Takes--Kosters eccentricity bounding on dense arrays.
+
+    Same algorithm as `extrema_bounding` [1]_: every BFS from a node `w`
+    tightens `max(d, ecc(w) - d) <= ecc(v) <= ecc(w) + d` for all `v`,
+    and nodes whose bounds can no longer change the requested metric
+    leave the candidate set.  Each round picks up to `batch` nodes,
+    alternating between the smallest lower and the largest upper bound,
+    and runs their searches on separate threads.
+
+    Parameters
+    ----------
+    G : CSRGraph
+        A connected undirected graph.
+
+    compute : Extremum
+        The metric that decides when a node is ruled out.
+
+    num_threads : unsigned, optional (default=0)
+
+    batch : size_t, optional (default=0)
+        Searches per round; 0 uses the number of threads.
+
+    Returns
+    -------
+    bounds : ExtremaBounds
+
+    Raises
+    ------
+    XNetworkError
+        If the graph is directed or not connected.
+
+    References
+    ----------
+    .. [1] F.W. Takes && W.A. Kosters, Computing the Eccentricity
+       Distribution of Large Graphs, Algorithms 6(1): 100-118, 2013.
+*/
+template <typename W>
+auto extrema_bounding_bfs(const CSRGraph<W> &G, Extremum compute,
+                          unsigned num_threads = 0, std::size_t batch = 0)
+    -> ExtremaBounds {
+    if (G.directed)
+        throw XNetworkError("extrema_bounding requires an undirected graph");
+    const auto n = G.num_nodes();
+    const auto N = std::int64_t(n);
+    const auto nt = resolve_num_threads(num_threads);
+    if (batch == 0)
+        batch = nt;
+
+    auto B = ExtremaBounds{};
+    B.lower.assign(n, 0);
+    B.upper.assign(n, N);
+    if (n == 0)
+        return B;
+
+    auto candidates = std::vector<std::uint32_t>(n);
+    for (std::uint32_t v = 0; v < n; ++v)
+        candidates[v] = v;
+    auto in_round = std::vector<char>(n, 0);
+    auto ws = std::vector<BFSWorkspace>(batch, BFSWorkspace(n));
+    auto ecc = std::vector<std::int64_t>(batch);
+    auto picked = std::vector<std::uint32_t>{};
+
+    auto better_low = [&](auto i, auto j) {
+        return B.lower[i] < B.lower[j] ||
+               (B.lower[i] == B.lower[j] && G.degree(i) > G.degree(j));
+    };
+    auto better_upp = [&](auto i, auto j) {
+        return B.upper[i] > B.upper[j] ||
+               (B.upper[i] == B.upper[j] && G.degree(i) > G.degree(j));
+    };
+
+    auto high = false;
+    while (!candidates.empty()) {
+        // alternate between smallest lower && largest upper bound
+        picked.clear();
+        while (picked.size() < std::min(batch, candidates.size())) {
+            auto best = std::uint32_t(-1);
+            for (auto i : candidates) {
+                if (in_round[i])
+                    continue;
+                if (best == std::uint32_t(-1) ||
+                    (high ? better_upp(i, best) : better_low(i, best)))
+                    best = i;
+            }
+            in_round[best] = 1;
+            picked.push_back(best);
+            high = !high;
+        }
+
+        parallel_for(
+            picked.size(),
+            [&](std::size_t k, unsigned) {
+                ecc[k] = ws[k].run(G, picked[k]);
+            },
+            nt, 1);
+        B.num_bfs += picked.size();
+        for (std::size_t k = 0; k < picked.size(); ++k) {
+            in_round[picked[k]] = 0;
+            if (ws[k].visited != n)
+                _throw_not_connected();
+        }
+
+        parallel_for(
+            candidates.size(),
+            [&](std::size_t c, unsigned) {
+                auto i = candidates[c];
+                auto low = B.lower[i], upp = B.upper[i];
+                for (std::size_t k = 0; k < picked.size(); ++k) {
+                    auto d = ws[k].dist[i];
+                    low = std::max(low, std::max(d, ecc[k] - d));
+                    upp = std::min(upp, ecc[k] + d);
+                }
+                B.lower[i] = low;
+                B.upper[i] = upp;
+            },
+            nt, 4096);
+
+        // ruled out nodes keep valid bounds, so the extremes run over all
+        _update_extremes(B);
+
+        auto ruled_out = [&](std::uint32_t i) {
+            auto low = B.lower[i], upp = B.upper[i];
+            if (low == upp)
+                return true;
+            switch (compute) {
+            case Extremum::diameter:
+                return upp <= B.maxlower && 2 * low >= B.maxupper;
+            case Extremum::radius:
+                return low >= B.minupper && upp + 1 <= 2 * B.minlower;
+            case Extremum::periphery:
+                return upp < B.maxlower &&
+                       (B.maxlower == B.maxupper || low > B.maxupper);
+            case Extremum::center:
+                return low > B.minupper &&
+                       (B.minlower == B.minupper || upp + 1 < 2 * B.minlower);
+            default:
+                return false;
+            }
+        };
+        candidates.erase(std::remove_if(candidates.begin(), candidates.end(),
+                                        ruled_out),
+                         candidates.end());
+    }
+
+    return B;
+}
+
+/** Return the node at distance `target` from the BFS root of `ws` on a
+    shortest path to `end`. */
+template <typename W>
+auto _walk_back(const CSRGraph<W> &G, const BFSWorkspace &ws,
+                std::uint32_t end, std::int64_t target) -> std::uint32_t {
+    auto cur = end;
+    while (ws.dist[cur] > target) {
+        auto [b, e] = G.neighbors(cur);
+        for (auto it = b; it != e; ++it) {
+            if (ws.dist[*it] == ws.dist[cur] - 1) {
+                cur = *it;
+                break;
+            }
+        }
+    }
+    return cur;
+}
+
+/** Return the diameter of a connected undirected graph with iFUB.
+
+    A 4-sweep [1]_ picks a central root `u` and a first lower bound.
+    The BFS tree of `u` is then scanned from its deepest level up: the
+    eccentricities of the nodes of level `i` are computed in parallel,
+    and the search stops as soon as the best value found exceeds
+    `2 (i - 1)`, the largest distance between two nodes at depth below
+    `i`.  Each level is evaluated completely, since the answer is the
+    largest eccentricity found.  On real-world graphs this needs only
+    a handful of searches.
+
+    Parameters
+    ----------
+    G : CSRGraph
+        A connected undirected graph.
+
+    num_threads : unsigned, optional (default=0)
+
+    Returns
+    -------
+    diameter : int64_t
+
+    Raises
+    ------
+    XNetworkError
+        If the graph is directed or not connected.
+
+    References
+    ----------
+    .. [1] P. Crescenzi, R. Grossi, M. Habib, L. Lanzi, A. Marino.
+       "On computing the diameter of real-world undirected graphs."
+       Theoretical Computer Science 514: 84-95, 2013.
+*/
+template <typename W>
+auto diameter_ifub(const CSRGraph<W> &G, unsigned num_threads = 0)
+    -> std::int64_t {
+    if (G.directed)
+        throw XNetworkError("diameter_ifub requires an undirected graph");
+    const auto n = G.num_nodes();
+    if (n == 0)
+        return 0;
+
+    auto ws = BFSWorkspace(n);
+    auto r = std::uint32_t(0);
+    for (std::uint32_t v = 1; v < n; ++v)
+        if (G.degree(v) > G.degree(r))
+            r = v;
+
+    // 4-sweep
+    auto lb = std::int64_t(0);
+    for (int sweep = 0; sweep < 2; ++sweep) {
+        ws.run(G, r);
+        if (ws.visited != n)
+            _throw_not_connected();
+        auto a = ws.queue.back();
+        auto ecc_a = ws.run(G, a);
+        lb = std::max(lb, ecc_a);
+        r = _walk_back(G, ws, ws.queue.back(), ecc_a / 2);
+    }
+
+    auto ecc_u = ws.run(G, r);
+    lb = std::max(lb, ecc_u);
+    auto ub = 2 * ecc_u;
+    auto order = ws.queue; // BFS order from u, by increasing depth
+    auto depth = std::vector<std::int64_t>(order.size());
+    for (std::size_t k = 0; k < order.size(); ++k)
+        depth[k] = ws.dist[order[k]];
+
+    const auto nt = resolve_num_threads(num_threads);
+    auto pool = std::vector<BFSWorkspace>(nt, BFSWorkspace(n));
+    auto end = order.size();
+    for (auto i = ecc_u; i > 0 && lb < ub; --i) {
+        auto begin = end;
+        while (begin > 0 && depth[begin - 1] == i)
+            --begin;
+        auto best = std::atomic<std::int64_t>{lb};
+        auto bound = 2 * (i - 1);
+        parallel_for(
+            end - begin,
+            [&](std::size_t k, unsigned tid) {
+                auto e = pool[tid].run(G, order[begin + k]);
+                auto cur = best.load(std::memory_order_relaxed);
+                while (e > cur && !best.compare_exchange_weak(cur, e))
+                    ;
+            },
+            nt, 1);
+        lb = best.load();
+        if (lb > bound)
+            return lb;
+        ub = bound;
+        end = begin;
+    }
+    return lb;
+}
+
+/** Return the exact eccentricity of every node.
+
+    Undirected graphs use `extrema_bounding_bfs`, which usually settles
+    most nodes from a few searches; digraphs use the bit-parallel
+    `multi_source_bfs_sums`.
+
+    Raises
+    ------
+    XNetworkError
+        If the graph is not (strongly) connected.
+*/
+template <typename W>
+auto eccentricity_bfs(const CSRGraph<W> &G, unsigned num_threads = 0)
+    -> std::vector<std::int64_t> {
+    if (!G.directed)
+        return extrema_bounding_bfs(G, Extremum::eccentricities,
+                                    num_threads)
+            .lower;
+
+    auto sums = multi_source_bfs_sums(G, false, num_threads);
+    auto e = std::vector<std::int64_t>(G.num_nodes());
+    for (std::size_t v = 0; v < e.size(); ++v) {
+        if (sums.reach[v] != G.num_nodes())
+            throw XNetworkError("Found infinite path length because the "
+                                "digraph is not strongly connected");
+        e[v] = std::int64_t(sums.eccentricity[v]);
+    }
+    return e;
+}
+
+} // namespace xn
+
+#endif
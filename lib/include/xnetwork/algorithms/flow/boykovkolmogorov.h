@@ -11,11 +11,9 @@
 /**
 Boykov-Kolmogorov algorithm for maximum flow problems.
 */
-from collections import deque
-from operator import itemgetter
-
 #include <xnetwork.hpp> // as xn
 from xnetwork.algorithms.flow.utils import build_residual_network
+#include <xnetwork/algorithms/flow/boykovkolmogorov.hpp> // import BoykovKolmogorov
 
 static const auto __all__ = ["boykov_kolmogorov"];
 
@@ -149,6 +147,12 @@ auto boykov_kolmogorov(G, s, t, capacity="capacity", residual=None,
 
     >>> partition = (set(G) - set(target_tree), set(target_tree));
 
+    The algorithm runs natively on the arrays of `xn::BoykovKolmogorov`.
+    That class can also be kept between calls: `add_capacity` changes
+    capacities by deltas && the next `maxflow` reuses the residual
+    network && the search trees, which is much faster than solving from
+    scratch when a sequence of cuts differs slightly (dynamic graph cuts).
+
     References
     ----------
     .. [1] Boykov, Y., & Kolmogorov, V. (2004). An experimental comparison
@@ -181,13 +185,6 @@ auto boykov_kolmogorov_impl(G, s, t, capacity, residual, cutoff) {
     } else {
         R = residual
 
-    // Initialize/reset the residual network.
-    // This is way too slow
-    // xn::set_edge_attributes(R, 0, "flow");
-    for (auto u : R) {
-        for (auto e : R[u].values() {
-            e["flow"] = 0.;
-
     // Use an arbitrary high value as infinite. It is computed
     // when building the residual network.
     INF = R.graph["inf"];
@@ -195,182 +192,36 @@ auto boykov_kolmogorov_impl(G, s, t, capacity, residual, cutoff) {
     if (cutoff.empty()) {
         cutoff = INF
 
-    R_succ = R.succ;
-    R_pred = R.pred;
-
-    auto grow() {
-        /** Bidirectional breadth-first search for the growth stage.
-
-           Returns a connecting edge, that is && edge that connects
-           a node from the source search tree with a node from the
-           target search tree.
-           The first node : the connecting edge is always from the
-           source tree && the last node from the target tree.
-         */
-        while (active) {
-            u = active[0];
-            if (u : source_tree) {
-                this_tree = source_tree
-                other_tree = target_tree
-                neighbors = R_succ;
-            } else {
-                this_tree = target_tree
-                other_tree = source_tree
-                neighbors = R_pred;
-            for (auto v, attr : neighbors[u].items() {
-                if (attr["capacity"] - attr["flow"] > 0) {
-                    if (v not : this_tree) {
-                        if (v : other_tree) {
-                            return (u, v) if (this_tree is source_tree else (v, u);
-                        this_tree[v] = u
-                        dist[v] = dist[u] + 1
-                        timestamp[v] = timestamp[u];
-                        active.append(v);
-                    } else if (v : this_tree && _is_closer(u, v) {
-                        this_tree[v] = u
-                        dist[v] = dist[u] + 1
-                        timestamp[v] = timestamp[u];
-            _ = active.popleft();
-        return None, None;
-
-    auto augment(u, v) {
-        /** Augmentation stage.
-
-           Reconstruct path && determine its residual capacity.
-           We start from a connecting edge, which links a node
-           from the source tree to a node from the target tree.
-           The connecting edge is the output of the grow function
-           && the input of this function.
-         */
-        attr = R_succ[u][v];
-        flow = min(INF, attr["capacity"] - attr["flow"]);
-        path = [u];
-        // Trace a path from u to s : source_tree.
-        w = u
-        while (w != s) {
-            n = w;
-            w = source_tree[n];
-            attr = R_pred[n][w];
-            flow = min(flow, attr["capacity"] - attr["flow"]);
-            path.append(w);
-        path.reverse();
-        // Trace a path from v to t : target_tree.
-        path.append(v);
-        w = v
-        while (w != t) {
-            n = w;
-            w = target_tree[n];
-            attr = R_succ[n][w];
-            flow = min(flow, attr["capacity"] - attr["flow"]);
-            path.append(w);
-        // Augment flow along the path && check for saturated edges.
-        it = iter(path);
-        u = next(it);
-        these_orphans = [];
-        for (auto v : it) {
-            R_succ[u][v]["flow"] += flow
-            R_succ[v][u]["flow"] -= flow
-            if (R_succ[u][v]["flow"] == R_succ[u][v]["capacity"]) {
-                if (v : source_tree) {
-                    source_tree[v] = None;
-                    these_orphans.append(v);
-                if (u : target_tree) {
-                    target_tree[u] = None;
-                    these_orphans.append(u);
-            u = v
-        orphans.extend(sorted(these_orphans, key=dist.get));
-        return flow
-
-    auto adopt() {
-        /** Adoption stage.
-
-           Reconstruct search trees by adopting || discarding orphans.
-           During augmentation stage some edges got saturated && thus
-           the source && target search trees broke down to forests, with
-           orphans as roots of some of its trees. We have to reconstruct
-           the search trees rooted to source && target before we can grow
-           them again.
-         */
-        while (orphans) {
-            u = orphans.popleft();
-            if (u : source_tree) {
-                tree = source_tree
-                neighbors = R_pred;
-            } else {
-                tree = target_tree
-                neighbors = R_succ;
-            nbrs = ((n, attr, dist[n]) for n, attr : neighbors[u].items();
-                    if (n : tree);
-            for (auto v, attr, d : sorted(nbrs, key=itemgetter(2)) {
-                if (attr["capacity"] - attr["flow"] > 0) {
-                    if (_has_valid_root(v, tree) {
-                        tree[u] = v
-                        dist[u] = dist[v] + 1
-                        timestamp[u] = time
-                        break;
-            } else {
-                nbrs = ((n, attr, dist[n]) for n, attr : neighbors[u].items();
-                        if (n : tree);
-                for (auto v, attr, d : sorted(nbrs, key=itemgetter(2)) {
-                    if (attr["capacity"] - attr["flow"] > 0) {
-                        if (v not : active) {
-                            active.append(v);
-                    if (tree[v] == u) {
-                        tree[v] = None;
-                        orphans.appendleft(v);
-                if (u : active) {
-                    active.remove(u);
-                del tree[u];
-
-    auto _has_valid_root(n, tree) {
-        path = [];
-        v = n;
-        while (v is not None) {
-            path.append(v);
-            if (v == s || v == t) {
-                base_dist = 0.;
-                break;
-            } else if (timestamp[v] == time) {
-                base_dist = dist[v];
-                break;
-            v = tree[v];
-        } else {
-            return false;
-        length = len(path);
-        for (auto i, u : enumerate(path, 1) {
-            dist[u] = base_dist + length - i
-            timestamp[u] = time
-        return true;
-
-    auto _is_closer(u, v) {
-        return timestamp[v] <= timestamp[u] && dist[v] > dist[u] + 1
-
-    source_tree = {s: None}
-    target_tree = {t: None}
-    active = deque([s, t]);
-    orphans = deque();
-    flow_value = 0.;
-    // data structures for the marking heuristic
-    time = 1;
-    timestamp = {s: time, t: time}
-    dist = {s: 0, t: 0}
-    while (flow_value < cutoff) {
-        // Growth stage
-        auto [u, v] = grow();
-        if (u.empty()) {
-            break;
-        time += 1;
-        // Augmentation stage
-        flow_value += augment(u, v);
-        // Adoption stage
-        adopt();
+    // Run the native solver on the arcs of R && write the flows && the
+    // search trees back.
+    nodes = list(R);
+    edges = [(R._node_map[u], R._node_map[v], attr["capacity"]);
+             for (auto u, v, attr : R.edges(data=true)];
+    A = xn::ResidualNetwork<double>(len(R), edges.begin(), edges.end(), true);
+    bk = xn::BoykovKolmogorov<double>(A, R._node_map[s], R._node_map[t]);
+    flow_value = bk.maxflow(cutoff);
 
     if (flow_value * 2 > INF) {
         throw xn::XNetworkUnbounded("Infinite capacity path, flow unbounded above.");
 
+    bk.write_flow(A);
+    for (auto i, u : enumerate(nodes)) {
+        for (auto a : range(A.indptr[i], A.indptr[i + 1])) {
+            R.succ[u][nodes[A.head[a]]]["flow"] = A.flow[a];
+
     // Add source && target tree : a graph attribute.
     // A partition that defines a minimum cut can be directly
     // computed from the search trees as explained : the docstrings.
+    source_tree = {s: None}
+    target_tree = {t: None}
+    for (auto i, u : enumerate(nodes)) {
+        p = bk.tree_parent(i);
+        if (p == bk.none) {
+            continue;
+        if (bk.in_source_tree(i)) {
+            source_tree[u] = nodes[p];
+        } else {
+            target_tree[u] = nodes[p];
     R.graph["trees"] = (source_tree, target_tree);
     // Add the standard flow_value graph attribute.
     R.graph["flow_value"] = flow_value
@@ -0,0 +1,572 @@
+#ifndef _HOME_UBUNTU_GITHUB_XNETWORK_ALGORITHMS_FLOW_BOYKOVKOLMOGOROV_HPP
+#define _HOME_UBUNTU_GITHUB_XNETWORK_ALGORITHMS_FLOW_BOYKOVKOLMOGOROV_HPP 1
+
+//    Copyright (C) 2004-2018 by
+//    Wai-Shing Luk <luk036@gmail.com>
+//
+//
+//    All rights reserved.
+//    BSD license.
+/**
+Native Boykov-Kolmogorov maximum flow with reusable search trees.
+*/
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <limits>
+#include <vector>
+#include <xnetwork/algorithms/flow/utils.hpp> // import ResidualNetwork
+#include <xnetwork/exception.hpp> // import XNetworkError
+
+namespace xn {
+
+/** A Boykov-Kolmogorov maximum flow solver that can be re-solved after
+    its capacities change.
+
+    The arcs at the source && the sink are kept as terminal capacities
+    of their other end, as in Kolmogorov's implementation [2]_: `tr[u]`
+    is the residual capacity from s to u if positive, || from u to t if
+    negative.  The other arcs are paired residual capacities.  The
+    solver keeps its residual network, its two search trees (with the
+    timestamps && distances of the marking heuristic) && its active &&
+    orphan queues between calls to `maxflow`.
+
+    `add_capacity` changes a capacity by a delta.  If the new capacity
+    is below the flow on the arc, the flow is cut back && the excess &&
+    deficit at its ends are moved onto their terminal capacities, which
+    reparameterizes the network without changing its cuts except by a
+    constant (Kohli && Torr [3]_).  The next `maxflow` only repairs the
+    trees around the changed nodes && continues from the current flow.
+
+    Parameters
+    ----------
+    Cap : arithmetic type (default: double)
+
+    References
+    ----------
+    .. [1] Boykov, Y., & Kolmogorov, V. (2004). An experimental comparison
+           of min-cut/max-flow algorithms for energy minimization : vision.
+           Pattern Analysis && Machine Intelligence, IEEE Transactions on,
+           26(9), 1124-1137.
+
+    .. [2] Vladimir Kolmogorov. Graph-based Algorithms for Multi-camera
+           Reconstruction Problem. PhD thesis, Cornell University, CS
+           Department, 2003. pp. 109-114.
+
+    .. [3] Pushmeet Kohli && Philip H. S. Torr. Dynamic graph cuts for
+           efficient inference in Markov random fields. IEEE Transactions
+           on Pattern Analysis && Machine Intelligence, 29(12), 2007.
+*/
+template <typename Cap = double> class BoykovKolmogorov {
+  public:
+    using index_t = std::uint32_t;
+    using arc_t = std::size_t;
+    static constexpr auto none = std::numeric_limits<index_t>::max();
+
+    /** Take the capacities of R, with source s && sink t.
+
+        Arcs into s || out of t are ignored; they carry no s-t flow.
+    */
+    BoykovKolmogorov(const ResidualNetwork<Cap> &R, std::size_t s,
+                     std::size_t t)
+        : _n{R.num_nodes()}, _s{index_t(s)}, _t{index_t(t)} {
+        R.check_terminals(s, t);
+        const auto n = this->_n;
+        this->_cs.assign(n, Cap(0));
+        this->_ct.assign(n, Cap(0));
+        auto index = std::vector<arc_t>(R.num_arcs(), _no_arc);
+        this->indptr.assign(n + 1, 0);
+        for (std::size_t u = 0; u < n; ++u) {
+            for (auto a = R.indptr[u]; a < R.indptr[u + 1]; ++a) {
+                auto v = R.head[a];
+                if (u == s && v == t)
+                    this->_cst += R.cap[a];
+                else if (u == s)
+                    this->_cs[v] += R.cap[a];
+                else if (v == t)
+                    this->_ct[u] += R.cap[a];
+                if (u == s || u == t || v == s || v == t)
+                    continue;
+                index[a] = this->head.size();
+                this->head.push_back(v);
+                this->cap.push_back(R.cap[a]);
+            }
+            this->indptr[u + 1] = this->head.size();
+        }
+        this->rev.resize(this->head.size());
+        for (std::size_t a = 0; a < R.num_arcs(); ++a)
+            if (index[a] != _no_arc)
+                this->rev[index[a]] = index[R.rev[a]];
+        this->rcap = this->cap;
+        this->_parent.assign(n, _free);
+        this->_sink.assign(n, 0);
+        this->_ts.assign(n, 0);
+        this->_dist.assign(n, 0);
+        this->_queued.assign(n, 0);
+        this->_marked.assign(n, 0);
+        this->_tr.assign(n, Cap(0));
+        this->_flow = this->_cst;
+        for (std::size_t u = 0; u < n; ++u)
+            this->_edit_terminal(index_t(u), this->_cs[u], this->_ct[u]);
+        this->_changed.clear();
+        std::fill(this->_marked.begin(), this->_marked.end(), 0);
+    }
+
+    /** Compute a maximum flow && return its value.
+
+        The first call grows the search trees from the terminals; later
+        calls reuse them.  If the flow value reaches `cutoff` the search
+        stops early && the trees need not give a minimum cut.
+    */
+    auto maxflow(Cap cutoff = std::numeric_limits<Cap>::max()) -> Cap {
+        if (this->_solved)
+            this->_reuse_trees();
+        else
+            this->_init_trees();
+        this->_solved = true;
+        auto current = none;
+        while (this->_flow < cutoff) {
+            auto u = current;
+            if (u == none || this->_parent[u] == _free)
+                u = this->_next_active();
+            if (u == none)
+                break;
+            auto a = this->_grow(u);
+            ++this->_time;
+            if (a == _no_arc) {
+                current = none;
+                continue;
+            }
+            current = u; // u may have more connections
+            this->_augment(a);
+            this->_adopt();
+        }
+        return this->_flow;
+    }
+
+    /** Add `delta` to the capacity of the arc `(u, v)`.
+
+        `u == s` || `v == t` changes a terminal capacity; other arcs must
+        exist in the network the solver was built from.
+
+        Raises
+        ------
+        XNetworkError
+            If the arc does not exist || its capacity would become
+            negative.
+    */
+    void add_capacity(std::size_t u, std::size_t v, Cap delta) {
+        if (u >= this->_n || v >= this->_n)
+            throw XNetworkError("node not in graph");
+        if (v == this->_s || u == this->_t)
+            return;
+        if (u == this->_s && v == this->_t) {
+            this->_check_nonnegative(this->_cst + delta);
+            this->_cst += delta;
+            this->_flow += delta;
+        } else if (u == this->_s) {
+            this->_check_nonnegative(this->_cs[v] + delta);
+            this->_cs[v] += delta;
+            this->_edit_terminal(index_t(v), delta, Cap(0));
+        } else if (v == this->_t) {
+            this->_check_nonnegative(this->_ct[u] + delta);
+            this->_ct[u] += delta;
+            this->_edit_terminal(index_t(u), Cap(0), delta);
+        } else {
+            auto a = this->find_arc(u, v);
+            if (a == this->head.size())
+                throw XNetworkError("arc not in the network");
+            this->_check_nonnegative(this->cap[a] + delta);
+            this->cap[a] += delta;
+            this->rcap[a] += delta;
+            if (this->rcap[a] < 0) {
+                // cut the flow back to the capacity; u keeps the excess
+                // && v the deficit, which go to their terminals
+                auto x = -this->rcap[a];
+                this->rcap[a] = 0;
+                this->rcap[this->rev[a]] -= x;
+                this->_flow += x;
+                this->_edit_terminal(index_t(u), Cap(0), -x);
+                this->_edit_terminal(index_t(v), -x, Cap(0));
+            }
+            this->_mark(index_t(u));
+            this->_mark(index_t(v));
+        }
+    }
+
+    /** Value of the current flow; after `maxflow` a maximum flow. */
+    auto flow_value() const -> Cap { return this->_flow; }
+
+    auto num_nodes() const { return this->_n; }
+
+    /** Return the arc `(u, v)` between inner nodes, || `head.size()`. */
+    auto find_arc(std::size_t u, std::size_t v) const -> arc_t {
+        auto b = this->head.begin() + this->indptr[u];
+        auto e = this->head.begin() + this->indptr[u + 1];
+        auto it = std::lower_bound(b, e, index_t(v));
+        return it != e && *it == v ? arc_t(it - this->head.begin())
+                                   : this->head.size();
+    }
+
+    /** Whether u is in the source search tree; after `maxflow` these
+        nodes && s form the source side of a minimum cut.
+    */
+    auto in_source_tree(std::size_t u) const -> bool {
+        return u == this->_s || (this->_parent[u] != _free && !this->_sink[u]);
+    }
+
+    auto in_target_tree(std::size_t u) const -> bool {
+        return u == this->_t || (this->_parent[u] != _free && this->_sink[u]);
+    }
+
+    /** The parent of u in its search tree (s || t for the nodes joined
+        to a terminal), || `none` for the terminals && free nodes.
+    */
+    auto tree_parent(std::size_t u) const -> index_t {
+        auto a = this->_parent[u];
+        if (u == this->_s || u == this->_t || a == _free || a == _orphan)
+            return none;
+        if (a == _terminal)
+            return this->_sink[u] ? this->_t : this->_s;
+        return this->head[a];
+    }
+
+    auto source_side() const -> std::vector<bool> {
+        auto side = std::vector<bool>(this->_n);
+        for (std::size_t u = 0; u < this->_n; ++u)
+            side[u] = this->in_source_tree(u);
+        return side;
+    }
+
+    /** Write the flow into `R`, the network the solver was built from.
+
+        The flow on the terminal arcs is recovered from conservation, so
+        this is a flow of R only as long as no capacity was lowered below
+        its flow; after such a change the value && the cut still hold
+        but the flow is one of the reparameterized network.
+    */
+    void write_flow(ResidualNetwork<Cap> &R) const {
+        R.reset();
+        auto out = std::vector<Cap>(this->_n, Cap(0));
+        for (std::size_t u = 0; u < this->_n; ++u) {
+            for (auto a = this->indptr[u]; a < this->indptr[u + 1]; ++a) {
+                auto v = this->head[a];
+                if (v < u)
+                    continue;
+                // keep saturated arcs exactly saturated
+                auto b = this->rev[a];
+                auto f = this->rcap[b] == 0   ? -this->cap[b]
+                         : this->rcap[a] == 0 ? this->cap[a]
+                                              : this->cap[a] - this->rcap[a];
+                out[u] += f;
+                out[v] -= f;
+                R.push(R.find_arc(u, v), f);
+            }
+        }
+        for (std::size_t u = 0; u < this->_n; ++u) {
+            if (u == this->_s || u == this->_t)
+                continue;
+            // tr = cs - ct - out, && the terminal arc(s) without residual
+            // capacity are saturated
+            auto tr = this->_tr[u];
+            auto fs = tr > 0 ? this->_ct[u] + out[u] : this->_cs[u];
+            auto ft = tr < 0 ? this->_cs[u] - out[u] : this->_ct[u];
+            auto as = R.find_arc(this->_s, u), at = R.find_arc(u, this->_t);
+            if (fs > 0 && as < R.num_arcs())
+                R.push(as, fs);
+            if (ft > 0 && at < R.num_arcs())
+                R.push(at, ft);
+        }
+        auto ast = R.find_arc(this->_s, this->_t);
+        if (this->_cst > 0 && ast < R.num_arcs())
+            R.push(ast, this->_cst);
+        R.flow_value = this->_flow;
+    }
+
+    std::vector<arc_t> indptr;
+    std::vector<index_t> head;
+    std::vector<arc_t> rev;
+    std::vector<Cap> cap;  // current capacities
+    std::vector<Cap> rcap; // residual capacities
+
+  private:
+    static constexpr auto _no_arc = std::numeric_limits<arc_t>::max();
+    static constexpr auto _free = std::numeric_limits<arc_t>::max();
+    static constexpr auto _terminal = _free - 1;
+    static constexpr auto _orphan = _free - 2;
+    static constexpr auto _inf_dist = std::numeric_limits<std::size_t>::max();
+
+    std::size_t _n;
+    index_t _s, _t;
+    std::vector<Cap> _cs, _ct; // terminal capacities
+    Cap _cst = Cap(0);         // capacity of (s, t)
+    std::vector<Cap> _tr;      // residual terminal capacities
+    Cap _flow = Cap(0);
+    // search trees: the arc from a node to its parent, || a marker
+    std::vector<arc_t> _parent;
+    std::vector<std::uint8_t> _sink;
+    std::vector<std::size_t> _ts, _dist;
+    std::size_t _time = 0;
+    std::deque<index_t> _active, _orphans;
+    std::vector<std::uint8_t> _queued;
+    // nodes changed since the last call
+    std::vector<index_t> _changed;
+    std::vector<std::uint8_t> _marked;
+    bool _solved = false;
+
+    static void _check_nonnegative(Cap c) {
+        if (c < 0)
+            throw XNetworkError("capacity must be nonnegative");
+    }
+
+    void _mark(index_t u) {
+        if (!this->_marked[u]) {
+            this->_marked[u] = 1;
+            this->_changed.push_back(u);
+        }
+    }
+
+    /** Add ds && dt to the terminal capacities of u: the residual parts
+        grow by them, the common part is sent straight through u, && a
+        negative part is folded into the other terminal.
+    */
+    void _edit_terminal(index_t u, Cap ds, Cap dt) {
+        auto tr = this->_tr[u];
+        auto a = (tr > 0 ? tr : Cap(0)) + ds;
+        auto b = (tr < 0 ? -tr : Cap(0)) + dt;
+        this->_flow += std::min(a, b);
+        this->_tr[u] = a - b;
+        this->_mark(u);
+    }
+
+    void _set_active(index_t u) {
+        if (!this->_queued[u]) {
+            this->_queued[u] = 1;
+            this->_active.push_back(u);
+        }
+    }
+
+    auto _next_active() -> index_t {
+        while (!this->_active.empty()) {
+            auto u = this->_active.front();
+            this->_active.pop_front();
+            this->_queued[u] = 0;
+            if (this->_parent[u] != _free)
+                return u;
+        }
+        return none;
+    }
+
+    void _set_orphan_front(index_t u) {
+        this->_parent[u] = _orphan;
+        this->_orphans.push_front(u);
+    }
+
+    void _set_orphan_rear(index_t u) {
+        this->_parent[u] = _orphan;
+        this->_orphans.push_back(u);
+    }
+
+    void _make_root(index_t u) {
+        this->_parent[u] = _terminal;
+        this->_sink[u] = this->_tr[u] < 0;
+        this->_ts[u] = this->_time;
+        this->_dist[u] = 1;
+        this->_set_active(u);
+    }
+
+    void _init_trees() {
+        for (std::size_t u = 0; u < this->_n; ++u) {
+            this->_marked[u] = 0;
+            if (this->_tr[u] != 0)
+                this->_make_root(index_t(u));
+        }
+        this->_changed.clear();
+    }
+
+    /** Repair the trees around the changed nodes: a node with a terminal
+        capacity becomes a root of its side, detaching its children if it
+        changes sides; a node without one becomes an orphan.
+    */
+    void _reuse_trees() {
+        ++this->_time;
+        for (auto u : this->_changed) {
+            this->_marked[u] = 0;
+            this->_set_active(u);
+            if (this->_tr[u] == 0) {
+                if (this->_parent[u] != _free && this->_parent[u] != _orphan)
+                    this->_set_orphan_rear(u);
+                continue;
+            }
+            auto sink = this->_tr[u] < 0;
+            if (this->_parent[u] == _free || this->_parent[u] == _orphan ||
+                bool(this->_sink[u]) != sink) {
+                // every neighbor may now reach across the cut, the
+                // children of u too once they are adopted again
+                for (auto a = this->indptr[u]; a < this->indptr[u + 1]; ++a) {
+                    auto v = this->head[a];
+                    if (this->_parent[v] == this->rev[a])
+                        this->_set_orphan_rear(v);
+                    if (this->_parent[v] != _free)
+                        this->_set_active(v);
+                }
+            }
+            this->_make_root(u);
+        }
+        this->_changed.clear();
+        this->_adopt();
+    }
+
+    /** Grow the tree of u by one layer; return the arc from the source
+        tree to the target tree that joins them, if found.
+    */
+    auto _grow(index_t u) -> arc_t {
+        const auto sink = bool(this->_sink[u]);
+        for (auto a = this->indptr[u]; a < this->indptr[u + 1]; ++a) {
+            if (!((sink ? this->rcap[this->rev[a]] : this->rcap[a]) > 0))
+                continue;
+            auto v = this->head[a];
+            if (this->_parent[v] == _free) {
+                this->_sink[v] = sink;
+                this->_parent[v] = this->rev[a];
+                this->_ts[v] = this->_ts[u];
+                this->_dist[v] = this->_dist[u] + 1;
+                this->_set_active(v);
+            } else if (bool(this->_sink[v]) != sink) {
+                return sink ? this->rev[a] : a;
+            } else if (this->_ts[v] <= this->_ts[u] &&
+                       this->_dist[v] > this->_dist[u]) {
+                // the marking heuristic: adopt v into a shorter path
+                this->_parent[v] = this->rev[a];
+                this->_ts[v] = this->_ts[u];
+                this->_dist[v] = this->_dist[u] + 1;
+            }
+        }
+        return _no_arc;
+    }
+
+    void _augment(arc_t middle) {
+        auto b = this->rcap[middle];
+        // the bottleneck on the source side
+        auto u = this->head[this->rev[middle]];
+        for (auto a = this->_parent[u]; a != _terminal; a = this->_parent[u]) {
+            b = std::min(b, this->rcap[this->rev[a]]);
+            u = this->head[a];
+        }
+        b = std::min(b, this->_tr[u]);
+        // the bottleneck on the target side
+        u = this->head[middle];
+        for (auto a = this->_parent[u]; a != _terminal; a = this->_parent[u]) {
+            b = std::min(b, this->rcap[a]);
+            u = this->head[a];
+        }
+        b = std::min(b, -this->_tr[u]);
+
+        this->rcap[this->rev[middle]] += b;
+        this->rcap[middle] -= b;
+        u = this->head[this->rev[middle]];
+        for (auto a = this->_parent[u]; a != _terminal; a = this->_parent[u]) {
+            this->rcap[a] += b;
+            this->rcap[this->rev[a]] -= b;
+            auto p = this->head[a];
+            if (!(this->rcap[this->rev[a]] > 0))
+                this->_set_orphan_front(u);
+            u = p;
+        }
+        this->_tr[u] -= b;
+        if (this->_tr[u] == 0)
+            this->_set_orphan_front(u);
+        u = this->head[middle];
+        for (auto a = this->_parent[u]; a != _terminal; a = this->_parent[u]) {
+            this->rcap[this->rev[a]] += b;
+            this->rcap[a] -= b;
+            auto p = this->head[a];
+            if (!(this->rcap[a] > 0))
+                this->_set_orphan_front(u);
+            u = p;
+        }
+        this->_tr[u] += b;
+        if (this->_tr[u] == 0)
+            this->_set_orphan_front(u);
+        this->_flow += b;
+    }
+
+    /** Find a new parent for every orphan, || free it. */
+    void _adopt() {
+        while (!this->_orphans.empty()) {
+            auto u = this->_orphans.front();
+            this->_orphans.pop_front();
+            if (this->_parent[u] == _orphan)
+                this->_process_orphan(u);
+        }
+    }
+
+    void _process_orphan(index_t u) {
+        const auto sink = bool(this->_sink[u]);
+        auto best = _no_arc;
+        auto best_dist = _inf_dist;
+        for (auto a0 = this->indptr[u]; a0 < this->indptr[u + 1]; ++a0) {
+            // the arc from the candidate parent toward the tree leaf
+            if (!((sink ? this->rcap[a0] : this->rcap[this->rev[a0]]) > 0))
+                continue;
+            auto v = this->head[a0];
+            if (this->_parent[v] == _free || bool(this->_sink[v]) != sink)
+                continue;
+            // the distance of v to its terminal, if it still has one
+            auto d = std::size_t(0);
+            for (auto w = v;;) {
+                if (this->_ts[w] == this->_time) {
+                    d += this->_dist[w];
+                    break;
+                }
+                auto a = this->_parent[w];
+                ++d;
+                if (a == _terminal) {
+                    this->_ts[w] = this->_time;
+                    this->_dist[w] = 1;
+                    break;
+                }
+                if (a == _orphan) {
+                    d = _inf_dist;
+                    break;
+                }
+                w = this->head[a];
+            }
+            if (d == _inf_dist)
+                continue;
+            if (d < best_dist) {
+                best = a0;
+                best_dist = d;
+            }
+            for (auto w = v; this->_ts[w] != this->_time;
+                 w = this->head[this->_parent[w]]) {
+                this->_ts[w] = this->_time;
+                this->_dist[w] = d--;
+            }
+        }
+        if (best != _no_arc) {
+            this->_parent[u] = best;
+            this->_ts[u] = this->_time;
+            this->_dist[u] = best_dist + 1;
+            return;
+        }
+        // no parent: u becomes free && its children orphans
+        this->_parent[u] = _free;
+        for (auto a0 = this->indptr[u]; a0 < this->indptr[u + 1]; ++a0) {
+            auto v = this->head[a0];
+            auto a = this->_parent[v];
+            if (a == _free || bool(this->_sink[v]) != sink)
+                continue;
+            if ((sink ? this->rcap[a0] : this->rcap[this->rev[a0]]) > 0)
+                this->_set_active(v);
+            if (a != _terminal && a != _orphan && this->head[a] == u)
+                this->_set_orphan_rear(v);
+        }
+    }
+};
+
+} // namespace xn
+
+#endif
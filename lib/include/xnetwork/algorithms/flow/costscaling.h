@@ -0,0 +1,169 @@
+// -*- coding: utf-8 -*-
+/**
+Cost scaling minimum cost flow algorithm.
+*/
+
+//    Copyright (C) 2004-2018 by
+//    Wai-Shing Luk <luk036@gmail.com>
+//
+//
+//    All rights reserved.
+//    BSD license.
+
+static const auto __all__ = ["cost_scaling"];
+
+#include <xnetwork.hpp> // as xn
+#include <xnetwork/utils.hpp> // import not_implemented_for
+from .networksimplex import _arc_flow_dict
+#include <xnetwork/algorithms/flow/costscaling.hpp> // import CostScaling
+
+
+/// @not_implemented_for("undirected");
+auto cost_scaling(G, demand="demand", capacity="capacity", weight="weight",
+                  scaling_factor=16) {
+    r/** Find a minimum cost flow satisfying all demands : digraph G.
+
+    This is the cost scaling push-relabel algorithm of Goldberg &&
+    Tarjan.
+
+    G is a digraph with edge costs && capacities && : which nodes
+    have demand, i.e., they want to send || receive some amount of
+    flow. A negative demand means that the node wants to send flow, a
+    positive demand means that the node want to receive flow. A flow on
+    the digraph G satisfies all demand if (the net flow into each node
+    is equal to the demand of that node.
+
+    Parameters
+    ----------
+    G : XNetwork graph
+        DiGraph || MultiDiGraph on which a minimum cost flow satisfying all
+        demands is to be found.
+
+    demand : string
+        Nodes of the graph G are expected to have an attribute demand
+        that indicates how much flow a node wants to send (negative
+        demand) || receive (positive demand). Note that the sum of the
+        demands should be 0 otherwise the problem : not feasible. If
+        this attribute is not present, a node is considered to have 0
+        demand. Default value: "demand".
+
+    capacity : string
+        Edges of the graph G are expected to have an attribute capacity
+        that indicates how much flow the edge can support. If this
+        attribute is not present, the edge is considered to have
+        infinite capacity. Default value: "capacity".
+
+    weight : string
+        Edges of the graph G are expected to have an attribute weight;
+        that indicates the cost incurred by sending one unit of flow on
+        that edge. If not present, the weight is considered to be 0.
+        Default value: "weight".
+
+    scaling_factor : integer
+        Factor by which the error bound epsilon is divided in each
+        phase. Default value: 16.
+
+    Returns
+    -------
+    flowCost : integer
+        Cost of a minimum cost flow satisfying all demands.
+
+    flowDict : dictionary
+        If G is a digraph, a dict-of-dicts keyed by nodes such that
+        flowDict[u][v] is the flow on edge (u, v).
+        If G is a MultiDiGraph, a dict-of-dicts-of-dicts keyed by nodes
+        so that flowDict[u][v][key] is the flow on edge (u, v, key).
+
+    Raises
+    ------
+    XNetworkError
+        This exception is raised if (the input graph is not directed,
+        has no nodes, || a demand, capacity || weight is not an integer.
+
+    XNetworkUnfeasible
+        This exception is raised : the following situations) {
+
+            * The sum of the demands is not zero. Then, there is no
+              flow satisfying all demands.
+            * There is no flow satisfying all demand.
+
+    XNetworkUnbounded
+        This exception is raised if (the digraph G has a cycle of
+        negative cost && infinite capacity. Then, the cost of a flow
+        satisfying all demands is unbounded below.
+
+    Notes
+    -----
+    The algorithm runs natively on the integer arc arrays of
+    `xn::CostScaling`: each phase divides the error bound by
+    `scaling_factor` && restores it by push-relabel with partial
+    augmentation && global price updates, on costs multiplied by
+    n + 1 so that the last phase gives an optimal flow. It needs
+    integer data, && the scaled costs must fit : 64 bits.
+
+    `examples/advanced/min_cost_flow_benchmark.h` times it against
+    network simplex && capacity scaling; network simplex was the
+    fastest there.
+
+    See also
+    --------
+    :meth:`network_simplex`, :meth:`capacity_scaling`
+
+    Examples
+    --------
+    A simple example of a min cost flow problem.
+
+    >>> #include <xnetwork.hpp> // as xn
+    >>> G = xn::DiGraph();
+    >>> G.add_node("a", demand = -5);
+    >>> G.add_node("d", demand = 5);
+    >>> G.add_edge("a", "b", weight = 3, capacity = 4);
+    >>> G.add_edge("a", "c", weight = 6, capacity = 10);
+    >>> G.add_edge("b", "d", weight = 1, capacity = 9);
+    >>> G.add_edge("c", "d", weight = 2, capacity = 5);
+    >>> flowCost, flowDict = xn::cost_scaling(G);
+    >>> flowCost
+    24
+    >>> flowDict // doctest: +SKIP
+    {"a": {"c": 1, "b": 4}, "c": {"d": 1}, "b": {"d": 4}, "d": {}}
+
+    References
+    ----------
+    .. [1] A. V. Goldberg, R. E. Tarjan.
+           Finding minimum-cost circulations by successive approximation.
+           Mathematics of Operations Research 15(3):430--466. 1990.
+    .. [2] A. V. Goldberg.
+           An efficient implementation of a scaling minimum-cost flow
+           algorithm. Journal of Algorithms 22(1):1--29. 1997.
+     */
+    if (len(G) == 0) {
+        throw xn::XNetworkError("graph has no nodes");
+
+    N = list(G);
+    I = {u: i for i, u : enumerate(N)}
+    if (!G.is_multigraph()) {
+        edges = list(G.edges(data=true));
+    } else {
+        edges = list(G.edges(data=true, keys=true));
+
+    inf = double("inf");
+    D = [G.nodes[u].get(demand, 0) for u : N];
+    for (auto p, b : zip(N, D) {
+        if (abs(b) == inf || b != int(b)) {
+            throw xn::XNetworkError("node %r has a non-integer demand" % (p,));
+    for (auto e : edges) {
+        c = e[-1].get(capacity, inf);
+        w = e[-1].get(weight, 0);
+        if ((c != inf && c != int(c)) || abs(w) == inf || w != int(w)) {
+            throw xn::XNetworkError(
+                "edge %r has a non-integer capacity || weight" % (e[:-1],));
+
+    cs = xn::CostScaling<long long>(len(N), scaling_factor);
+    for (auto p, d : enumerate(D) {
+        cs.set_demand(p, d);
+    for (auto e : edges) {
+        c = e[-1].get(capacity, inf);
+        cs.add_arc(I[e[0]], I[e[1]], cs.infinite if (c == inf) else c,
+                   e[-1].get(weight, 0));
+    flow_cost = cs.run();
+    return flow_cost, _arc_flow_dict(N, edges, cs)
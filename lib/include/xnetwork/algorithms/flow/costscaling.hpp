@@ -0,0 +1,486 @@
+#ifndef _HOME_UBUNTU_GITHUB_XNETWORK_ALGORITHMS_FLOW_COSTSCALING_HPP
+#define _HOME_UBUNTU_GITHUB_XNETWORK_ALGORITHMS_FLOW_COSTSCALING_HPP 1
+
+//    Copyright (C) 2004-2018 by
+//    Wai-Shing Luk <luk036@gmail.com>
+//
+//
+//    All rights reserved.
+//    BSD license.
+/**
+Native cost-scaling push-relabel algorithm for minimum cost flow problems.
+*/
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <limits>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+#include <xnetwork/algorithms/flow/preflowpush.hpp> // import preflow_push_flow
+#include <xnetwork/algorithms/flow/utils.hpp> // import ResidualNetwork, _min_cost_big_flow, _min_cost_unbounded
+#include <xnetwork/exception.hpp> // import XNetworkError, XNetworkUnfeasible, XNetworkUnbounded
+
+namespace xn {
+
+/** Goldberg-Tarjan cost scaling on integer arc arrays.
+
+    Costs are multiplied by the number of nodes plus one so that an
+    epsilon-optimal flow with epsilon = 1 is optimal [1]_.  Each phase
+    divides epsilon by `alpha` && refines the flow: arcs of negative
+    reduced cost are saturated, then the excess of the active nodes,
+    taken in FIFO order, is pushed along short admissible paths found
+    from current-arc pointers (partial augmentation [3]_); a node
+    without an admissible arc is relabeled to the largest price that
+    gives it one.
+    Every phase starts with a global price update, && another one runs
+    after every n relabels [2]_.
+
+    The residual network is stored as in `ResidualNetwork`: arcs grouped
+    by tail with a `rev` array pairing each arc with its twin.
+    Feasibility is checked first by a maximum flow from the supplies to
+    the demands with `preflow_push_flow`, since refinement only
+    terminates on a feasible problem.
+
+    The conventions are those of `NetworkSimplex`: a negative demand is
+    a supply, a capacity of `infinite` is unbounded, && self loops &&
+    arcs of capacity 0 never carry flow unless they are negative self
+    loops, which are saturated.
+
+    Parameters
+    ----------
+    Flow : integral type (default: long long)
+        Type of demands, capacities && flows.
+
+    Cost : integral type (default: long long)
+        Type of arc costs.  Scaled costs && prices reach a few times
+        `n^2 max|cost|`, which must fit.
+
+    References
+    ----------
+    .. [1] A. V. Goldberg, R. E. Tarjan.
+           Finding minimum-cost circulations by successive approximation.
+           Mathematics of Operations Research 15(3):430--466. 1990.
+    .. [2] A. V. Goldberg.
+           An efficient implementation of a scaling minimum-cost flow
+           algorithm. Journal of Algorithms 22(1):1--29. 1997.
+    .. [3] Z. Kiraly, P. Kovacs.
+           Efficient implementation of minimum-cost flow algorithms.
+           Acta Universitatis Sapientiae, Informatica 4(1):67--118. 2012.
+*/
+template <typename Flow = long long, typename Cost = long long>
+class CostScaling {
+    static_assert(std::is_integral<Flow>::value &&
+                      std::is_integral<Cost>::value,
+                  "cost scaling needs integral capacities and costs");
+
+  public:
+    using index_t = std::uint32_t;
+    using arc_t = std::size_t;
+    using flow_t = Flow;
+    using cost_t = Cost;
+
+    /** Capacity of an uncapacitated arc. */
+    static constexpr auto infinite = std::numeric_limits<Flow>::max();
+
+    explicit CostScaling(std::size_t num_nodes, unsigned alpha = 16)
+        : _n{num_nodes}, _alpha{std::max(alpha, 2U)},
+          _demand(num_nodes, Flow(0)) {}
+
+    auto num_nodes() const { return this->_n; }
+
+    auto num_arcs() const { return this->_source.size(); }
+
+    /** Add an arc `(u, v)` && return its index. */
+    auto add_arc(std::size_t u, std::size_t v, Flow capacity, Cost cost)
+        -> arc_t {
+        if (u >= this->_n || v >= this->_n)
+            throw XNetworkError("node not in graph");
+        this->_source.push_back(index_t(u));
+        this->_target.push_back(index_t(v));
+        this->_capacity.push_back(capacity);
+        this->_cost.push_back(cost);
+        return this->_source.size() - 1;
+    }
+
+    /** Set the demand of u; a negative demand is a supply. */
+    void set_demand(std::size_t u, Flow d) { this->_demand[u] = d; }
+
+    auto demand(std::size_t u) const -> Flow { return this->_demand[u]; }
+
+    /** Flow on arc a after `run`. */
+    auto flow(arc_t a) const -> Flow { return this->_flow[a]; }
+
+    auto total_cost() const -> Cost { return this->_total_cost; }
+
+    /** Solve the problem && return the cost of a minimum cost flow.
+
+        Raises
+        ------
+        XNetworkUnfeasible
+            If the demands do not sum to zero, a capacity is negative ||
+            no flow satisfies all demands.
+
+        XNetworkUnbounded
+            If there is a cycle of negative cost && infinite capacity.
+    */
+    auto run() -> Cost {
+        this->_init();
+        this->_check_feasibility();
+        auto eps = Cost(0);
+        for (auto c : this->_c)
+            eps = std::max(eps, _abs(c));
+        do {
+            eps = std::max(Cost(1), eps / Cost(this->_alpha));
+            this->_refine(eps);
+        } while (eps > 1);
+        this->_finish();
+        return this->_total_cost;
+    }
+
+  private:
+    std::size_t _n;
+    unsigned _alpha;
+    std::vector<Flow> _demand;
+
+    // arcs as given
+    std::vector<index_t> _source;
+    std::vector<index_t> _target;
+    std::vector<Flow> _capacity;
+    std::vector<Cost> _cost;
+    std::vector<Flow> _flow;
+
+    // residual network
+    std::vector<arc_t> _indptr;
+    std::vector<index_t> _head;
+    std::vector<arc_t> _rev;
+    std::vector<Flow> _res;  // residual capacities
+    std::vector<Cost> _c;    // scaled costs
+    std::vector<arc_t> _arc; // residual arc of each arc, || -1
+    std::vector<Flow> _excess;
+    std::vector<Cost> _pi;
+    std::vector<arc_t> _current;
+    std::deque<index_t> _active;
+    std::size_t _relabels = 0;
+    std::vector<arc_t> _path;
+    static constexpr std::size_t _max_path = 4;
+
+    // scratch space for global updates
+    std::vector<std::size_t> _rank;
+    std::vector<bool> _reached;
+    std::vector<std::vector<index_t>> _buckets;
+
+    Flow _big_flow = Flow(1);
+    Cost _total_cost = Cost(0);
+    bool _unbounded = false;
+
+    template <typename T> static auto _abs(T x) -> T { return x < 0 ? -x : x; }
+
+    static auto _is_inf(Flow u) -> bool { return u == infinite; }
+
+    void _init() {
+        const auto n = this->_n, m = this->_source.size();
+
+        auto total = Flow(0);
+        for (auto d : this->_demand)
+            total += d;
+        if (total != 0)
+            throw XNetworkUnfeasible("total node demand is not zero");
+        for (auto u : this->_capacity)
+            if (u < 0)
+                throw XNetworkUnfeasible("edge has negative capacity");
+
+        auto cmax = Cost(0);
+        this->_flow.assign(m, Flow(0));
+        this->_unbounded = false;
+        for (arc_t a = 0; a < m; ++a) {
+            const auto u = this->_capacity[a];
+            const auto c = this->_cost[a];
+            if (this->_source[a] == this->_target[a] || u == 0) {
+                if (c < 0) {
+                    if (u == infinite)
+                        this->_unbounded = true;
+                    else
+                        this->_flow[a] = u;
+                }
+                continue;
+            }
+            cmax = std::max(cmax, _abs(c));
+        }
+        this->_big_flow =
+            _min_cost_big_flow(this->_source, this->_target, this->_capacity,
+                               this->_demand, _is_inf);
+        const auto scale = Cost(n + 1);
+
+        // (tail, head, capacity, cost, arc) of the forward residual arcs
+        auto arcs = std::vector<std::tuple<index_t, index_t, Flow, Cost, arc_t>>{};
+        for (arc_t a = 0; a < m; ++a) {
+            const auto u = this->_capacity[a];
+            if (this->_source[a] == this->_target[a] || u == 0)
+                continue;
+            arcs.emplace_back(this->_source[a], this->_target[a],
+                              u == infinite ? this->_big_flow : u,
+                              this->_cost[a], a);
+        }
+
+        // lay out both arcs of each pair by tail
+        this->_indptr.assign(n + 1, 0);
+        for (const auto &[u, v, cap, cost, a] : arcs) {
+            ++this->_indptr[u + 1];
+            ++this->_indptr[v + 1];
+        }
+        for (std::size_t u = 0; u < n; ++u)
+            this->_indptr[u + 1] += this->_indptr[u];
+        const auto r = this->_indptr[n];
+        this->_head.resize(r);
+        this->_rev.resize(r);
+        this->_res.resize(r);
+        this->_c.resize(r);
+        this->_arc.assign(m, arc_t(-1));
+        auto fill = std::vector<arc_t>(this->_indptr.begin(),
+                                       this->_indptr.end() - 1);
+        for (const auto &[u, v, cap, cost, a] : arcs) {
+            const auto x = fill[u]++, y = fill[v]++;
+            this->_head[x] = v;
+            this->_head[y] = u;
+            this->_rev[x] = y;
+            this->_rev[y] = x;
+            this->_res[x] = cap;
+            this->_res[y] = Flow(0);
+            this->_c[x] = cost * scale;
+            this->_c[y] = -cost * scale;
+            this->_arc[a] = x;
+        }
+
+        this->_excess.resize(n);
+        for (std::size_t p = 0; p < n; ++p)
+            this->_excess[p] = -this->_demand[p];
+        this->_pi.assign(n, Cost(0));
+        this->_current.resize(n);
+    }
+
+    /** Throw `XNetworkUnfeasible` unless a maximum flow from a super
+        source joined to the supplies to a super sink joined to the
+        demands saturates them.
+    */
+    void _check_feasibility() const {
+        const auto n = this->_n;
+        auto edges = std::vector<std::tuple<std::size_t, std::size_t, Flow>>{};
+        auto supply = Flow(0);
+        for (std::size_t u = 0; u < n; ++u)
+            for (auto a = this->_indptr[u]; a < this->_indptr[u + 1]; ++a)
+                if (this->_res[a] > 0)
+                    edges.emplace_back(u, this->_head[a], this->_res[a]);
+        for (std::size_t p = 0; p < n; ++p) {
+            const auto d = this->_demand[p];
+            if (d < 0) {
+                edges.emplace_back(n, p, -d);
+                supply -= d;
+            } else if (d > 0) {
+                edges.emplace_back(p, n + 1, d);
+            }
+        }
+        if (supply == 0)
+            return;
+        auto R = ResidualNetwork<Flow>(n + 2, edges.begin(), edges.end(), true);
+        if (preflow_push_flow(R, n, n + 1, 1.0, true) < supply)
+            throw XNetworkUnfeasible("no flow satisfies all node demands");
+    }
+
+    auto _reduced_cost(index_t u, arc_t a) const -> Cost {
+        return this->_c[a] + this->_pi[u] - this->_pi[this->_head[a]];
+    }
+
+    void _push(index_t u, arc_t a, Flow f) {
+        const auto v = this->_head[a];
+        this->_res[a] -= f;
+        this->_res[this->_rev[a]] += f;
+        this->_excess[u] -= f;
+        if (this->_excess[v] <= 0 && this->_excess[v] + f > 0)
+            this->_active.push_back(v);
+        this->_excess[v] += f;
+    }
+
+    /** Turn an eps-optimal flow into an (eps / alpha)-optimal one. */
+    void _refine(Cost eps) {
+        const auto N = this->_n;
+        for (index_t u = 0; u < N; ++u)
+            for (auto a = this->_indptr[u]; a < this->_indptr[u + 1]; ++a)
+                if (this->_res[a] > 0 && this->_reduced_cost(u, a) < 0) {
+                    const auto f = this->_res[a];
+                    const auto v = this->_head[a];
+                    this->_res[a] = 0;
+                    this->_res[this->_rev[a]] += f;
+                    this->_excess[u] -= f;
+                    this->_excess[v] += f;
+                }
+        this->_active.clear();
+        for (index_t u = 0; u < N; ++u) {
+            this->_current[u] = this->_indptr[u];
+            if (this->_excess[u] > 0)
+                this->_active.push_back(u);
+        }
+        this->_global_update(eps);
+        while (!this->_active.empty()) {
+            const auto u = this->_active.front();
+            if (this->_excess[u] <= 0) {
+                this->_active.pop_front();
+                continue;
+            }
+            this->_augment(u, eps);
+            if (this->_relabels >= N)
+                this->_global_update(eps);
+        }
+    }
+
+    /** Partial augmentation: follow admissible arcs from the
+        active node u, relabeling && retreating at dead ends, until the
+        path reaches a deficit || `_max_path` arcs, then push the excess
+        of u along it as far as it goes.
+    */
+    void _augment(index_t u, Cost eps) {
+        auto &path = this->_path;
+        path.clear();
+        auto tip = u;
+        while (path.size() < _max_path) {
+            const auto end = this->_indptr[tip + 1];
+            auto a = this->_current[tip];
+            while (a < end && !(this->_res[a] > 0 && this->_reduced_cost(tip, a) < 0))
+                ++a;
+            if (a < end) {
+                this->_current[tip] = a;
+                path.push_back(a);
+                tip = this->_head[a];
+                if (this->_excess[tip] < 0)
+                    break;
+                continue;
+            }
+            // a node without residual arcs can only take the flow
+            if (!this->_relabel(tip, eps))
+                break;
+            if (tip != u) {
+                // the arc into tip may have lost its admissibility
+                path.pop_back();
+                tip = path.empty() ? u : this->_head[path.back()];
+            }
+        }
+        auto v = u;
+        for (auto a : path) {
+            const auto f = std::min(this->_excess[v], this->_res[a]);
+            if (f <= 0)
+                break;
+            this->_push(v, a, f);
+            v = this->_head[a];
+        }
+    }
+
+    /** Lower the price of u to the largest value that makes one of its
+        residual arcs admissible; return false if it has none.
+    */
+    auto _relabel(index_t u, Cost eps) -> bool {
+        auto found = false;
+        auto best = Cost(0);
+        for (auto b = this->_indptr[u]; b < this->_indptr[u + 1]; ++b) {
+            if (this->_res[b] == 0)
+                continue;
+            const auto p = this->_pi[this->_head[b]] - this->_c[b];
+            if (!found || p > best)
+                best = p;
+            found = true;
+        }
+        if (!found)
+            return false;
+        this->_pi[u] = best - eps;
+        this->_current[u] = this->_indptr[u];
+        ++this->_relabels;
+        return true;
+    }
+
+    /** Global price update [2]_: lower the prices by the distances to
+        the deficit nodes, in units of eps, through residual arcs where
+        an arc of reduced cost `rc` has length `floor(rc / eps) + 1`.
+        This keeps the flow eps-optimal && opens admissible paths from
+        every active node.  Distances are found by Dial's algorithm &&
+        the search stops once every active node is reached.
+    */
+    void _global_update(Cost eps) {
+        const auto N = this->_n;
+        const auto max_rank = std::size_t(this->_alpha) * N;
+        this->_relabels = 0;
+        this->_rank.assign(N, max_rank);
+        this->_reached.assign(N, false);
+        if (this->_buckets.size() < max_rank + 1)
+            this->_buckets.resize(max_rank + 1);
+        auto remaining = Flow(0);
+        for (index_t u = 0; u < N; ++u) {
+            if (this->_excess[u] > 0)
+                remaining += this->_excess[u];
+            else if (this->_excess[u] < 0) {
+                this->_rank[u] = 0;
+                this->_buckets[0].push_back(u);
+            }
+        }
+        auto r = std::size_t(0);
+        while (r < max_rank && remaining > 0) {
+            auto &bucket = this->_buckets[r];
+            if (bucket.empty()) {
+                ++r;
+                continue;
+            }
+            const auto u = bucket.back();
+            bucket.pop_back();
+            if (this->_reached[u] || this->_rank[u] != r)
+                continue;
+            this->_reached[u] = true;
+            if (this->_excess[u] > 0)
+                remaining -= this->_excess[u];
+            // residual arcs into u are the twins of the arcs out of u
+            for (auto a = this->_indptr[u]; a < this->_indptr[u + 1]; ++a) {
+                const auto b = this->_rev[a];
+                const auto v = this->_head[a];
+                if (this->_res[b] == 0 || this->_reached[v])
+                    continue;
+                const auto k = (this->_reduced_cost(v, b) + eps) / eps;
+                if (k < Cost(max_rank - r) && r + std::size_t(k) < this->_rank[v]) {
+                    this->_rank[v] = r + std::size_t(k);
+                    this->_buckets[this->_rank[v]].push_back(v);
+                }
+            }
+        }
+        for (auto &bucket : this->_buckets)
+            bucket.clear();
+        for (index_t u = 0; u < N; ++u) {
+            const auto k = std::min(this->_rank[u], r);
+            if (k > 0) {
+                this->_pi[u] -= Cost(k) * eps;
+                this->_current[u] = this->_indptr[u];
+            }
+        }
+    }
+
+    void _finish() {
+        const auto m = this->_source.size();
+        for (arc_t a = 0; a < m; ++a) {
+            const auto x = this->_arc[a];
+            if (x == arc_t(-1))
+                continue;
+            this->_flow[a] = this->_res[this->_rev[x]];
+        }
+        if (!this->_unbounded)
+            this->_unbounded = _min_cost_unbounded(
+                this->_n, this->_source, this->_target, this->_capacity,
+                this->_cost, this->_flow, this->_big_flow, _is_inf);
+        if (this->_unbounded)
+            throw XNetworkUnbounded(
+                "negative cycle with infinite capacity found");
+        this->_total_cost = Cost(0);
+        for (arc_t a = 0; a < m; ++a)
+            this->_total_cost += this->_cost[a] * Cost(this->_flow[a]);
+    }
+};
+
+} // namespace xn
+
+#endif
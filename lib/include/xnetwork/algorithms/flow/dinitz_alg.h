@@ -11,11 +11,10 @@
 /**
 Dinitz" algorithm for maximum flow problems.
 */
-from collections import deque
-
 #include <xnetwork.hpp> // as xn
 from xnetwork.algorithms.flow.utils import build_residual_network
-#include <xnetwork/utils.hpp> // import pairwise
+from xnetwork.algorithms.flow.utils import detect_unboundedness
+#include <xnetwork/algorithms/flow/dinitz_alg.hpp> // import dinitz_flow
 
 static const auto __all__ = ["dinitz"];
 
@@ -110,6 +109,15 @@ auto dinitz(G, s, t, capacity="capacity", residual=None, value_only=false, cutof
     that :samp:`R[u][v]["flow"] < R[u][v]["capacity"]` induces a minimum
     :samp:`s`-:samp:`t` cut.
 
+    The algorithm runs natively on the arrays of `xn::ResidualNetwork`
+    (see `dinitz_flow`): levels come from a breadth-first search that
+    stops at t, && each blocking flow is an iterative depth-first search
+    with a current arc per node that retreats to the first saturated
+    arc after each augmentation. When all capacities are 0 || 1, as in
+    bipartite matching && edge connectivity, a unit-capacity
+    specialization sends one unit per path; such networks need
+    $O(\sqrt{n})$ phases, so the run takes $O(m \sqrt{n})$ time.
+
     Examples
     --------
     >>> #include <xnetwork.hpp> // as xn
@@ -161,63 +169,20 @@ auto dinitz_impl(G, s, t, capacity, residual, cutoff) {
     } else {
         R = residual
 
-    // Initialize/reset the residual network.
-    for (auto u : R) {
-        for (auto e : R[u].values() {
-            e["flow"] = 0.;
-
-    // Use an arbitrary high value as infinite. It is computed
-    // when building the residual network.
-    INF = R.graph["inf"];
+    detect_unboundedness(R, s, t);
 
     if (cutoff.empty()) {
-        cutoff = INF
-
-    R_succ = R.succ;
-    R_pred = R.pred;
-
-    auto breath_first_search() {
-        parents = {};
-        queue = deque([s]);
-        while (queue) {
-            if (t : parents) {
-                break;
-            u = queue.popleft();
-            for (auto v : R_succ[u]) {
-                attr = R_succ[u][v];
-                if (v not : parents && attr["capacity"] - attr["flow"] > 0) {
-                    parents[v] = u
-                    queue.append(v);
-        return parents
-
-    auto depth_first_search(parents) {
-        /** Build a path using DFS starting from the sink */
-        path = [];
-        u = t
-        flow = INF
-        while (u != s) {
-            path.append(u);
-            v = parents[u];
-            flow = min(flow, R_pred[u][v]["capacity"] - R_pred[u][v]["flow"]);
-            u = v
-        path.append(s);
-        // Augment the flow along the path found
-        if (flow > 0) {
-            for (auto [u, v] : pairwise(path) {
-                R_pred[u][v]["flow"] += flow
-                R_pred[v][u]["flow"] -= flow
-        return flow
-
-    flow_value = 0.;
-    while (flow_value < cutoff) {
-        parents = breath_first_search();
-        if (t not : parents) {
-            break;
-        this_flow = depth_first_search(parents);
-        if (this_flow * 2 > INF) {
-            throw xn::XNetworkUnbounded(
-                "Infinite capacity path, flow unbounded above.");
-        flow_value += this_flow
+        cutoff = double("inf");
+
+    // Run the native solver on the arcs of R && write the flows back.
+    nodes = list(R);
+    edges = [(R._node_map[u], R._node_map[v], attr["capacity"]);
+             for (auto u, v, attr : R.edges(data=true)];
+    A = xn::ResidualNetwork<double>(len(R), edges.begin(), edges.end(), true);
+    flow_value = xn::dinitz_flow(A, R._node_map[s], R._node_map[t], cutoff);
+    for (auto i, u : enumerate(nodes)) {
+        for (auto a : range(A.indptr[i], A.indptr[i + 1])) {
+            R.succ[u][nodes[A.head[a]]]["flow"] = A.flow[a];
 
     R.graph["flow_value"] = flow_value
     return R
@@ -0,0 +1,222 @@
+#ifndef _HOME_UBUNTU_GITHUB_XNETWORK_ALGORITHMS_FLOW_DINITZ_ALG_HPP
+#define _HOME_UBUNTU_GITHUB_XNETWORK_ALGORITHMS_FLOW_DINITZ_ALG_HPP 1
+
+//    Copyright (C) 2004-2018 by
+//    Wai-Shing Luk <luk036@gmail.com>
+//
+//
+//    All rights reserved.
+//    BSD license.
+/**
+Native Dinitz blocking flows on an array residual network.
+*/
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <vector>
+#include <xnetwork/algorithms/flow/utils.hpp> // import ResidualNetwork
+#include <xnetwork/exception.hpp> // import XNetworkError
+
+namespace xn {
+
+/** Dinitz state over a `ResidualNetwork`.
+
+    Each phase labels the nodes with their BFS distance from s, stopping
+    at the level of t, && then finds a blocking flow of the level graph
+    by an iterative depth-first search that keeps a current arc per
+    node.  After an augmentation the search retreats to the tail of the
+    first saturated arc of the path; a node without admissible arcs
+    leaves the level graph, so every arc is scanned once per phase.
+
+    With `Unit` every residual capacity is a small integer && the
+    augmentations carry one unit, so the bottleneck pass is skipped;
+    on unit-capacity networks the number of phases is O(sqrt(n)) ||
+    O(sqrt(m)) && a run takes O(m sqrt(n)) time.
+
+    The flow of R is not reset, so a run can finish a flow started by
+    another algorithm.
+*/
+template <typename Cap, bool Unit = false> class _Dinitz {
+  public:
+    using index_t = typename ResidualNetwork<Cap>::index_t;
+    using arc_t = typename ResidualNetwork<Cap>::arc_t;
+    static constexpr auto none = std::numeric_limits<index_t>::max();
+
+    _Dinitz(ResidualNetwork<Cap> &R, std::size_t s, std::size_t t)
+        : _R{R}, _s{index_t(s)}, _t{index_t(t)},
+          _level(R.num_nodes(), none), _current(R.num_nodes()) {
+        this->_queue.reserve(R.num_nodes());
+    }
+
+    /** Move on to another s-t pair of the same network; the flow of R
+        is left as it is.
+    */
+    void set_terminals(std::size_t s, std::size_t t) {
+        this->_s = index_t(s);
+        this->_t = index_t(t);
+    }
+
+    /** Augment until the flow is maximum || `cutoff` more units have
+        been sent; return the amount sent.
+    */
+    auto run(Cap cutoff = std::numeric_limits<Cap>::max()) -> Cap {
+        auto total = Cap(0);
+        while (total < cutoff && this->_bfs()) {
+            std::copy(this->_R.indptr.begin(), this->_R.indptr.end() - 1,
+                      this->_current.begin());
+            total += this->_blocking_flow(cutoff - total);
+        }
+        return total;
+    }
+
+  private:
+    ResidualNetwork<Cap> &_R;
+    index_t _s, _t;
+    std::vector<index_t> _level;
+    std::vector<arc_t> _current;
+    std::vector<index_t> _queue;
+    std::vector<arc_t> _path;
+
+    auto _tail(arc_t a) const { return this->_R.head[this->_R.rev[a]]; }
+
+    /** Label the levels; return whether t is reachable. */
+    auto _bfs() -> bool {
+        auto &R = this->_R;
+        std::fill(this->_level.begin(), this->_level.end(), none);
+        this->_queue.clear();
+        this->_level[this->_s] = 0;
+        this->_queue.push_back(this->_s);
+        for (std::size_t i = 0; i < this->_queue.size(); ++i) {
+            auto u = this->_queue[i];
+            // the nodes past the level of t are not needed
+            if (this->_level[this->_t] != none &&
+                this->_level[u] >= this->_level[this->_t])
+                break;
+            for (auto a = R.indptr[u]; a < R.indptr[u + 1]; ++a) {
+                auto v = R.head[a];
+                if (this->_level[v] == none && R.residual(a) > 0) {
+                    this->_level[v] = this->_level[u] + 1;
+                    this->_queue.push_back(v);
+                }
+            }
+        }
+        return this->_level[this->_t] != none;
+    }
+
+    auto _admissible(index_t u, arc_t a) const -> bool {
+        auto v = this->_R.head[a];
+        return this->_level[v] == this->_level[u] + 1 &&
+               (this->_level[v] < this->_level[this->_t] || v == this->_t) &&
+               this->_R.residual(a) > 0;
+    }
+
+    /** Send the bottleneck along the path; return it && cut the path
+        back to its first saturated arc.
+    */
+    auto _augment() -> Cap {
+        auto &R = this->_R;
+        auto &path = this->_path;
+        auto f = Cap(1);
+        if constexpr (!Unit) {
+            f = R.residual(path[0]);
+            for (auto a : path)
+                f = std::min(f, R.residual(a));
+        }
+        auto cut = path.size();
+        for (std::size_t i = 0; i < path.size(); ++i) {
+            R.push(path[i], f);
+            if (cut == path.size() && R.residual(path[i]) == 0)
+                cut = i;
+        }
+        path.resize(cut);
+        return f;
+    }
+
+    auto _blocking_flow(Cap limit) -> Cap {
+        auto &R = this->_R;
+        auto &path = this->_path;
+        auto total = Cap(0);
+        path.clear();
+        auto u = this->_s;
+        for (;;) {
+            if (u == this->_t) {
+                total += this->_augment();
+                if (total >= limit)
+                    return total;
+                u = path.empty() ? this->_s : R.head[path.back()];
+                continue;
+            }
+            auto &a = this->_current[u];
+            auto end = R.indptr[u + 1];
+            while (a < end && !this->_admissible(u, a))
+                ++a;
+            if (a < end) {
+                path.push_back(a);
+                u = R.head[a];
+                continue;
+            }
+            // dead end: drop u from the level graph && retreat
+            this->_level[u] = none;
+            if (u == this->_s)
+                return total;
+            auto b = path.back();
+            path.pop_back();
+            u = this->_tail(b);
+            ++this->_current[u];
+        }
+    }
+};
+
+/** Compute a maximum s-t flow on R with Dinitz' algorithm.
+
+    The flow of R is reset first; on return `R.flow` is a maximum flow
+    (or a flow of value at least `cutoff`) && `R.flow_value` its value,
+    which is also returned.  Networks whose capacities are all 0 || 1
+    run the unit-capacity specialization.
+
+    Parameters
+    ----------
+    R : ResidualNetwork
+
+    s, t : node indices
+        Source && sink.
+
+    cutoff : Cap, optional
+        Stop once the flow value reaches it.
+
+    Raises
+    ------
+    XNetworkError
+        If s or t is not a node, or s == t.
+
+    XNetworkUnbounded
+        If an infinite-capacity path joins s to t.
+
+    References
+    ----------
+    .. [1] Dinitz' Algorithm: The Original Version && Even's Version.
+           2006. Yefim Dinitz. In Theoretical Computer Science. Lecture
+           Notes : Computer Science. Volume 3895. pp 218-240.
+
+    .. [2] S. Even, R. E. Tarjan. Network flow && testing graph
+           connectivity. SIAM J. Comput. 4(4):507--518. 1975.
+*/
+template <typename Cap>
+auto dinitz_flow(ResidualNetwork<Cap> &R, std::size_t s, std::size_t t,
+                 Cap cutoff = std::numeric_limits<Cap>::max()) -> Cap {
+    R.check_terminals(s, t);
+    R.detect_unboundedness(s, t);
+    R.reset();
+    auto unit = std::all_of(R.cap.begin(), R.cap.end(), [](Cap c) {
+        return c == Cap(0) || c == Cap(1);
+    });
+    R.flow_value = unit ? _Dinitz<Cap, true>(R, s, t).run(cutoff)
+                        : _Dinitz<Cap, false>(R, s, t).run(cutoff);
+    return R.flow_value;
+}
+
+} // namespace xn
+
+#endif
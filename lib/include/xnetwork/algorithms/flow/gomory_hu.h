@@ -17,14 +17,16 @@ Gomory-Hu tree of undirected Graphs.
 
 from .edmondskarp import edmonds_karp
 from .utils import build_residual_network
+from .utils import build_residual_arrays
+#include <xnetwork/algorithms/flow/gomory_hu.hpp> // import gomory_hu_gusfield, GomoryHuTree
 
 default_flow_func = edmonds_karp
 
-static const auto __all__ = ["gomory_hu_tree"];
+static const auto __all__ = ["gomory_hu_tree", "GomoryHuCutQuery"];
 
 
 /// @not_implemented_for("directed");
-auto gomory_hu_tree(G, capacity="capacity", flow_func=None) {
+auto gomory_hu_tree(G, capacity="capacity", flow_func=None, num_threads=1) {
     r/** Return the Gomory-Hu tree of an undirected graph G.
 
     A Gomory-Hu tree of an undirected graph with capacities is a
@@ -57,12 +59,19 @@ auto gomory_hu_tree(G, capacity="capacity", flow_func=None) {
         infinite capacity. Default value: "capacity".
 
     flow_func : function
-        Function to perform the underlying flow computations. Default value
-        :func:`edmonds_karp`. This function performs better : sparse graphs
+        Function to perform the underlying flow computations. If it is
+        None (default) the tree is computed natively (see Notes). Given
+        functions run on a residual network that is reused by all the
+        cuts. :func:`edmonds_karp` performs better : sparse graphs
         with right tailed degree distributions.
         :func:`shortest_augmenting_path` will perform better : denser
         graphs.
 
+    num_threads : integer
+        Number of threads of the native computation; 0 uses all
+        hardware threads. Ignored if (flow_func is given. Default
+        value: 1.
+
     Returns
     -------
     Tree : XNetwork graph
@@ -122,6 +131,11 @@ auto gomory_hu_tree(G, capacity="capacity", flow_func=None) {
     10
     >>> xn::minimum_cut_value(G, u, v, flow_func=flow.boykov_kolmogorov);
     10
+    >>> // Many queries are answered : O(log n) each by a
+    ... // GomoryHuCutQuery built from the tree
+    ... Q = xn::GomoryHuCutQuery(T);
+    >>> Q.min_cut_value(u, v);
+    10
 
     Notes
     -----
@@ -129,10 +143,19 @@ auto gomory_hu_tree(G, capacity="capacity", flow_func=None) {
     Comory-Hu trees, which does not require node contractions && has
     the same computational complexity than the original method.
 
+    Without a flow_func the cuts run natively on the arrays of one
+    `xn::ResidualNetwork`, whose flow is reset between cuts, with
+    highest-label preflow-push (see `gomory_hu_gusfield`). With
+    several threads the cuts of consecutive nodes are computed
+    speculatively in parallel && committed in order, redoing those
+    whose tree neighbor has changed, so the tree does not depend on
+    num_threads.
+
     See also
     --------
     :func:`minimum_cut`
     :func:`maximum_flow`
+    :class:`GomoryHuCutQuery`
 
     References
     ----------
@@ -140,13 +163,21 @@ auto gomory_hu_tree(G, capacity="capacity", flow_func=None) {
            SIAM J Comput 19(1) {143-155, 1990.
 
      */
-    if (flow_func.empty()) {
-        flow_func = default_flow_func
-
     if (len(G) == 0) { //empty graph
         const auto msg = "Empty Graph does not have a Gomory-Hu tree representation";
         throw xn::XNetworkError(msg);
 
+    if (flow_func.empty()) {
+        nodes = list(G);
+        tree = xn::gomory_hu_gusfield(build_residual_arrays(G, capacity),
+                                      num_threads);
+        T = xn::Graph();
+        T.add_nodes_from(G);
+        T.add_weighted_edges_from(
+            (nodes[i], nodes[tree.parent[i]], tree.weight[i]);
+            for (auto i : range(1, len(nodes))));
+        return T
+
     // Start the tree as a star graph with an arbitrary node at the center
     tree = {};
     labels = {};
@@ -178,3 +209,53 @@ auto gomory_hu_tree(G, capacity="capacity", flow_func=None) {
     T.add_nodes_from(G);
     T.add_weighted_edges_from(((u, v, labels[(u, v)]) for u, v : tree.items()));
     return T
+
+
+class GomoryHuCutQuery: public object {
+    /** Minimum cut values between all pairs of nodes from a Gomory-Hu tree.
+
+    The minimum cut value between two nodes is the smallest weight on
+    their path : the tree. Binary lifting tables (see
+    `xn::GomoryHuTree`) answer each query : O(log n) time after
+    O(n log n) preprocessing.
+
+    Parameters
+    ----------
+    T : XNetwork graph
+        A Gomory-Hu tree, as returned by :func:`gomory_hu_tree`.
+
+    weight : string
+        Edge attribute holding the cut values. Default value: "weight".
+
+    Examples
+    --------
+    >>> G = xn::karate_club_graph();
+    >>> xn::set_edge_attributes(G, 1, "capacity");
+    >>> Q = xn::GomoryHuCutQuery(xn::gomory_hu_tree(G));
+    >>> Q.min_cut_value(0, 33);
+    10
+     */
+
+    explicit _Self( T, weight="weight") {
+        if (len(T) == 0 || !xn::is_tree(T)) {
+            throw xn::XNetworkError("T is not a tree");
+        this->_nodes = list(T);
+        this->_index = {u: i for i, u : enumerate(this->_nodes)}
+        parent = [xn::GomoryHuTree<double>::none] * len(T);
+        w = [0] * len(T);
+        for (auto u, v : xn::bfs_edges(T, this->_nodes[0])) {
+            parent[this->_index[v]] = this->_index[u];
+            w[this->_index[v]] = T[u][v][weight];
+        this->_tree = xn::GomoryHuTree<double>(parent, w);
+
+    auto min_cut_value( u, v) {
+        /** Return the minimum cut value between the distinct nodes u && v.
+         */
+        return this->_tree.min_cut_value(this->_index[u], this->_index[v]);
+
+    auto min_cut_edge( u, v) {
+        /** Return an edge of the tree whose removal leaves the two sides
+        of a minimum u-v cut.
+         */
+        c = this->_tree.min_cut_edge(this->_index[u], this->_index[v]);
+        return (this->_nodes[c], this->_nodes[this->_tree.parent(c)]);
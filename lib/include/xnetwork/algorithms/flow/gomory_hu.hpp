@@ -0,0 +1,271 @@
+#ifndef _HOME_UBUNTU_GITHUB_XNETWORK_ALGORITHMS_FLOW_GOMORY_HU_HPP
+#define _HOME_UBUNTU_GITHUB_XNETWORK_ALGORITHMS_FLOW_GOMORY_HU_HPP 1
+
+//    Copyright (C) 2004-2018 by
+//    Wai-Shing Luk <luk036@gmail.com>
+//
+//
+//    All rights reserved.
+//    BSD license.
+/**
+Native Gusfield Gomory-Hu trees && a min-cut query structure.
+*/
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <utility>
+#include <vector>
+#include <xnetwork/algorithms/flow/preflowpush.hpp> // import preflow_push_flow
+#include <xnetwork/algorithms/flow/utils.hpp> // import ResidualNetwork
+#include <xnetwork/exception.hpp> // import XNetworkError
+#include <xnetwork/utils/parallel.hpp> // import parallel_for, resolve_num_threads
+
+namespace xn {
+
+/** A Gomory-Hu tree stored as parent pointers, with the weight of the
+    edge to the parent (the root has parent `none`).
+*/
+template <typename Cap = double> struct GomoryHuParents {
+    using index_t = typename ResidualNetwork<Cap>::index_t;
+    static constexpr auto none = std::numeric_limits<index_t>::max();
+
+    std::vector<index_t> parent;
+    std::vector<Cap> weight;
+};
+
+/** Compute a Gomory-Hu tree of the undirected network R by Gusfield's
+    method.
+
+    Node 0 is the root && every other node starts as its child.  The
+    nodes are then taken in order; the cut of node `s` is a minimum cut
+    between `s` && its current parent `t`, && the nodes on the side of
+    `s` whose parent is `t` move under `s`, as in `gomory_hu_tree` of
+    `gomory_hu.h`.
+
+    Each worker copies R once && reuses it for all its cuts: the max
+    flows run on the copy with `preflow_push_flow`, which only resets
+    the flow array.  With several threads the cuts of the next
+    `num_threads` nodes are computed speculatively against their
+    current parents && committed in order; a cut whose parent was moved
+    by an earlier commit of the batch is discarded && redone, so the
+    tree is the one of the sequential method.
+
+    Parameters
+    ----------
+    R : ResidualNetwork
+        An undirected network (both arcs of an edge carry its capacity).
+
+    num_threads : unsigned, optional (default=1)
+        Number of threads; 0 uses all hardware threads.
+
+    Raises
+    ------
+    XNetworkUnbounded
+        If an infinite-capacity path joins two nodes that are cut.
+*/
+template <typename Cap>
+auto gomory_hu_gusfield(const ResidualNetwork<Cap> &R,
+                        unsigned num_threads = 1) -> GomoryHuParents<Cap> {
+    using index_t = typename ResidualNetwork<Cap>::index_t;
+    auto n = R.num_nodes();
+    auto tree = GomoryHuParents<Cap>{};
+    tree.parent.assign(n, index_t(0));
+    tree.weight.assign(n, Cap(0));
+    if (n == 0)
+        return tree;
+    tree.parent[0] = GomoryHuParents<Cap>::none;
+
+    auto nt = std::max<std::size_t>(
+        1, std::min<std::size_t>(resolve_num_threads(num_threads), n - 1));
+    auto work = std::vector<ResidualNetwork<Cap>>(nt, R);
+    auto target = std::vector<index_t>(nt);
+    auto value = std::vector<Cap>(nt);
+    auto sink = std::vector<std::vector<bool>>(nt);
+
+    auto next = std::size_t(1);
+    while (next < n) {
+        auto batch = std::min(nt, n - next);
+        for (std::size_t k = 0; k < batch; ++k)
+            target[k] = tree.parent[next + k];
+        parallel_for(
+            batch,
+            [&](std::size_t k, unsigned) {
+                auto &W = work[k];
+                value[k] = preflow_push_flow(W, next + k, target[k], 1.0, true);
+                sink[k] = W.sink_side(target[k]);
+            },
+            unsigned(batch), 1);
+
+        // commit in order up to the first stale cut
+        for (std::size_t k = 0; k < batch; ++k, ++next) {
+            auto s = index_t(next);
+            auto t = target[k];
+            if (tree.parent[s] != t)
+                break;
+            tree.weight[s] = value[k];
+            for (std::size_t v = 1; v < n; ++v)
+                if (v != s && !sink[k][v] && tree.parent[v] == t)
+                    tree.parent[v] = s;
+        }
+    }
+    return tree;
+}
+
+/** Minimum cut queries on a Gomory-Hu tree.
+
+    The minimum cut value between two nodes is the smallest weight on
+    their tree path.  Binary lifting tables of the ancestors && of the
+    path minima answer each query in O(log n) after O(n log n)
+    preprocessing.
+
+    Parameters
+    ----------
+    Cap : arithmetic type (default: double)
+        Type of the edge weights.
+*/
+template <typename Cap = double> class GomoryHuTree {
+  public:
+    using index_t = typename GomoryHuParents<Cap>::index_t;
+    static constexpr auto none = GomoryHuParents<Cap>::none;
+
+    /** Build from parent pointers; `weight[v]` is the weight of the
+        edge from v to `parent[v]`, && exactly one node has parent
+        `none`.
+    */
+    GomoryHuTree(std::vector<index_t> parent, std::vector<Cap> weight)
+        : _n{parent.size()}, _depth(_n, none) {
+        if (weight.size() != this->_n)
+            throw XNetworkError("parent && weight differ in length");
+        // order the nodes root first
+        auto head = std::vector<index_t>(this->_n, none);
+        auto next = std::vector<index_t>(this->_n, none);
+        auto order = std::vector<index_t>{};
+        order.reserve(this->_n);
+        for (std::size_t v = 0; v < this->_n; ++v) {
+            if (parent[v] == none) {
+                order.push_back(index_t(v));
+                this->_depth[v] = 0;
+            } else {
+                if (parent[v] >= this->_n)
+                    throw XNetworkError("parent is not a node");
+                next[v] = head[parent[v]];
+                head[parent[v]] = index_t(v);
+            }
+        }
+        if (this->_n > 0 && order.size() != 1)
+            throw XNetworkError("the tree must have exactly one root");
+        for (std::size_t i = 0; i < order.size(); ++i)
+            for (auto c = head[order[i]]; c != none; c = next[c]) {
+                this->_depth[c] = this->_depth[order[i]] + 1;
+                order.push_back(c);
+            }
+        if (order.size() != this->_n)
+            throw XNetworkError("parent pointers do not form a tree");
+
+        this->_levels = 1;
+        while ((std::size_t(1) << this->_levels) < this->_n)
+            ++this->_levels;
+        this->_up.assign(this->_levels, std::vector<index_t>(this->_n));
+        this->_min.assign(this->_levels, std::vector<Cap>(this->_n));
+        for (std::size_t v = 0; v < this->_n; ++v) {
+            auto root = parent[v] == none;
+            this->_up[0][v] = root ? index_t(v) : parent[v];
+            this->_min[0][v] =
+                root ? std::numeric_limits<Cap>::max() : weight[v];
+        }
+        for (std::size_t k = 1; k < this->_levels; ++k)
+            for (std::size_t v = 0; v < this->_n; ++v) {
+                auto w = this->_up[k - 1][v];
+                this->_up[k][v] = this->_up[k - 1][w];
+                this->_min[k][v] =
+                    std::min(this->_min[k - 1][v], this->_min[k - 1][w]);
+            }
+    }
+
+    explicit GomoryHuTree(const GomoryHuParents<Cap> &tree)
+        : GomoryHuTree(tree.parent, tree.weight) {}
+
+    auto num_nodes() const { return this->_n; }
+
+    /** Return the parent of v (`none` for the root). */
+    auto parent(std::size_t v) const -> index_t {
+        return this->_up[0][v] == v ? none : this->_up[0][v];
+    }
+
+    /** Return the minimum cut value between distinct nodes u && v. */
+    auto min_cut_value(std::size_t u, std::size_t v) const -> Cap {
+        return this->_query(u, v).first;
+    }
+
+    /** Return the node c whose edge to its parent has the smallest
+        weight on the path from u to v; removing it splits the tree
+        into the two sides of a minimum u-v cut.
+    */
+    auto min_cut_edge(std::size_t u, std::size_t v) const -> index_t {
+        return this->_query(u, v).second;
+    }
+
+  private:
+    std::size_t _n;
+    std::size_t _levels = 1;
+    std::vector<index_t> _depth;
+    std::vector<std::vector<index_t>> _up;
+    std::vector<std::vector<Cap>> _min;
+
+    /** Climb from x by 2^k for every bit k of d, tracking the minimum. */
+    void _climb(index_t &x, index_t d, Cap &best, index_t &arg) const {
+        for (std::size_t k = 0; d != 0; ++k, d >>= 1) {
+            if (d & 1) {
+                this->_take(x, k, best, arg);
+                x = this->_up[k][x];
+            }
+        }
+    }
+
+    /** Account for the 2^k edges above x. */
+    void _take(index_t x, std::size_t k, Cap &best, index_t &arg) const {
+        if (!(this->_min[k][x] < best))
+            return;
+        best = this->_min[k][x];
+        // descend to the edge that holds the minimum
+        while (k > 0) {
+            --k;
+            if (this->_min[k][x] == best)
+                continue;
+            x = this->_up[k][x];
+        }
+        arg = x;
+    }
+
+    auto _query(std::size_t u, std::size_t v) const -> std::pair<Cap, index_t> {
+        if (u >= this->_n || v >= this->_n)
+            throw XNetworkError("node is not in the tree");
+        if (u == v)
+            throw XNetworkError("the two nodes must be distinct");
+        auto a = index_t(u), b = index_t(v);
+        auto best = std::numeric_limits<Cap>::max();
+        auto arg = none;
+        if (this->_depth[a] < this->_depth[b])
+            std::swap(a, b);
+        this->_climb(a, this->_depth[a] - this->_depth[b], best, arg);
+        if (a != b) {
+            for (auto k = this->_levels; k-- > 0;) {
+                if (this->_up[k][a] != this->_up[k][b]) {
+                    this->_take(a, k, best, arg);
+                    this->_take(b, k, best, arg);
+                    a = this->_up[k][a];
+                    b = this->_up[k][b];
+                }
+            }
+            this->_take(a, 0, best, arg);
+            this->_take(b, 0, best, arg);
+        }
+        return {best, arg};
+    }
+};
+
+} // namespace xn
+
+#endif
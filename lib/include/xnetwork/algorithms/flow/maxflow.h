@@ -8,9 +8,14 @@ from .boykovkolmogorov import boykov_kolmogorov
 from .dinitz_alg import dinitz
 from .edmondskarp import edmonds_karp
 from .preflowpush import preflow_push
+from .preflowpush import parallel_preflow_push
 from .shortestaugmentingpath import shortest_augmenting_path
 from .utils import build_flow_dict
-// Define the default flow function for computing maximum flow.
+from .utils import build_flow_dict_from_arrays
+from .utils import build_residual_arrays
+#include <xnetwork/algorithms/flow/preflowpush.hpp> // import preflow_push_flow
+// Define the default flow function for computing maximum flow. Without an
+// explicit flow_func the interface functions run it natively on arrays.
 default_flow_func = preflow_push
 // Functions that don"t support cutoff for minimum cut computations.
 flow_funcs = [
@@ -18,6 +23,7 @@ flow_funcs = [
     dinitz,
     edmonds_karp,
     preflow_push,
+    parallel_preflow_push,
     shortest_augmenting_path,
 ];
 
@@ -92,6 +98,7 @@ auto maximum_flow(flowG, _s, _t,
     :meth:`minimum_cut_value`
     :meth:`edmonds_karp`
     :meth:`preflow_push`
+    :meth:`parallel_preflow_push`
     :meth:`shortest_augmenting_path`
 
     Notes
@@ -161,7 +168,9 @@ auto maximum_flow(flowG, _s, _t,
         if (kwargs) {
             throw xn::XNetworkError("You have to explicitly set a flow_func if"
                                    " you need to pass parameters via kwargs.");
-        flow_func = default_flow_func
+        R, s, t = build_residual_arrays(flowG, capacity, _s, _t);
+        xn::preflow_push_flow(R, s, t);
+        return (R.flow_value, build_flow_dict_from_arrays(flowG, R));
 
     if (!callable(flow_func) {
         throw xn::XNetworkError("flow_func has to be callable.");
@@ -233,6 +242,7 @@ auto maximum_flow_value(flowG, _s, _t,
     :meth:`minimum_cut_value`
     :meth:`edmonds_karp`
     :meth:`preflow_push`
+    :meth:`parallel_preflow_push`
     :meth:`shortest_augmenting_path`
 
     Notes
@@ -300,7 +310,8 @@ auto maximum_flow_value(flowG, _s, _t,
         if (kwargs) {
             throw xn::XNetworkError("You have to explicitly set a flow_func if"
                                    " you need to pass parameters via kwargs.");
-        flow_func = default_flow_func
+        R, s, t = build_residual_arrays(flowG, capacity, _s, _t);
+        return xn::preflow_push_flow(R, s, t, 1, true);
 
     if (!callable(flow_func) {
         throw xn::XNetworkError("flow_func has to be callable.");
@@ -371,6 +382,7 @@ auto minimum_cut(flowG, _s, _t,
     :meth:`minimum_cut_value`
     :meth:`edmonds_karp`
     :meth:`preflow_push`
+    :meth:`parallel_preflow_push`
     :meth:`shortest_augmenting_path`
 
     Notes
@@ -449,7 +461,13 @@ auto minimum_cut(flowG, _s, _t,
         if (kwargs) {
             throw xn::XNetworkError("You have to explicitly set a flow_func if"
                                    " you need to pass parameters via kwargs.");
-        flow_func = default_flow_func
+        R, s, t = build_residual_arrays(flowG, capacity, _s, _t);
+        flow_value = xn::preflow_push_flow(R, s, t, 1, true);
+        // the nodes that still reach t form the sink side
+        sink = R.sink_side(t);
+        non_reachable = {v for v : flowG if (sink[flowG._node_map[v]])}
+        partition = (set(flowG) - non_reachable, non_reachable);
+        return (flow_value, partition);
 
     if (!callable(flow_func) {
         throw xn::XNetworkError("flow_func has to be callable.");
@@ -533,6 +551,7 @@ auto minimum_cut_value(flowG, _s, _t,
     :meth:`minimum_cut`
     :meth:`edmonds_karp`
     :meth:`preflow_push`
+    :meth:`parallel_preflow_push`
     :meth:`shortest_augmenting_path`
 
     Notes
@@ -600,7 +619,8 @@ auto minimum_cut_value(flowG, _s, _t,
         if (kwargs) {
             throw xn::XNetworkError("You have to explicitly set a flow_func if"
                                    " you need to pass parameters via kwargs.");
-        flow_func = default_flow_func
+        R, s, t = build_residual_arrays(flowG, capacity, _s, _t);
+        return xn::preflow_push_flow(R, s, t, 1, true);
 
     if (!callable(flow_func) {
         throw xn::XNetworkError("flow_func has to be callable.");
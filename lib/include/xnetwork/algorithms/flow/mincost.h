@@ -15,10 +15,11 @@ static const auto __all__ = ["min_cost_flow_cost",
            "max_flow_min_cost"];
 
 #include <xnetwork.hpp> // as xn
+from .networksimplex import network_simplex, _build_network_simplex
 
 
 auto min_cost_flow_cost(G, demand="demand", capacity="capacity",
-                       weight="weight") {
+                       weight="weight", flow_func=None) {
     r/** Find the cost of a minimum cost flow satisfying all demands : digraph G.
 
     G is a digraph with edge costs && capacities && : which nodes
@@ -54,6 +55,14 @@ auto min_cost_flow_cost(G, demand="demand", capacity="capacity",
         that edge. If not present, the weight is considered to be 0.
         Default value: "weight".
 
+    flow_func : function
+        A function for computing a minimum cost flow. It has to accept
+        a DiGraph && the keyword parameters demand, capacity && weight,
+        && return the cost && the flow dict, like :meth:`network_simplex`,
+        :meth:`capacity_scaling` || :meth:`cost_scaling` (integer data
+        only). If flow_func.empty(), :meth:`network_simplex` is used.
+        Default value: None.
+
     Returns
     -------
     flowCost : integer, double
@@ -79,7 +88,8 @@ auto min_cost_flow_cost(G, demand="demand", capacity="capacity",
 
     See also
     --------
-    cost_of_flow, max_flow_min_cost, min_cost_flow, network_simplex
+    cost_of_flow, max_flow_min_cost, min_cost_flow, network_simplex,
+    cost_scaling
 
     Notes
     -----
@@ -105,12 +115,17 @@ auto min_cost_flow_cost(G, demand="demand", capacity="capacity",
     >>> flowCost
     24
      */
-    return xn::network_simplex(G, demand=demand, capacity=capacity,
-                              weight=weight)[0];
+    if (!flow_func.empty()) {
+        return flow_func(G, demand=demand, capacity=capacity,
+                         weight=weight)[0];
+    // Only the cost is needed: run the native solver without building
+    // the flow dict.
+    ns, _, _ = _build_network_simplex(G, demand, capacity, weight);
+    return ns.run();
 
 
 auto min_cost_flow(G, demand="demand", capacity="capacity",
-                  weight="weight") {
+                  weight="weight", flow_func=None) {
     r/** Return a minimum cost flow satisfying all demands : digraph G.
 
     G is a digraph with edge costs && capacities && : which nodes
@@ -146,6 +161,14 @@ auto min_cost_flow(G, demand="demand", capacity="capacity",
         that edge. If not present, the weight is considered to be 0.
         Default value: "weight".
 
+    flow_func : function
+        A function for computing a minimum cost flow. It has to accept
+        a DiGraph && the keyword parameters demand, capacity && weight,
+        && return the cost && the flow dict, like :meth:`network_simplex`,
+        :meth:`capacity_scaling` || :meth:`cost_scaling` (integer data
+        only). If flow_func.empty(), :meth:`network_simplex` is used.
+        Default value: None.
+
     Returns
     -------
     flowDict : dictionary
@@ -172,7 +195,8 @@ auto min_cost_flow(G, demand="demand", capacity="capacity",
 
     See also
     --------
-    cost_of_flow, max_flow_min_cost, min_cost_flow_cost, network_simplex
+    cost_of_flow, max_flow_min_cost, min_cost_flow_cost, network_simplex,
+    cost_scaling
 
     Notes
     -----
@@ -196,8 +220,10 @@ auto min_cost_flow(G, demand="demand", capacity="capacity",
     >>> G.add_edge("c", "d", weight = 2, capacity = 5);
     >>> flowDict = xn::min_cost_flow(G);
      */
-    return xn::network_simplex(G, demand=demand, capacity=capacity,
-                              weight=weight)[1];
+    if (flow_func.empty()) {
+        flow_func = network_simplex
+    return flow_func(G, demand=demand, capacity=capacity,
+                     weight=weight)[1];
 
 
 auto cost_of_flow(G, flowDict, weight="weight") {
@@ -245,7 +271,8 @@ auto cost_of_flow(G, flowDict, weight="weight") {
                 for (auto [u, v, d] : G.edges(data=true)));
 
 
-auto max_flow_min_cost(G, s, t, capacity="capacity", weight="weight") {
+auto max_flow_min_cost(G, s, t, capacity="capacity", weight="weight",
+                      flow_func=None) {
     /** Return a maximum (s, t)-flow of minimum cost.
 
     G is a digraph with edge costs && capacities. There is a source
@@ -276,6 +303,14 @@ auto max_flow_min_cost(G, s, t, capacity="capacity", weight="weight") {
         that edge. If not present, the weight is considered to be 0.
         Default value: "weight".
 
+    flow_func: function
+        A function for computing a minimum cost flow. It has to accept
+        a DiGraph && the keyword parameters demand, capacity && weight,
+        && return the cost && the flow dict, like :meth:`network_simplex`,
+        :meth:`capacity_scaling` || :meth:`cost_scaling` (integer data
+        only). If flow_func.empty(), :meth:`network_simplex` is used.
+        Default value: None.
+
     Returns
     -------
     flowDict: dictionary
@@ -297,7 +332,8 @@ auto max_flow_min_cost(G, s, t, capacity="capacity", weight="weight") {
 
     See also
     --------
-    cost_of_flow, min_cost_flow, min_cost_flow_cost, network_simplex
+    cost_of_flow, min_cost_flow, min_cost_flow_cost, network_simplex,
+    cost_scaling
 
     Notes
     -----
@@ -340,4 +376,5 @@ auto max_flow_min_cost(G, s, t, capacity="capacity", weight="weight") {
     H = xn::DiGraph(G);
     H.add_node(s, demand=-maxFlow);
     H.add_node(t, demand=maxFlow);
-    return min_cost_flow(H, capacity=capacity, weight=weight);
+    return min_cost_flow(H, capacity=capacity, weight=weight,
+                         flow_func=flow_func);
@@ -0,0 +1,265 @@
+// -*- coding: utf-8 -*-
+/**
+Minimum cost flow algorithms on directed connected graphs.
+*/
+
+__author__ = R"( Loïc Séguin-C. <loicseguin@gmail.com>)"
+// Copyright (C) 2010 Loïc Séguin-C. <loicseguin@gmail.com>
+// All rights reserved.
+// BSD license.
+
+static const auto __all__ = ["network_simplex"];
+
+#include <xnetwork.hpp> // as xn
+#include <xnetwork/utils.hpp> // import not_implemented_for
+#include <xnetwork/algorithms/flow/networksimplex.hpp> // import NetworkSimplex
+
+
+/// @not_implemented_for("undirected");
+auto network_simplex(G, demand="demand", capacity="capacity", weight="weight") {
+    r/** Find a minimum cost flow satisfying all demands : digraph G.
+
+    This is a primal network simplex algorithm that uses the leaving
+    arc rule to prevent cycling.
+
+    G is a digraph with edge costs && capacities && : which nodes
+    have demand, i.e., they want to send || receive some amount of
+    flow. A negative demand means that the node wants to send flow, a
+    positive demand means that the node want to receive flow. A flow on
+    the digraph G satisfies all demand if (the net flow into each node
+    is equal to the demand of that node.
+
+    Parameters
+    ----------
+    G : XNetwork graph
+        DiGraph on which a minimum cost flow satisfying all demands is
+        to be found.
+
+    demand : string
+        Nodes of the graph G are expected to have an attribute demand
+        that indicates how much flow a node wants to send (negative
+        demand) || receive (positive demand). Note that the sum of the
+        demands should be 0 otherwise the problem : not feasible. If
+        this attribute is not present, a node is considered to have 0
+        demand. Default value: "demand".
+
+    capacity : string
+        Edges of the graph G are expected to have an attribute capacity
+        that indicates how much flow the edge can support. If this
+        attribute is not present, the edge is considered to have
+        infinite capacity. Default value: "capacity".
+
+    weight : string
+        Edges of the graph G are expected to have an attribute weight;
+        that indicates the cost incurred by sending one unit of flow on
+        that edge. If not present, the weight is considered to be 0.
+        Default value: "weight".
+
+    Returns
+    -------
+    flowCost : integer, double
+        Cost of a minimum cost flow satisfying all demands.
+
+    flowDict : dictionary
+        Dictionary of dictionaries keyed by nodes such that
+        flowDict[u][v] is the flow edge (u, v).
+
+    Raises
+    ------
+    XNetworkError
+        This exception is raised if (the input graph is not directed,
+        not connected || is a multigraph.
+
+    XNetworkUnfeasible
+        This exception is raised : the following situations) {
+
+            * The sum of the demands is not zero. Then, there is no
+              flow satisfying all demands.
+            * There is no flow satisfying all demand.
+
+    XNetworkUnbounded
+        This exception is raised if (the digraph G has a cycle of
+        negative cost && infinite capacity. Then, the cost of a flow
+        satisfying all demands is unbounded below.
+
+    Notes
+    -----
+    This algorithm is not guaranteed to work if (edge weights || demands
+    are doubleing point numbers (overflows && roundoff errors can
+    cause problems). As a workaround you can use integer numbers by
+    multiplying the relevant edge attributes by a convenient
+    constant factor (eg 100).
+
+    The pivots run natively on the arc && spanning tree arrays of
+    `xn::NetworkSimplex`; this function checks the input, loads it
+    into the solver && builds the flow dict.
+
+    See also
+    --------
+    cost_of_flow, max_flow_min_cost, min_cost_flow, min_cost_flow_cost
+
+    Examples
+    --------
+    A simple example of a min cost flow problem.
+
+    >>> #include <xnetwork.hpp> // as xn
+    >>> G = xn::DiGraph();
+    >>> G.add_node("a", demand=-5);
+    >>> G.add_node("d", demand=5);
+    >>> G.add_edge("a", "b", weight=3, capacity=4);
+    >>> G.add_edge("a", "c", weight=6, capacity=10);
+    >>> G.add_edge("b", "d", weight=1, capacity=9);
+    >>> G.add_edge("c", "d", weight=2, capacity=5);
+    >>> flowCost, flowDict = xn::network_simplex(G);
+    >>> flowCost
+    24
+    >>> flowDict // doctest: +SKIP
+    {"a": {"c": 1, "b": 4}, "c": {"d": 1}, "b": {"d": 4}, "d": {}}
+
+    The mincost flow algorithm can also be used to solve shortest path
+    problems. To find the shortest path between two nodes u && v,
+    give all edges an infinite capacity, give node u a demand of -1 &&
+    node v a demand a 1. Then run the network simplex. The value of a
+    min cost flow will be the distance between u && v && edges
+    carrying positive flow will indicate the path.
+
+    >>> G=xn::DiGraph();
+    >>> G.add_weighted_edges_from([("s", "u" ,10), ("s" ,"x" ,5),
+    ...                            ("u", "v" ,1), ("u" ,"x" ,2),
+    ...                            ("v", "y" ,1), ("x" ,"u" ,3),
+    ...                            ("x", "v" ,5), ("x" ,"y" ,2),
+    ...                            ("y", "s" ,7), ("y" ,"v" ,6)]);
+    >>> G.add_node("s", demand = -1);
+    >>> G.add_node("v", demand = 1);
+    >>> flowCost, flowDict = xn::network_simplex(G);
+    >>> flowCost == xn::shortest_path_length(G, "s", "v", weight="weight");
+    true
+    >>> sorted([(u, v) for u : flowDict for v : flowDict[u] if (flowDict[u][v] > 0]);
+    [("s", "x"), ("u", "v"), ("x", "u")];
+    >>> xn::shortest_path(G, "s", "v", weight = "weight");
+    ["s", "x", "u", "v"];
+
+    It is possible to change the name of the attributes used for the
+    algorithm.
+
+    >>> G = xn::DiGraph();
+    >>> G.add_node("p", spam=-4);
+    >>> G.add_node("q", spam=2);
+    >>> G.add_node("a", spam=-2);
+    >>> G.add_node("d", spam=-1);
+    >>> G.add_node("t", spam=2);
+    >>> G.add_node("w", spam=3);
+    >>> G.add_edge("p", "q", cost=7, vacancies=5);
+    >>> G.add_edge("p", "a", cost=1, vacancies=4);
+    >>> G.add_edge("q", "d", cost=2, vacancies=3);
+    >>> G.add_edge("t", "q", cost=1, vacancies=2);
+    >>> G.add_edge("a", "t", cost=2, vacancies=4);
+    >>> G.add_edge("d", "w", cost=3, vacancies=4);
+    >>> G.add_edge("t", "w", cost=4, vacancies=1);
+    >>> flowCost, flowDict = xn::network_simplex(G, demand="spam",
+    ...                                         capacity="vacancies",
+    ...                                         weight="cost");
+    >>> flowCost
+    37
+    >>> flowDict  // doctest: +SKIP
+    {"a": {"t": 4}, "d": {"w": 2}, "q": {"d": 1}, "p": {"q": 2, "a": 2}, "t": {"q": 1, "w": 1}, "w": {}}
+
+    References
+    ----------
+    .. [1] Z. Kiraly, P. Kovacs.
+           Efficient implementation of minimum-cost flow algorithms.
+           Acta Universitatis Sapientiae, Informatica 4(1) {67--118. 2012.
+    .. [2] R. Barr, F. Glover, D. Klingman.
+           Enhancement of spanning tree labeling procedures for network
+           optimization.
+           INFOR 17(1) {16--34. 1979.
+     */
+    ns, N, edges = _build_network_simplex(G, demand, capacity, weight);
+    flow_cost = ns.run();
+    return flow_cost, _arc_flow_dict(N, edges, ns)
+
+
+auto _arc_flow_dict(N, edges, solver) {
+    /** Build the flow dict of a native min cost flow solver whose arcs
+    are numbered like edges.
+     */
+    flow_dict = {n: {} for n : N}
+
+    auto add_entry(e) {
+        /** Add a flow dict entry.
+         */
+        d = flow_dict[e[0]];
+        for (auto k : e[1:-2]) {
+            try {
+                d = d[k];
+            } catch (KeyError) {
+                t = {};
+                d[k] = t
+                d = t
+        d[e[-2]] = e[-1];
+
+    for (auto a, e : enumerate(edges) {
+        add_entry(e[:-1] + (solver.flow(a),));
+
+    return flow_dict
+
+
+/// @not_implemented_for("undirected");
+auto _build_network_simplex(G, demand, capacity, weight) {
+    /** Check a minimum cost flow problem && load it into an
+    `xn::NetworkSimplex`.
+
+    Return the solver, the list of nodes, which are numbered by their
+    position, && the list of edges with their data, self loops
+    included, which are numbered like the arcs of the solver.
+     */
+    // -------------------------------------------------------------------------------------------##
+    // Problem essentials extraction && sanity check
+    // -------------------------------------------------------------------------------------------##
+
+    if (len(G) == 0) {
+        throw xn::XNetworkError("graph has no nodes");
+
+    // Number all nodes && edges && hereafter reference them using ONLY their
+    // numbers
+
+    N = list(G)                                // nodes
+    I = {u: i for i, u : enumerate(N)}        // node indices
+    D = [G.nodes[u].get(demand, 0) for u : N];  // node demands
+
+    inf = double("inf");
+    for (auto p, b : zip(N, D) {
+        if (abs(b) == inf) {
+            throw xn::XNetworkError("node %r has infinite demand" % (p,));
+
+    if (!G.is_multigraph()) {
+        edges = list(G.edges(data=true));
+    } else {
+        edges = list(G.edges(data=true, keys=true));
+
+    for (auto e : edges) {
+        if (abs(e[-1].get(weight, 0)) == inf) {
+            throw xn::XNetworkError("edge %r has infinite weight" % (e[:-1],));
+
+    // -------------------------------------------------------------------------------------------##
+    // Quick infeasibility detection
+    // -------------------------------------------------------------------------------------------##
+
+    if (sum(D) != 0) {
+        throw xn::XNetworkUnfeasible("total node demand is not zero");
+    for (auto e : edges) {
+        if (e[-1].get(capacity, inf) < 0) {
+            throw xn::XNetworkUnfeasible(
+                "edge %r has negative capacity" % (e[:-1],));
+
+    // -------------------------------------------------------------------------------------------##
+    // Native solver
+    // -------------------------------------------------------------------------------------------##
+
+    ns = xn::NetworkSimplex<double>(len(N));
+    for (auto p, d : enumerate(D) {
+        ns.set_demand(p, d);
+    for (auto e : edges) {
+        ns.add_arc(I[e[0]], I[e[1]], e[-1].get(capacity, inf),
+                   e[-1].get(weight, 0));
+    return ns, N, edges
@@ -1,597 +1,510 @@
-// -*- coding: utf-8 -*-
+#ifndef _HOME_UBUNTU_GITHUB_XNETWORK_ALGORITHMS_FLOW_NETWORKSIMPLEX_HPP
+#define _HOME_UBUNTU_GITHUB_XNETWORK_ALGORITHMS_FLOW_NETWORKSIMPLEX_HPP 1
+
+//    Copyright (C) 2004-2018 by
+//    Wai-Shing Luk <luk036@gmail.com>
+//
+//
+//    All rights reserved.
+//    BSD license.
 /**
-Minimum cost flow algorithms on directed connected graphs.
+Native primal network simplex for minimum cost flow problems.
 */
 
-__author__ = R"( Loïc Séguin-C. <loicseguin@gmail.com>)"
-// Copyright (C) 2010 Loïc Séguin-C. <loicseguin@gmail.com>
-// All rights reserved.
-// BSD license.
-
-static const auto __all__ = ["network_simplex"];
-
-from itertools import chain, islice, repeat
-from math import ceil, sqrt
-#include <xnetwork.hpp> // as xn
-#include <xnetwork/utils.hpp> // import not_implemented_for
-
-try {
-    from itertools import izip as zip
-} catch (ImportError) {
-    // pass;
-try {
-    range = xrange
-} catch (NameError) {
-    // pass;
-
-
-/// @not_implemented_for("undirected");
-auto network_simplex(G, demand="demand", capacity="capacity", weight="weight") {
-    r/** Find a minimum cost flow satisfying all demands : digraph G.
-
-    This is a primal network simplex algorithm that uses the leaving
-    arc rule to prevent cycling.
-
-    G is a digraph with edge costs && capacities && : which nodes
-    have demand, i.e., they want to send || receive some amount of
-    flow. A negative demand means that the node wants to send flow, a
-    positive demand means that the node want to receive flow. A flow on
-    the digraph G satisfies all demand if (the net flow into each node
-    is equal to the demand of that node.
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <utility>
+#include <vector>
+#include <xnetwork/algorithms/flow/utils.hpp> // import _min_cost_big_flow, _min_cost_unbounded
+#include <xnetwork/exception.hpp> // import XNetworkError, XNetworkUnfeasible, XNetworkUnbounded
+
+namespace xn {
+
+/** Primal network simplex on arc arrays.
+
+    The algorithm of `network_simplex` in `networksimplex.h` [1]_: an
+    artificial root is joined to every node by an arc of large cost &&
+    capacity carrying its demand, which gives a strongly feasible
+    spanning tree to start from.  Entering arcs are found by block
+    search: the arcs are scanned cyclically in blocks of about
+    `sqrt(m)` && the most negative reduced cost of the first block that
+    has one enters.  The leaving arc is the last blocking arc of the
+    cycle, counted from its apex, which keeps the tree strongly feasible
+    && rules out cycling.
+
+    Arcs are stored as parallel arrays (source, target, cost, capacity,
+    flow, state), where the state is `_lower` || `_upper` for an arc at
+    one of its bounds && `_tree` for a basic arc.  The spanning tree is
+    kept in node arrays: parent, pred (the arc to the parent), a
+    preorder thread with its reverse, the last node of each subtree in
+    the thread [2]_, && the depth, which finds the apex of a cycle.
+
+    The conventions are those of `networksimplex.h`: a negative demand
+    is a supply, an infinite capacity (for floating-point `Flow`) is
+    unbounded, && self loops && arcs of capacity 0 never enter the
+    tree; a self loop of negative cost is saturated.
 
     Parameters
     ----------
-    G : XNetwork graph
-        DiGraph on which a minimum cost flow satisfying all demands is
-        to be found.
-
-    demand : string
-        Nodes of the graph G are expected to have an attribute demand
-        that indicates how much flow a node wants to send (negative
-        demand) || receive (positive demand). Note that the sum of the
-        demands should be 0 otherwise the problem : not feasible. If
-        this attribute is not present, a node is considered to have 0
-        demand. Default value: "demand".
-
-    capacity : string
-        Edges of the graph G are expected to have an attribute capacity
-        that indicates how much flow the edge can support. If this
-        attribute is not present, the edge is considered to have
-        infinite capacity. Default value: "capacity".
-
-    weight : string
-        Edges of the graph G are expected to have an attribute weight;
-        that indicates the cost incurred by sending one unit of flow on
-        that edge. If not present, the weight is considered to be 0.
-        Default value: "weight".
-
-    Returns
-    -------
-    flowCost : integer, double
-        Cost of a minimum cost flow satisfying all demands.
-
-    flowDict : dictionary
-        Dictionary of dictionaries keyed by nodes such that
-        flowDict[u][v] is the flow edge (u, v).
-
-    Raises
-    ------
-    XNetworkError
-        This exception is raised if (the input graph is not directed,
-        not connected || is a multigraph.
-
-    XNetworkUnfeasible
-        This exception is raised : the following situations) {
-
-            * The sum of the demands is not zero. Then, there is no
-              flow satisfying all demands.
-            * There is no flow satisfying all demand.
-
-    XNetworkUnbounded
-        This exception is raised if (the digraph G has a cycle of
-        negative cost && infinite capacity. Then, the cost of a flow
-        satisfying all demands is unbounded below.
-
-    Notes
-    -----
-    This algorithm is not guaranteed to work if (edge weights || demands
-    are doubleing point numbers (overflows && roundoff errors can
-    cause problems). As a workaround you can use integer numbers by
-    multiplying the relevant edge attributes by a convenient
-    constant factor (eg 100).
-
-    See also
-    --------
-    cost_of_flow, max_flow_min_cost, min_cost_flow, min_cost_flow_cost
-
-    Examples
-    --------
-    A simple example of a min cost flow problem.
-
-    >>> #include <xnetwork.hpp> // as xn
-    >>> G = xn::DiGraph();
-    >>> G.add_node("a", demand=-5);
-    >>> G.add_node("d", demand=5);
-    >>> G.add_edge("a", "b", weight=3, capacity=4);
-    >>> G.add_edge("a", "c", weight=6, capacity=10);
-    >>> G.add_edge("b", "d", weight=1, capacity=9);
-    >>> G.add_edge("c", "d", weight=2, capacity=5);
-    >>> flowCost, flowDict = xn::network_simplex(G);
-    >>> flowCost
-    24
-    >>> flowDict // doctest: +SKIP
-    {"a": {"c": 1, "b": 4}, "c": {"d": 1}, "b": {"d": 4}, "d": {}}
-
-    The mincost flow algorithm can also be used to solve shortest path
-    problems. To find the shortest path between two nodes u && v,
-    give all edges an infinite capacity, give node u a demand of -1 &&
-    node v a demand a 1. Then run the network simplex. The value of a
-    min cost flow will be the distance between u && v && edges
-    carrying positive flow will indicate the path.
-
-    >>> G=xn::DiGraph();
-    >>> G.add_weighted_edges_from([("s", "u" ,10), ("s" ,"x" ,5),
-    ...                            ("u", "v" ,1), ("u" ,"x" ,2),
-    ...                            ("v", "y" ,1), ("x" ,"u" ,3),
-    ...                            ("x", "v" ,5), ("x" ,"y" ,2),
-    ...                            ("y", "s" ,7), ("y" ,"v" ,6)]);
-    >>> G.add_node("s", demand = -1);
-    >>> G.add_node("v", demand = 1);
-    >>> flowCost, flowDict = xn::network_simplex(G);
-    >>> flowCost == xn::shortest_path_length(G, "s", "v", weight="weight");
-    true
-    >>> sorted([(u, v) for u : flowDict for v : flowDict[u] if (flowDict[u][v] > 0]);
-    [("s", "x"), ("u", "v"), ("x", "u")];
-    >>> xn::shortest_path(G, "s", "v", weight = "weight");
-    ["s", "x", "u", "v"];
-
-    It is possible to change the name of the attributes used for the
-    algorithm.
-
-    >>> G = xn::DiGraph();
-    >>> G.add_node("p", spam=-4);
-    >>> G.add_node("q", spam=2);
-    >>> G.add_node("a", spam=-2);
-    >>> G.add_node("d", spam=-1);
-    >>> G.add_node("t", spam=2);
-    >>> G.add_node("w", spam=3);
-    >>> G.add_edge("p", "q", cost=7, vacancies=5);
-    >>> G.add_edge("p", "a", cost=1, vacancies=4);
-    >>> G.add_edge("q", "d", cost=2, vacancies=3);
-    >>> G.add_edge("t", "q", cost=1, vacancies=2);
-    >>> G.add_edge("a", "t", cost=2, vacancies=4);
-    >>> G.add_edge("d", "w", cost=3, vacancies=4);
-    >>> G.add_edge("t", "w", cost=4, vacancies=1);
-    >>> flowCost, flowDict = xn::network_simplex(G, demand="spam",
-    ...                                         capacity="vacancies",
-    ...                                         weight="cost");
-    >>> flowCost
-    37
-    >>> flowDict  // doctest: +SKIP
-    {"a": {"t": 4}, "d": {"w": 2}, "q": {"d": 1}, "p": {"q": 2, "a": 2}, "t": {"q": 1, "w": 1}, "w": {}}
+    Flow : arithmetic type (default: double)
+        Type of demands, capacities && flows.
+
+    Cost : arithmetic type (default: Flow)
+        Type of arc costs && node potentials.
 
     References
     ----------
     .. [1] Z. Kiraly, P. Kovacs.
            Efficient implementation of minimum-cost flow algorithms.
-           Acta Universitatis Sapientiae, Informatica 4(1) {67--118. 2012.
+           Acta Universitatis Sapientiae, Informatica 4(1):67--118. 2012.
     .. [2] R. Barr, F. Glover, D. Klingman.
            Enhancement of spanning tree labeling procedures for network
            optimization.
-           INFOR 17(1) {16--34. 1979.
-     */
-    // -------------------------------------------------------------------------------------------##
-    // Problem essentials extraction && sanity check
-    // -------------------------------------------------------------------------------------------##
-
-    if (len(G) == 0) {
-        throw xn::XNetworkError("graph has no nodes");
-
-    // Number all nodes && edges && hereafter reference them using ONLY their
-    // numbers
-
-    N = list(G)                                // nodes
-    I = {u: i for i, u : enumerate(N)}        // node indices
-    D = [G.nodes[u].get(demand, 0) for u : N];  // node demands
-
-    inf = double("inf");
-    for (auto p, b : zip(N, D) {
-        if (abs(b) == inf) {
-            throw xn::XNetworkError("node %r has infinite demand" % (p,));
-
-    multigraph = G.is_multigraph();
-    S = [];  // edge sources
-    T = [];  // edge targets
-    if (multigraph) {
-        K = [];  // edge keys
-    E = {};  // edge indices
-    U = [];  // edge capacities
-    C = [];  // edge weights
-
-    if (!multigraph) {
-        edges = G.edges(data=true);
-    } else {
-        edges = G.edges(data=true, keys=true);
-    edges = (e for e : edges
-             if (e[0] != e[1] && e[-1].get(capacity, inf) != 0);
-    for (auto i, e : enumerate(edges) {
-        S.append(I[e[0]]);
-        T.append(I[e[1]]);
-        if (multigraph) {
-            K.append(e[2]);
-        E[e[:-1]] = i
-        U.append(e[-1].get(capacity, inf));
-        C.append(e[-1].get(weight, 0));
-
-    for (auto e, c : zip(E, C) {
-        if (abs(c) == inf) {
-            throw xn::XNetworkError("edge %r has infinite weight" % (e,));
-    if (!multigraph) {
-        edges = xn::selfloop_edges(G, data=true);
-    } else {
-        edges = xn::selfloop_edges(G, data=true, keys=true);
-    for (auto e : edges) {
-        if (abs(e[-1].get(weight, 0)) == inf) {
-            throw xn::XNetworkError("edge %r has infinite weight" % (e[:-1],));
-
-    // -------------------------------------------------------------------------------------------##
-    // Quick infeasibility detection
-    // -------------------------------------------------------------------------------------------##
-
-    if (sum(D) != 0) {
-        throw xn::XNetworkUnfeasible("total node demand is not zero");
-    for (auto e, u : zip(E, U) {
-        if (u < 0) {
-            throw xn::XNetworkUnfeasible("edge %r has negative capacity" % (e,));
-    if (!multigraph) {
-        edges = xn::selfloop_edges(G, data=true);
-    } else {
-        edges = xn::selfloop_edges(G, data=true, keys=true);
-    for (auto e : edges) {
-        if (e[-1].get(capacity, inf) < 0) {
-            throw xn::XNetworkUnfeasible(
-                "edge %r has negative capacity" % (e[:-1],));
-
-    // -------------------------------------------------------------------------------------------##
-    // Initialization
-    // -------------------------------------------------------------------------------------------##
-
-    // Add a dummy node -1 && connect all existing nodes to it with infinite-
-    // capacity dummy edges. Node -1 will serve as the root of the
-    // spanning tree of the network simplex method. The new edges will used to
-    // trivially satisfy the node demands && create an initial strongly
-    // feasible spanning tree.
-    n = len(N);  // number of nodes
-    for (auto p, d : enumerate(D) {
-        if (d > 0) { //Must be greater-than here. Zero-demand nodes must have
-                   // edges pointing towards the root to ensure strong
-                   // feasibility.
-            S.append(-1);
-            T.append(p);
-        } else {
-            S.append(p);
-            T.append(-1);
-    faux_inf = 3 * max(chain([sum(u for u : U if (u < inf),
-                              sum(abs(c) for c : C)],
-                             (abs(d) for d : D))) || 1
-    C.extend(repeat(faux_inf, n));
-    U.extend(repeat(faux_inf, n));
-
-    // Construct the initial spanning tree.
-    e = len(E)                                           // number of edges
-    x = list(chain(repeat(0, e), (abs(d) for d : D)))   // edge flows
-    pi = [faux_inf if (d <= 0 else -faux_inf for d : D];  // node potentials
-    parent = list(chain(repeat(-1, n), [None]));  // parent nodes
-    edge = list(range(e, e + n))                 // edges to parents
-    size = list(chain(repeat(1, n), [n + 1]))    // subtree sizes
-    next = list(chain(range(1, n), [-1, 0]))     // next nodes : depth-first thread
-    prev = list(range(-1, n))                    // previous nodes : depth-first thread
-    last = list(chain(range(n), [n - 1]))        // last descendants : depth-first thread
-
-    // -------------------------------------------------------------------------------------------##
-    // Pivot loop
-    // -------------------------------------------------------------------------------------------##
-
-    auto reduced_cost(i) {
-        /** Return the reduced cost of an edge i.
-         */
-        c = C[i] - pi[S[i]] + pi[T[i]];
-        return c if (x[i] == 0 else -c
-
-    auto find_entering_edges() {
-        /** Yield entering edges until none can be found.
-         */
-        if (e == 0) {
-            return;
-
-        // Entering edges are found by combining Dantzig"s rule && Bland"s
-        // rule. The edges are cyclically grouped into blocks of size B. Within
-        // each block, Dantzig"s rule is applied to find an entering edge. The
-        // blocks to search is determined following Bland"s rule.
-        B = int(ceil(sqrt(e)));  // pivot block size
-        M = (e + B - 1) // B    // number of blocks needed to cover all edges
-        m = 0                   // number of consecutive blocks without eligible
-        // entering edges
-        f = 0                   // first edge : block
-        while (m < M) {
-            // Determine the next block of edges.
-            l = f + B
-            if (l <= e) {
-                edges = range(f, l);
-            } else {
-                l -= e
-                edges = chain(range(f, e), range(l));
-            f = l
-            // Find the first edge with the lowest reduced cost.
-            i = min(edges, key=reduced_cost);
-            c = reduced_cost(i);
-            if (c >= 0) {
-                // No entering edge found : the current block.
-                m += 1;
-            } else {
-                // Entering edge found.
-                if (x[i] == 0) {
-                    p = S[i];
-                    q = T[i];
-                } else {
-                    p = T[i];
-                    q = S[i];
-                yield i, p, q
-                m = 0.;
-        // All edges have nonnegative reduced costs. The current flow is
-        // optimal.
-
-    auto find_apex(p, q) {
-        /** Find the lowest common ancestor of nodes p && q : the spanning
-        tree.
-         */
-        size_p = size[p];
-        size_q = size[q];
-        while (true) {
-            while (size_p < size_q) {
-                p = parent[p];
-                size_p = size[p];
-            while (size_p > size_q) {
-                q = parent[q];
-                size_q = size[q];
-            if (size_p == size_q) {
-                if (p != q) {
-                    p = parent[p];
-                    size_p = size[p];
-                    q = parent[q];
-                    size_q = size[q];
-                } else {
-                    return p
-
-    auto trace_path(p, w) {
-        /** Return the nodes && edges on the path from node p to its ancestor
-        w.
-         */
-        Wn = [p];
-        We = [];
-        while (p != w) {
-            We.append(edge[p]);
-            p = parent[p];
-            Wn.append(p);
-        return Wn, We
-
-    auto find_cycle(i, p, q) {
-        /** Return the nodes && edges on the cycle containing edge i == (p, q);
-        when the latter is added to the spanning tree.
-
-        The cycle is oriented : the direction from p to q.
-         */
-        w = find_apex(p, q);
-        Wn, We = trace_path(p, w);
-        Wn.reverse();
-        We.reverse();
-        We.append(i);
-        WnR, WeR = trace_path(q, w);
-        del WnR[-1];
-        Wn += WnR
-        We += WeR
-        return Wn, We
-
-    auto residual_capacity(i, p) {
-        /** Return the residual capacity of an edge i : the direction away
-        from its endpoint p.
-         */
-        return U[i] - x[i] if (S[i] == p else x[i];
-
-    auto find_leaving_edge(Wn, We) {
-        /** Return the leaving edge : a cycle represented by Wn && We.
-         */
-        j, s = min(zip(reversed(We), reversed(Wn)),
-                   key=lambda i_p: residual_capacity(*i_p));
-        t = T[j] if (S[j] == s else S[j];
-        return j, s, t
-
-    auto augment_flow(Wn, We, f) {
-        /** Augment f units of flow along a cycle represented by Wn && We.
-         */
-        for (auto i, p : zip(We, Wn) {
-            if (S[i] == p) {
-                x[i] += f
+           INFOR 17(1):16--34. 1979.
+*/
+template <typename Flow = double, typename Cost = Flow> class NetworkSimplex {
+  public:
+    using index_t = std::uint32_t;
+    using arc_t = std::size_t;
+    using flow_t = Flow;
+    using cost_t = Cost;
+
+    static constexpr auto no_arc = arc_t(-1);
+
+    explicit NetworkSimplex(std::size_t num_nodes)
+        : _n{num_nodes}, _demand(num_nodes, Flow(0)) {}
+
+    auto num_nodes() const { return this->_n; }
+
+    auto num_arcs() const { return this->_m; }
+
+    /** Add an arc `(u, v)` && return its index. */
+    auto add_arc(std::size_t u, std::size_t v, Flow capacity, Cost cost)
+        -> arc_t {
+        if (u >= this->_n || v >= this->_n)
+            throw XNetworkError("node not in graph");
+        this->_truncate();
+        this->_source.push_back(index_t(u));
+        this->_target.push_back(index_t(v));
+        this->_capacity.push_back(capacity);
+        this->_cost.push_back(cost);
+        return this->_m++;
+    }
+
+    /** Set the demand of u; a negative demand is a supply. */
+    void set_demand(std::size_t u, Flow d) { this->_demand[u] = d; }
+
+    auto demand(std::size_t u) const -> Flow { return this->_demand[u]; }
+
+    /** Flow on arc a after `run`. */
+    auto flow(arc_t a) const -> Flow { return this->_flow[a]; }
+
+    /** Potential of u after `run`; the reduced cost of an arc `(u, v)`
+        is `cost - potential(u) + potential(v)`.
+    */
+    auto potential(std::size_t u) const -> Cost { return this->_pi[u]; }
+
+    auto total_cost() const -> Cost { return this->_total_cost; }
+
+    /** Solve the problem && return the cost of a minimum cost flow.
+
+        The solver can be run again after demands have changed || arcs
+        have been added; it starts from scratch.
+
+        Raises
+        ------
+        XNetworkError
+            If a demand || a cost is infinite.
+
+        XNetworkUnfeasible
+            If the demands do not sum to zero, a capacity is negative ||
+            no flow satisfies all demands.
+
+        XNetworkUnbounded
+            If there is a cycle of negative cost && infinite capacity.
+    */
+    auto run() -> Cost {
+        this->_truncate();
+        this->_init();
+        for (auto i = this->_find_entering(); i != no_arc;
+             i = this->_find_entering())
+            this->_pivot(i);
+        this->_finish();
+        return this->_total_cost;
+    }
+
+  private:
+    enum : std::int8_t { _upper = -1, _tree = 0, _lower = 1 };
+    static constexpr auto _none = index_t(-1);
+
+    std::size_t _n;
+    std::size_t _m = 0;
+    std::vector<Flow> _demand;
+
+    // arcs; the artificial arc of node p is `_m + p` during `run`
+    std::vector<index_t> _source;
+    std::vector<index_t> _target;
+    std::vector<Cost> _cost;
+    std::vector<Flow> _capacity; // as given
+    std::vector<Flow> _cap;      // with infinities replaced
+    std::vector<Flow> _flow;
+    std::vector<std::int8_t> _state;
+
+    // spanning tree; the root is node `_n`
+    std::vector<index_t> _parent;
+    std::vector<arc_t> _pred;
+    std::vector<index_t> _thread;
+    std::vector<index_t> _rev_thread;
+    std::vector<index_t> _last;
+    std::vector<index_t> _depth;
+    std::vector<Cost> _pi;
+
+    // scratch space for the cycle of a pivot
+    std::vector<index_t> _cycle_nodes;
+    std::vector<arc_t> _cycle_arcs;
+    std::vector<index_t> _path;
+
+    arc_t _block_size = 1;
+    arc_t _next_arc = 0;
+    Flow _big_flow = Flow(1);
+    Cost _big_cost = Cost(1);
+    Cost _total_cost = Cost(0);
+    bool _unbounded = false;
+
+    template <typename T> static auto _abs(T x) -> T { return x < 0 ? -x : x; }
+
+    template <typename T> static auto _is_inf(T x) -> bool {
+        return std::numeric_limits<T>::has_infinity &&
+               _abs(x) == std::numeric_limits<T>::infinity();
+    }
+
+    /** Drop the artificial arcs of a previous run. */
+    void _truncate() {
+        this->_source.resize(this->_m);
+        this->_target.resize(this->_m);
+        this->_cost.resize(this->_m);
+    }
+
+    void _init() {
+        const auto n = this->_n, m = this->_m;
+        const auto root = index_t(n);
+
+        // sanity checks, in the order of `networksimplex.h`
+        auto total = Flow(0);
+        for (auto d : this->_demand) {
+            if (_is_inf(d))
+                throw XNetworkError("node has infinite demand");
+            total += d;
+        }
+        for (auto c : this->_cost)
+            if (_is_inf(c))
+                throw XNetworkError("edge has infinite weight");
+        if (total != 0)
+            throw XNetworkUnfeasible("total node demand is not zero");
+        for (auto u : this->_capacity)
+            if (u < 0)
+                throw XNetworkUnfeasible("edge has negative capacity");
+
+        // Self loops && empty arcs are fixed at their optimal bound by
+        // giving them the tree state, so they never enter.
+        auto costsum = Cost(0);
+        this->_cap.assign(m, Flow(0));
+        this->_flow.assign(m, Flow(0));
+        this->_state.assign(m, _lower);
+        this->_unbounded = false;
+        for (arc_t a = 0; a < m; ++a) {
+            const auto u = this->_capacity[a];
+            const auto c = this->_cost[a];
+            if (this->_source[a] == this->_target[a] || u == 0) {
+                this->_state[a] = _tree;
+                if (c < 0) {
+                    if (_is_inf(u))
+                        this->_unbounded = true;
+                    else
+                        this->_flow[a] = u;
+                }
+                continue;
+            }
+            costsum += _abs(c);
+        }
+        this->_big_flow =
+            _min_cost_big_flow(this->_source, this->_target, this->_capacity,
+                               this->_demand, _is_inf<Flow>);
+        // a unit through the root costs more than any path
+        this->_big_cost = costsum > 0 ? 3 * costsum : Cost(1);
+        for (arc_t a = 0; a < m; ++a)
+            this->_cap[a] = _is_inf(this->_capacity[a]) ? this->_big_flow
+                                                        : this->_capacity[a];
+
+        // Artificial arcs toward the root for nodes of demand <= 0,
+        // which keeps the initial tree strongly feasible.
+        this->_parent.assign(n + 1, root);
+        this->_pred.resize(n + 1);
+        this->_thread.resize(n + 1);
+        this->_rev_thread.resize(n + 1);
+        this->_last.resize(n + 1);
+        this->_depth.assign(n + 1, 1);
+        this->_pi.resize(n + 1);
+        for (std::size_t p = 0; p < n; ++p) {
+            const auto d = this->_demand[p];
+            this->_source.push_back(d > 0 ? root : index_t(p));
+            this->_target.push_back(d > 0 ? index_t(p) : root);
+            this->_cost.push_back(this->_big_cost);
+            this->_cap.push_back(this->_big_flow);
+            this->_flow.push_back(_abs(d));
+            this->_state.push_back(_tree);
+            this->_pi[p] = d > 0 ? -this->_big_cost : this->_big_cost;
+            this->_pred[p] = m + p;
+            this->_thread[p] = index_t(p + 1);
+            this->_rev_thread[p] = p == 0 ? root : index_t(p - 1);
+            this->_last[p] = index_t(p);
+        }
+        this->_parent[root] = _none;
+        this->_pred[root] = no_arc;
+        this->_thread[root] = n == 0 ? root : 0;
+        this->_rev_thread[root] = n == 0 ? root : index_t(n - 1);
+        this->_last[root] = n == 0 ? root : index_t(n - 1);
+        this->_depth[root] = 0;
+        this->_pi[root] = Cost(0);
+
+        this->_block_size =
+            std::max(arc_t(1), arc_t(std::ceil(std::sqrt(double(m)))));
+        this->_next_arc = 0;
+    }
+
+    /** Reduced cost of arc a in the direction it can move; negative iff
+        the arc is eligible to enter.
+    */
+    auto _reduced_cost(arc_t a) const -> Cost {
+        return Cost(this->_state[a]) *
+               (this->_cost[a] - this->_pi[this->_source[a]] +
+                this->_pi[this->_target[a]]);
+    }
+
+    /** Block search: return the best arc of the next block that has an
+        eligible arc, || `no_arc` if the flow is optimal.
+    */
+    auto _find_entering() -> arc_t {
+        const auto m = this->_m;
+        if (m == 0)
+            return no_arc;
+        const auto B = this->_block_size;
+        const auto num_blocks = (m + B - 1) / B;
+        auto a = this->_next_arc;
+        for (arc_t k = 0; k < num_blocks; ++k) {
+            auto best = Cost(0);
+            auto entering = no_arc;
+            for (arc_t b = 0; b < B; ++b) {
+                auto c = this->_reduced_cost(a);
+                if (c < best) {
+                    best = c;
+                    entering = a;
+                }
+                if (++a == m)
+                    a = 0;
+            }
+            if (entering != no_arc) {
+                this->_next_arc = a;
+                return entering;
+            }
+        }
+        this->_next_arc = a;
+        return no_arc;
+    }
+
+    /** Residual capacity of arc a leaving its endpoint p. */
+    auto _residual(arc_t a, index_t p) const -> Flow {
+        return this->_source[a] == p ? this->_cap[a] - this->_flow[a]
+                                     : this->_flow[a];
+    }
+
+    /** Store the cycle closed by arc i, oriented from p to q, in
+        `_cycle_nodes` && `_cycle_arcs`: arc k is traversed from node k,
+        starting at the apex.  Return the position of i.
+    */
+    auto _find_cycle(arc_t i, index_t p, index_t q) -> std::size_t {
+        auto &Wn = this->_cycle_nodes;
+        auto &We = this->_cycle_arcs;
+        Wn.clear();
+        We.clear();
+        auto u = p, v = q;
+        while (u != v) {
+            if (this->_depth[u] >= this->_depth[v]) {
+                Wn.push_back(u);
+                We.push_back(this->_pred[u]);
+                u = this->_parent[u];
             } else {
-                x[i] -= f
-
-    auto trace_subtree(p) {
-        /** Yield the nodes : the subtree rooted at a node p.
-         */
-        yield p
-        l = last[p];
-        while (p != l) {
-            p = next[p];
-            yield p
-
-    auto remove_edge(s, t) {
-        /** Remove an edge (s, t) where parent[t] == s from the spanning tree.
-         */
-        size_t = size[t];
-        prev_t = prev[t];
-        last_t = last[t];
-        next_last_t = next[last_t];
-        // Remove (s, t).
-        parent[t] = None;
-        edge[t] = None;
-        // Remove the subtree rooted at t from the depth-first thread.
-        next[prev_t] = next_last_t
-        prev[next_last_t] = prev_t
-        next[last_t] = t
-        prev[t] = last_t
-        // Update the subtree sizes && last descendants of the (old) acenstors
-        // of t.
-        while (s is not None) {
-            size[s] -= size_t
-            if (last[s] == last_t) {
-                last[s] = prev_t
-            s = parent[s];
-
-    auto make_root(q) {
-        /** Make a node q the root of its containing subtree.
-         */
-        ancestors = [];
-        while (q is not None) {
-            ancestors.append(q);
-            q = parent[q];
-        ancestors.reverse();
-        for (auto p, q : zip(ancestors, islice(ancestors, 1, None)) {
-            size_p = size[p];
-            last_p = last[p];
-            prev_q = prev[q];
-            last_q = last[q];
-            next_last_q = next[last_q];
-            // Make p a child of q.
-            parent[p] = q
-            parent[q] = None;
-            edge[p] = edge[q];
-            edge[q] = None;
-            size[p] = size_p - size[q];
-            size[q] = size_p
-            // Remove the subtree rooted at q from the depth-first thread.
-            next[prev_q] = next_last_q
-            prev[next_last_q] = prev_q
-            next[last_q] = q
-            prev[q] = last_q
+                v = this->_parent[v];
+            }
+        }
+        Wn.push_back(u); // the apex
+        std::reverse(Wn.begin(), Wn.end());
+        std::reverse(We.begin(), We.end());
+        const auto pos = We.size();
+        We.push_back(i);
+        for (v = q; v != u; v = this->_parent[v]) {
+            Wn.push_back(v);
+            We.push_back(this->_pred[v]);
+        }
+        return pos;
+    }
+
+    void _pivot(arc_t i) {
+        auto p = this->_source[i], q = this->_target[i];
+        if (this->_state[i] == _upper)
+            std::swap(p, q);
+        const auto ipos = this->_find_cycle(i, p, q);
+        const auto &Wn = this->_cycle_nodes;
+        const auto &We = this->_cycle_arcs;
+
+        // the last blocking arc of the cycle leaves
+        auto jpos = We.size() - 1;
+        auto f = this->_residual(We[jpos], Wn[jpos]);
+        for (auto k = jpos; k-- > 0;) {
+            auto r = this->_residual(We[k], Wn[k]);
+            if (r < f) {
+                f = r;
+                jpos = k;
+            }
+        }
+        const auto j = We[jpos];
+        auto s = Wn[jpos];
+        auto t = this->_source[j] == s ? this->_target[j] : this->_source[j];
+        const auto saturated = this->_source[j] == s;
+
+        if (f != 0) {
+            for (std::size_t k = 0; k < We.size(); ++k) {
+                if (this->_source[We[k]] == Wn[k])
+                    this->_flow[We[k]] += f;
+                else
+                    this->_flow[We[k]] -= f;
+            }
+        }
+        if (i == j) {
+            this->_state[i] = -this->_state[i];
+            return;
+        }
+        this->_state[i] = _tree;
+        this->_state[j] = saturated ? _upper : _lower;
+        if (this->_parent[t] != s)
+            std::swap(s, t);
+        if (ipos > jpos)
+            std::swap(p, q);
+        this->_remove_edge(s, t);
+        this->_make_root(q);
+        this->_add_edge(i, p, q);
+        this->_update_potentials(i, p, q);
+    }
+
+    /** Detach the subtree of t, where `parent[t] == s`, making its
+        thread a cycle of its own.
+    */
+    void _remove_edge(index_t s, index_t t) {
+        const auto prev_t = this->_rev_thread[t];
+        const auto last_t = this->_last[t];
+        const auto next_last_t = this->_thread[last_t];
+        this->_parent[t] = _none;
+        this->_pred[t] = no_arc;
+        this->_thread[prev_t] = next_last_t;
+        this->_rev_thread[next_last_t] = prev_t;
+        this->_thread[last_t] = t;
+        this->_rev_thread[t] = last_t;
+        // only a chain of ancestors can end their subtree at last_t
+        for (; s != _none && this->_last[s] == last_t; s = this->_parent[s])
+            this->_last[s] = prev_t;
+    }
+
+    /** Reroot a detached subtree at q. */
+    void _make_root(index_t q) {
+        auto &ancestors = this->_path;
+        ancestors.clear();
+        for (; q != _none; q = this->_parent[q])
+            ancestors.push_back(q);
+        for (auto k = ancestors.size() - 1; k > 0; --k) {
+            const auto p = ancestors[k];
+            q = ancestors[k - 1];
+            auto last_p = this->_last[p];
+            const auto prev_q = this->_rev_thread[q];
+            const auto last_q = this->_last[q];
+            const auto next_last_q = this->_thread[last_q];
+            // make p a child of q
+            this->_parent[p] = q;
+            this->_parent[q] = _none;
+            this->_pred[p] = this->_pred[q];
+            this->_pred[q] = no_arc;
+            // remove the subtree of q from the thread
+            this->_thread[prev_q] = next_last_q;
+            this->_rev_thread[next_last_q] = prev_q;
+            this->_thread[last_q] = q;
+            this->_rev_thread[q] = last_q;
             if (last_p == last_q) {
-                last[p] = prev_q
-                last_p = prev_q
-            // Add the remaining parts of the subtree rooted at p as a subtree
-            // of q : the depth-first thread.
-            prev[p] = last_q
-            next[last_q] = p
-            next[last_p] = q
-            prev[q] = last_p
-            last[q] = last_p
-
-    auto add_edge(i, p, q) {
-        /** Add an edge (p, q) to the spanning tree where q is the root of a
-        subtree.
-         */
-        last_p = last[p];
-        next_last_p = next[last_p];
-        size_q = size[q];
-        last_q = last[q];
-        // Make q a child of p.
-        parent[q] = p
-        edge[q] = i
-        // Insert the subtree rooted at q into the depth-first thread.
-        next[last_p] = q
-        prev[q] = last_p
-        prev[next_last_p] = last_q
-        next[last_q] = next_last_p
-        // Update the subtree sizes && last descendants of the (new) ancestors
-        // of q.
-        while (p is not None) {
-            size[p] += size_q
-            if (last[p] == last_p) {
-                last[p] = last_q
-            p = parent[p];
-
-    auto update_potentials(i, p, q) {
-        /** Update the potentials of the nodes : the subtree rooted at a node
-        q connected to its parent p by an edge i.
-         */
-        if (q == T[i]) {
-            d = pi[p] - C[i] - pi[q];
-        } else {
-            d = pi[p] + C[i] - pi[q];
-        for (auto q : trace_subtree(q) {
-            pi[q] += d;
-
-    // Pivot loop
-    for (auto i, p, q : find_entering_edges() {
-        Wn, We = find_cycle(i, p, q);
-        j, s, t = find_leaving_edge(Wn, We);
-        augment_flow(Wn, We, residual_capacity(j, s));
-        if (i != j) { //Do nothing more if (the entering edge is the same as the
-                    // the leaving edge.
-            if (parent[t] != s) {
-                // Ensure that s is the parent of t.
-                s, t = t, s
-            if (We.index(i) > We.index(j) {
-                // Ensure that q is : the subtree rooted at t.
-                p, q = q, p
-            remove_edge(s, t);
-            make_root(q);
-            add_edge(i, p, q);
-            update_potentials(i, p, q);
-
-    // -------------------------------------------------------------------------------------------##
-    // Infeasibility && unboundedness detection
-    // -------------------------------------------------------------------------------------------##
-
-    if (any(x[i] != 0 for i : range(-n, 0)) {
-        throw xn::XNetworkUnfeasible("no flow satisfies all node demands");
-
-    if ((any(x[i] * 2 >= faux_inf for i : range(e)) or
-        any(e[-1].get(capacity, inf) == inf && e[-1].get(weight, 0) < 0
-            for (auto e : xn::selfloop_edges(G, data=true))) {
-        throw xn::XNetworkUnbounded(
-            "negative cycle with infinite capacity found");
-
-    // -------------------------------------------------------------------------------------------##
-    // Flow cost calculation && flow dict construction
-    // -------------------------------------------------------------------------------------------##
-
-    del x[e:];
-    flow_cost = sum(c * x for c, x : zip(C, x));
-    flow_dict = {n: {} for n : N}
-
-    auto add_entry(e) {
-        /** Add a flow dict entry.
-         */
-        d = flow_dict[e[0]];
-        for (auto k : e[1:-2]) {
-            try {
-                d = d[k];
-            } catch (KeyError) {
-                t = {};
-                d[k] = t
-                d = t
-        d[e[-2]] = e[-1];
-
-    S = (N[s] for s : S);  // Use original nodes.
-    T = (N[t] for t : T);  // Use original nodes.
-    if (!multigraph) {
-        for (auto e : zip(S, T, x) {
-            add_entry(e);
-        edges = G.edges(data=true);
-    } else {
-        for (auto e : zip(S, T, K, x) {
-            add_entry(e);
-        edges = G.edges(data=true, keys=true);
-    for (auto e : edges) {
-        if (e[0] != e[1]) {
-            if (e[-1].get(capacity, inf) == 0) {
-                add_entry(e[:-1] + (0,));
-        } else {
-            c = e[-1].get(weight, 0);
-            if (c >= 0) {
-                add_entry(e[:-1] + (0,));
-            } else {
-                u = e[-1][capacity];
-                flow_cost += c * u
-                add_entry(e[:-1] + (u,));
-
-    return flow_cost, flow_dict
+                this->_last[p] = prev_q;
+                last_p = prev_q;
+            }
+            // the rest of the subtree of p follows q in the thread
+            this->_rev_thread[p] = last_q;
+            this->_thread[last_q] = p;
+            this->_thread[last_p] = q;
+            this->_rev_thread[q] = last_p;
+            this->_last[q] = last_p;
+        }
+    }
+
+    /** Hang the subtree rooted at q below p through arc i. */
+    void _add_edge(arc_t i, index_t p, index_t q) {
+        const auto last_p = this->_last[p];
+        const auto next_last_p = this->_thread[last_p];
+        const auto last_q = this->_last[q];
+        this->_parent[q] = p;
+        this->_pred[q] = i;
+        this->_thread[last_p] = q;
+        this->_rev_thread[q] = last_p;
+        this->_rev_thread[next_last_p] = last_q;
+        this->_thread[last_q] = next_last_p;
+        for (; p != _none && this->_last[p] == last_p; p = this->_parent[p])
+            this->_last[p] = last_q;
+    }
+
+    /** Shift the potentials && depths of the subtree rooted at q, now
+        joined to p by arc i.
+    */
+    void _update_potentials(arc_t i, index_t p, index_t q) {
+        const auto d = q == this->_target[i]
+                           ? this->_pi[p] - this->_cost[i] - this->_pi[q]
+                           : this->_pi[p] + this->_cost[i] - this->_pi[q];
+        const auto last_q = this->_last[q];
+        this->_pi[q] += d;
+        this->_depth[q] = this->_depth[p] + 1;
+        for (auto u = q; u != last_q;) {
+            u = this->_thread[u];
+            this->_pi[u] += d;
+            this->_depth[u] = this->_depth[this->_parent[u]] + 1;
+        }
+    }
+
+    void _finish() {
+        const auto n = this->_n, m = this->_m;
+        for (std::size_t p = 0; p < n; ++p)
+            if (this->_flow[m + p] != 0)
+                throw XNetworkUnfeasible("no flow satisfies all node demands");
+        if (!this->_unbounded)
+            this->_unbounded = _min_cost_unbounded(
+                n, this->_source, this->_target, this->_capacity,
+                this->_cost, this->_flow, this->_big_flow, _is_inf<Flow>);
+        if (this->_unbounded)
+            throw XNetworkUnbounded(
+                "negative cycle with infinite capacity found");
+        this->_total_cost = Cost(0);
+        for (arc_t a = 0; a < m; ++a)
+            this->_total_cost += this->_cost[a] * this->_flow[a];
+        this->_flow.resize(m);
+        this->_truncate();
+    }
+};
+
+} // namespace xn
+
+#endif
@@ -0,0 +1,607 @@
+#ifndef _HOME_UBUNTU_GITHUB_XNETWORK_ALGORITHMS_FLOW_PREFLOWPUSH_HPP
+#define _HOME_UBUNTU_GITHUB_XNETWORK_ALGORITHMS_FLOW_PREFLOWPUSH_HPP 1
+
+//    Copyright (C) 2004-2018 by
+//    Wai-Shing Luk <luk036@gmail.com>
+//
+//
+//    All rights reserved.
+//    BSD license.
+/**
+Native highest-label && parallel preflow-push on an array residual
+network.
+*/
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <vector>
+#include <xnetwork/algorithms/flow/utils.hpp> // import ResidualNetwork
+#include <xnetwork/exception.hpp> // import XNetworkError
+#include <xnetwork/utils/parallel.hpp> // import parallel_for, atomic_add
+
+namespace xn {
+
+/** Highest-label push-relabel state over a `ResidualNetwork`.
+
+    Levels are kept in flat arrays: every level has a doubly linked list
+    of all its nodes (for the gap heuristic) && a singly linked stack of
+    its active nodes, as the `Level` objects of `utils.h` do with two
+    sets.  Phase 1 computes a maximum preflow with heights below n;
+    phase 2 returns the remaining excess to the source.
+*/
+template <typename Cap> class _PushRelabel {
+  public:
+    using index_t = typename ResidualNetwork<Cap>::index_t;
+    using arc_t = typename ResidualNetwork<Cap>::arc_t;
+    static constexpr auto none = std::numeric_limits<index_t>::max();
+
+    _PushRelabel(ResidualNetwork<Cap> &R, std::size_t s, std::size_t t,
+                 double global_relabel_freq)
+        : _R{R}, _n{R.num_nodes()}, _s{index_t(s)}, _t{index_t(t)},
+          _levels{2 * R.num_nodes() + 2}, _height(_n, 0), _excess(_n, Cap(0)),
+          _current(_n), _next(_n, none), _prev(_n, none),
+          _anext(_n, none), _first(_levels, none), _active(_levels, none) {
+        this->_threshold =
+            global_relabel_freq > 0
+                ? double(this->_n + R.num_arcs()) / global_relabel_freq
+                : std::numeric_limits<double>::infinity();
+    }
+
+    /** Run phase 1 (&& phase 2 unless value_only); return the flow value. */
+    auto run(bool value_only) -> Cap {
+        auto &R = this->_R;
+        // phase 1: heights are distances to t, s sits at n
+        this->_phase1 = true;
+        this->_dead = index_t(this->_n);
+        this->_height[this->_s] = index_t(this->_n);
+        if (!this->_global_relabel(this->_t)) {
+            R.flow_value = Cap(0);
+            return R.flow_value; // t is unreachable from s
+        }
+        // saturate the arcs out of s; the heights stay valid
+        for (auto a = R.indptr[this->_s]; a < R.indptr[this->_s + 1]; ++a) {
+            auto r = R.residual(a);
+            if (r > 0)
+                this->_push(this->_s, a, r);
+        }
+        this->_run_phase();
+        R.flow_value = this->_excess[this->_t];
+        if (!value_only)
+            this->_phase2();
+        return R.flow_value;
+    }
+
+    /** Run phase 2 alone on a maximum preflow already in R, whose node
+        excesses are given (recomputing them from the flows could round
+        a zero excess below zero).
+    */
+    void return_excess(const std::vector<Cap> &excess) {
+        this->_excess = excess;
+        this->_phase2();
+    }
+
+  private:
+    ResidualNetwork<Cap> &_R;
+    std::size_t _n;
+    index_t _s, _t;
+    std::size_t _levels;
+    std::vector<index_t> _height;
+    std::vector<Cap> _excess;
+    std::vector<arc_t> _current;
+    std::vector<index_t> _next, _prev; // all nodes of a level
+    std::vector<index_t> _anext;       // active nodes of a level
+    std::vector<index_t> _first, _active;
+    std::size_t _max_level = 0, _max_active = 0;
+    index_t _dead = 0;
+    bool _phase1 = true;
+    double _threshold, _work = 0.0;
+
+    auto _is_terminal(index_t u) const {
+        return u == this->_s || u == this->_t;
+    }
+
+    void _insert(index_t u) {
+        auto h = this->_height[u];
+        this->_prev[u] = none;
+        this->_next[u] = this->_first[h];
+        if (this->_first[h] != none)
+            this->_prev[this->_first[h]] = u;
+        this->_first[h] = u;
+        if (h > this->_max_level)
+            this->_max_level = h;
+    }
+
+    void _remove(index_t u) {
+        auto h = this->_height[u];
+        if (this->_prev[u] != none)
+            this->_next[this->_prev[u]] = this->_next[u];
+        else
+            this->_first[h] = this->_next[u];
+        if (this->_next[u] != none)
+            this->_prev[this->_next[u]] = this->_prev[u];
+    }
+
+    void _activate(index_t u) {
+        auto h = this->_height[u];
+        this->_anext[u] = this->_active[h];
+        this->_active[h] = u;
+        if (h > this->_max_active)
+            this->_max_active = h;
+    }
+
+    void _push(index_t u, arc_t a, Cap d) {
+        auto v = this->_R.head[a];
+        this->_R.push(a, d);
+        this->_excess[u] -= d;
+        if (this->_excess[v] == 0 && !this->_is_terminal(v) &&
+            this->_height[v] < this->_dead)
+            this->_activate(v);
+        this->_excess[v] += d;
+    }
+
+    /** Exact heights by reverse BFS from `target` in the residual
+        network; nodes that cannot reach it are set dead.  Rebuilds all
+        levels && returns whether the source of phase 1 was reached.
+    */
+    auto _global_relabel(index_t target) -> bool {
+        auto &R = this->_R;
+        const auto other = target == this->_t ? this->_s : this->_t;
+        auto reached_other = false;
+        // in phase 1 the dead height n is also the height of s
+        std::fill(this->_height.begin(), this->_height.end(), this->_dead);
+        this->_height[target] = 0;
+        auto queue = std::vector<index_t>{target};
+        for (std::size_t i = 0; i < queue.size(); ++i) {
+            auto u = queue[i];
+            for (auto a = R.indptr[u]; a < R.indptr[u + 1]; ++a) {
+                auto w = R.head[a];
+                if (R.residual(R.rev[a]) <= 0)
+                    continue;
+                if (w == other) {
+                    reached_other = true;
+                    continue;
+                }
+                if (this->_height[w] != this->_dead)
+                    continue;
+                this->_height[w] = this->_height[u] + 1;
+                queue.push_back(w);
+            }
+        }
+        std::fill(this->_first.begin(), this->_first.end(), none);
+        std::fill(this->_active.begin(), this->_active.end(), none);
+        this->_max_level = this->_max_active = 0;
+        for (std::size_t u = 0; u < this->_n; ++u) {
+            auto v = index_t(u);
+            this->_current[u] = R.indptr[u];
+            if (this->_is_terminal(v) || this->_height[v] >= this->_dead)
+                continue;
+            this->_insert(v);
+            if (this->_excess[v] > 0)
+                this->_activate(v);
+        }
+        this->_work = 0.0;
+        return reached_other;
+    }
+
+    /** All nodes above level h can no longer reach the target. */
+    void _gap(std::size_t h) {
+        for (auto k = h + 1; k <= this->_max_level; ++k) {
+            for (auto u = this->_first[k]; u != none; u = this->_next[u])
+                this->_height[u] = this->_dead;
+            this->_first[k] = this->_active[k] = none;
+        }
+        this->_max_level = h;
+    }
+
+    void _discharge(index_t u) {
+        auto &R = this->_R;
+        const auto end = R.indptr[u + 1];
+        while (this->_excess[u] > 0) {
+            auto h = this->_height[u];
+            auto a = this->_current[u];
+            for (; a < end; ++a) {
+                auto r = R.residual(a);
+                if (r > 0 && h == this->_height[R.head[a]] + 1) {
+                    this->_push(u, a, this->_excess[u] < r ? this->_excess[u]
+                                                           : r);
+                    if (this->_excess[u] == 0)
+                        break;
+                }
+            }
+            this->_current[u] = a;
+            if (this->_excess[u] == 0)
+                return;
+
+            // relabel to the lowest admissible height
+            this->_remove(u);
+            if (this->_phase1 && this->_first[h] == none) {
+                this->_gap(h);
+                this->_height[u] = this->_dead;
+                return;
+            }
+            auto best = std::size_t(this->_dead);
+            for (auto b = R.indptr[u]; b < end; ++b) {
+                if (R.residual(b) > 0 &&
+                    std::size_t(this->_height[R.head[b]]) + 1 < best) {
+                    best = std::size_t(this->_height[R.head[b]]) + 1;
+                    this->_current[u] = b;
+                }
+            }
+            this->_work += double(end - R.indptr[u]) + 12;
+            this->_height[u] = index_t(best);
+            if (best >= this->_dead) {
+                if (!this->_phase1)
+                    throw XNetworkError("excess cannot return to the source");
+                return;
+            }
+            this->_insert(u);
+        }
+    }
+
+    /** Phase 2: heights are distances to s; t no longer takes part. */
+    void _phase2() {
+        this->_phase1 = false;
+        this->_dead = index_t(this->_levels - 1);
+        this->_global_relabel(this->_s);
+        this->_run_phase();
+    }
+
+    void _run_phase() {
+        for (;;) {
+            while (this->_max_active > 0 &&
+                   this->_active[this->_max_active] == none)
+                --this->_max_active;
+            auto h = this->_max_active;
+            auto u = this->_active[h];
+            if (u == none)
+                return;
+            this->_active[h] = this->_anext[u];
+            this->_discharge(u);
+            if (this->_work > this->_threshold)
+                this->_global_relabel(this->_phase1 ? this->_t : this->_s);
+        }
+    }
+};
+
+/** Compute a maximum s-t flow on R with highest-label preflow-push.
+
+    The algorithm of `preflow_push` in `preflowpush.h` on dense arrays:
+    highest-label selection, the gap heuristic && global relabeling
+    after `(n + m) / global_relabel_freq` units of relabel work (never
+    if the frequency is 0).  The flow of R is reset first; on return
+    `R.flow` is a maximum flow (a maximum preflow if `value_only`) &&
+    `R.flow_value` its value, which is also returned.
+
+    Parameters
+    ----------
+    R : ResidualNetwork
+
+    s, t : node indices
+        Source && sink.
+
+    global_relabel_freq : double, optional (default=1)
+
+    value_only : bool, optional (default=false)
+
+    Raises
+    ------
+    XNetworkError
+        If s or t is not a node, or s == t.
+
+    XNetworkUnbounded
+        If an infinite-capacity path joins s to t.
+*/
+template <typename Cap>
+auto preflow_push_flow(ResidualNetwork<Cap> &R, std::size_t s, std::size_t t,
+                       double global_relabel_freq = 1.0,
+                       bool value_only = false) -> Cap {
+    R.check_terminals(s, t);
+    if (global_relabel_freq < 0)
+        throw XNetworkError("global_relabel_freq must be nonnegative.");
+    R.detect_unboundedness(s, t);
+    R.reset();
+    auto engine = _PushRelabel<Cap>(R, s, t, global_relabel_freq);
+    return engine.run(value_only);
+}
+
+/** Synchronous parallel push-relabel state over a `ResidualNetwork`.
+
+    Phase 1 runs in rounds over the set of active nodes.  A round first
+    lets every active node push along its admissible arcs at the heights
+    of the previous round; since an arc && its twin cannot both be
+    admissible, every arc pair is written by one thread at most && no
+    locks are needed.  Pushed excess is gathered in atomic counters.
+    The nodes that keep some excess are then relabeled, again from the
+    heights of the previous round, which keeps the heights valid.  The
+    global relabeling is a level-synchronous parallel BFS.  Phase 2
+    reuses the sequential `_PushRelabel`.
+*/
+template <typename Cap> class _ParallelPushRelabel {
+  public:
+    using index_t = typename ResidualNetwork<Cap>::index_t;
+    using arc_t = typename ResidualNetwork<Cap>::arc_t;
+
+    _ParallelPushRelabel(ResidualNetwork<Cap> &R, std::size_t s,
+                         std::size_t t, unsigned num_threads,
+                         double global_relabel_freq)
+        : _R{R}, _n{R.num_nodes()}, _s{index_t(s)}, _t{index_t(t)},
+          _nt{num_threads}, _dead{index_t(R.num_nodes())}, _height(_n, 0),
+          _new_height(_n, 0), _excess(_n, Cap(0)), _added(_n), _queued(_n),
+          _seen(_n), _found(num_threads), _work(num_threads, 0.0) {
+        for (std::size_t u = 0; u < this->_n; ++u) {
+            this->_added[u].store(Cap(0), std::memory_order_relaxed);
+            this->_queued[u].store(0, std::memory_order_relaxed);
+        }
+        this->_threshold =
+            global_relabel_freq > 0
+                ? double(this->_n + R.num_arcs()) / global_relabel_freq
+                : std::numeric_limits<double>::infinity();
+    }
+
+    /** Run phase 1; return the flow value. */
+    auto run() -> Cap {
+        auto &R = this->_R;
+        const auto s = this->_s;
+        if (!this->_global_relabel())
+            return Cap(0); // t is unreachable from s
+        for (auto a = R.indptr[s]; a < R.indptr[s + 1]; ++a) {
+            auto r = R.residual(a);
+            if (r > 0) {
+                R.push(a, r);
+                this->_excess[s] -= r;
+                this->_excess[R.head[a]] += r;
+            }
+        }
+        this->_collect_active();
+        while (!this->_active.empty()) {
+            this->_push_round();
+            this->_relabel_round();
+            this->_apply_round();
+            if (this->_total_work > this->_threshold) {
+                this->_global_relabel();
+                this->_collect_active();
+            }
+        }
+        return this->_excess[this->_t];
+    }
+
+    auto excess() const -> const std::vector<Cap> & { return this->_excess; }
+
+  private:
+    static constexpr std::size_t _grain = 64;
+
+    ResidualNetwork<Cap> &_R;
+    std::size_t _n;
+    index_t _s, _t;
+    unsigned _nt;
+    index_t _dead;
+    std::vector<index_t> _height, _new_height;
+    std::vector<Cap> _excess;
+    std::vector<std::atomic<Cap>> _added;         // excess pushed this round
+    std::vector<std::atomic<std::uint8_t>> _queued; // in the active set
+    std::vector<std::atomic<std::uint8_t>> _seen;   // reached by the BFS
+    std::vector<index_t> _active, _pending;
+    std::vector<std::vector<index_t>> _found; // per thread
+    std::vector<double> _work;                // per thread
+    double _threshold, _total_work = 0.0;
+
+    /** Move the per-thread lists into `out`. */
+    void _gather(std::vector<index_t> &out) {
+        out.clear();
+        for (auto &f : this->_found) {
+            out.insert(out.end(), f.begin(), f.end());
+            f.clear();
+        }
+    }
+
+    auto _is_active(index_t u) const {
+        return u != this->_s && u != this->_t && this->_excess[u] > 0 &&
+               this->_height[u] < this->_dead;
+    }
+
+    void _collect_active() {
+        parallel_for(
+            this->_n,
+            [&](std::size_t ui, unsigned tid) {
+                auto u = index_t(ui);
+                auto active = this->_is_active(u);
+                this->_queued[u].store(active, std::memory_order_relaxed);
+                if (active)
+                    this->_found[tid].push_back(u);
+            },
+            this->_nt, 4096);
+        this->_gather(this->_active);
+    }
+
+    /** Exact heights by a parallel reverse BFS from t; nodes that cannot
+        reach it are set dead.  Returns whether s was reached.
+    */
+    auto _global_relabel() -> bool {
+        auto &R = this->_R;
+        auto reached = std::atomic<bool>{false};
+        parallel_for(
+            this->_n,
+            [&](std::size_t u, unsigned) {
+                this->_height[u] = this->_dead;
+                this->_seen[u].store(0, std::memory_order_relaxed);
+            },
+            this->_nt, 4096);
+        this->_height[this->_t] = 0;
+        this->_seen[this->_t].store(1, std::memory_order_relaxed);
+        this->_seen[this->_s].store(1, std::memory_order_relaxed);
+        auto frontier = std::vector<index_t>{this->_t};
+        while (!frontier.empty()) {
+            parallel_for(
+                frontier.size(),
+                [&](std::size_t i, unsigned tid) {
+                    auto u = frontier[i];
+                    for (auto a = R.indptr[u]; a < R.indptr[u + 1]; ++a) {
+                        auto w = R.head[a];
+                        if (R.residual(R.rev[a]) <= 0)
+                            continue;
+                        if (w == this->_s) {
+                            reached.store(true, std::memory_order_relaxed);
+                            continue;
+                        }
+                        if (this->_seen[w].load(std::memory_order_relaxed) ||
+                            this->_seen[w].exchange(
+                                1, std::memory_order_relaxed))
+                            continue;
+                        this->_height[w] = this->_height[u] + 1;
+                        this->_found[tid].push_back(w);
+                    }
+                },
+                this->_nt, _grain);
+            this->_gather(frontier);
+        }
+        this->_total_work = 0.0;
+        return reached.load();
+    }
+
+    /** Every active node pushes along its admissible arcs. */
+    void _push_round() {
+        auto &R = this->_R;
+        parallel_for(
+            this->_active.size(),
+            [&](std::size_t i, unsigned tid) {
+                auto v = this->_active[i];
+                auto e = this->_excess[v];
+                const auto h = this->_height[v];
+                for (auto a = R.indptr[v]; a < R.indptr[v + 1] && e > 0; ++a) {
+                    auto w = R.head[a];
+                    if (this->_height[w] + 1 != h)
+                        continue;
+                    // (w, v) is not admissible, so w leaves this pair alone
+                    auto r = R.residual(a);
+                    if (r <= 0)
+                        continue;
+                    auto d = e < r ? e : r;
+                    R.push(a, d);
+                    e -= d;
+                    atomic_add(this->_added[w], d);
+                    if (w != this->_t &&
+                        !this->_queued[w].exchange(1,
+                                                   std::memory_order_relaxed))
+                        this->_found[tid].push_back(w);
+                }
+                this->_excess[v] = e;
+            },
+            this->_nt, _grain);
+        this->_gather(this->_pending);
+    }
+
+    /** Nodes left with excess have no admissible arc; compute their new
+        heights from the heights of the previous round.
+    */
+    void _relabel_round() {
+        auto &R = this->_R;
+        parallel_for(
+            this->_active.size(),
+            [&](std::size_t i, unsigned tid) {
+                auto v = this->_active[i];
+                if (!(this->_excess[v] > 0)) {
+                    this->_new_height[v] = this->_height[v];
+                    return;
+                }
+                auto best = std::size_t(this->_dead);
+                for (auto a = R.indptr[v]; a < R.indptr[v + 1]; ++a) {
+                    auto h = std::size_t(this->_height[R.head[a]]) + 1;
+                    if (h < best && R.residual(a) > 0)
+                        best = h;
+                }
+                this->_new_height[v] = index_t(best);
+                this->_work[tid] += double(R.indptr[v + 1] - R.indptr[v]) + 12;
+            },
+            this->_nt, _grain);
+    }
+
+    /** Apply the new heights && the pushed excess; form the next active
+        set from the old one && the nodes that received excess.
+    */
+    void _apply_round() {
+        const auto na = this->_active.size();
+        parallel_for(
+            na + this->_pending.size(),
+            [&](std::size_t i, unsigned tid) {
+                auto v = i < na ? this->_active[i] : this->_pending[i - na];
+                if (i < na)
+                    this->_height[v] = this->_new_height[v];
+                this->_excess[v] +=
+                    this->_added[v].exchange(Cap(0), std::memory_order_relaxed);
+                auto active = this->_is_active(v);
+                this->_queued[v].store(active, std::memory_order_relaxed);
+                if (active)
+                    this->_found[tid].push_back(v);
+            },
+            this->_nt, _grain);
+        this->_excess[this->_t] += this->_added[this->_t].exchange(Cap(0));
+        this->_gather(this->_active);
+        for (auto &w : this->_work) {
+            this->_total_work += w;
+            w = 0.0;
+        }
+    }
+};
+
+/** Compute a maximum s-t flow on R with synchronous parallel
+    push-relabel.
+
+    Phase 1 is the lock-free round-based algorithm of `_ParallelPushRelabel`
+    (see Baumstark, Blelloch && Shun [1]_), with atomic excess counters
+    && a parallel global relabeling after `(n + m) / global_relabel_freq`
+    units of relabel work; phase 2, which returns the excess of the
+    maximum preflow to the source, is sequential.  The result is that of
+    `preflow_push_flow`; the flow itself may differ.
+
+    Parameters
+    ----------
+    R : ResidualNetwork
+
+    s, t : node indices
+        Source && sink.
+
+    num_threads : unsigned, optional (default=0)
+
+    global_relabel_freq : double, optional (default=1)
+
+    value_only : bool, optional (default=false)
+
+    Raises
+    ------
+    XNetworkError
+        If s or t is not a node, or s == t.
+
+    XNetworkUnbounded
+        If an infinite-capacity path joins s to t.
+
+    References
+    ----------
+    .. [1] Niklas Baumstark, Guy Blelloch && Julian Shun, Efficient
+        implementation of a synchronous parallel push-relabel algorithm,
+        ESA 2015, LNCS 9294, pp. 106-117.
+*/
+template <typename Cap>
+auto parallel_preflow_push_flow(ResidualNetwork<Cap> &R, std::size_t s,
+                                std::size_t t, unsigned num_threads = 0,
+                                double global_relabel_freq = 1.0,
+                                bool value_only = false) -> Cap {
+    R.check_terminals(s, t);
+    if (global_relabel_freq < 0)
+        throw XNetworkError("global_relabel_freq must be nonnegative.");
+    R.detect_unboundedness(s, t);
+    R.reset();
+    auto nt = resolve_num_threads(num_threads);
+    auto engine = _ParallelPushRelabel<Cap>(R, s, t, nt, global_relabel_freq);
+    R.flow_value = engine.run();
+    if (!value_only)
+        _PushRelabel<Cap>(R, s, t, global_relabel_freq)
+            .return_excess(engine.excess());
+    return R.flow_value;
+}
+
+} // namespace xn
+
+#endif
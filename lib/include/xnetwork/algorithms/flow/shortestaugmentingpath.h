@@ -8,10 +8,9 @@ __author__ = R"(ysitu <ysitu@users.noreply.github.com>)"
 // All rights reserved.
 // BSD license.
 
-from collections import deque
 #include <xnetwork.hpp> // as xn
 from .utils import *
-from .edmondskarp import edmonds_karp_core
+#include <xnetwork/algorithms/flow/shortestaugmentingpath.hpp> // import shortest_augmenting_path_flow
 
 static const auto __all__ = ["shortest_augmenting_path"];
 
@@ -32,142 +31,21 @@ auto shortest_augmenting_path_impl(G, s, t, capacity, residual, two_phase,
     } else {
         R = residual
 
-    R_nodes = R.nodes
-    R_pred = R.pred;
-    R_succ = R.succ;
-
-    // Initialize/reset the residual network.
-    for (auto u : R) {
-        for (auto e : R_succ[u].values() {
-            e["flow"] = 0.;
-
-    // Initialize heights of the nodes.
-    heights = {t: 0}
-    q = deque([(t, 0)]);
-    while (q) {
-        u, height = q.popleft();
-        height += 1;
-        for (auto v, attr : R_pred[u].items() {
-            if (v not : heights && attr["flow"] < attr["capacity"]) {
-                heights[v] = height
-                q.append((v, height));
-
-    if (s not : heights) {
-        // t is not reachable from s : the residual network. The maximum flow
-        // must be zero.
-        R.graph["flow_value"] = 0.;
-        return R
-
-    n = len(G);
-    m = R.size() / 2
-
-    // Initialize heights && "current edge" data structures of the nodes.
-    for (auto u : R) {
-        R_nodes[u]["height"] = heights[u] if (u : heights else n
-        R_nodes[u]["curr_edge"] = CurrentEdge(R_succ[u]);
-
-    // Initialize counts of nodes : each level.
-    counts = [0] * (2 * n - 1);
-    for (auto u : R) {
-        counts[R_nodes[u]["height"]] += 1;
-
-    inf = R.graph["inf"];
-
-    auto augment(path) {
-        /** Augment flow along a path from s to t.
-         */
-        // Determine the path residual capacity.
-        flow = inf
-        it = iter(path);
-        u = next(it);
-        for (auto v : it) {
-            attr = R_succ[u][v];
-            flow = min(flow, attr["capacity"] - attr["flow"]);
-            u = v
-        if (flow * 2 > inf) {
-            throw xn::XNetworkUnbounded(
-                "Infinite capacity path, flow unbounded above.");
-        // Augment flow along the path.
-        it = iter(path);
-        u = next(it);
-        for (auto v : it) {
-            R_succ[u][v]["flow"] += flow
-            R_succ[v][u]["flow"] -= flow
-            u = v
-        return flow
-
-    auto relabel(u) {
-        /** Relabel a node to create an admissible edge.
-         */
-        height = n - 1
-        for (auto v, attr : R_succ[u].items() {
-            if (attr["flow"] < attr["capacity"]) {
-                height = min(height, R_nodes[v]["height"]);
-        return height + 1
+    detect_unboundedness(R, s, t);
 
     if (cutoff.empty()) {
         cutoff = double("inf");
 
-    // Phase 1: Look for shortest augmenting paths using depth-first search.
-
-    flow_value = 0.;
-    path = [s];
-    u = s;
-    d = n if (!two_phase else int(min(m ** 0.5, 2 * n ** (2. / 3)));
-    done = R_nodes[s]["height"] >= d;
-    while (!done) {
-        height = R_nodes[u]["height"];
-        curr_edge = R_nodes[u]["curr_edge"];
-        // Depth-first search for the next node on the path to t.
-        while (true) {
-            v, attr = curr_edge.get();
-            if ((height == R_nodes[v]["height"] + 1 &&
-                    attr["flow"] < attr["capacity"]) {
-                // Advance to the next node following an admissible edge.
-                path.append(v);
-                u = v
-                break;
-            try {
-                curr_edge.move_to_next();
-            } catch (StopIteration) {
-                counts[height] -= 1;
-                if (counts[height] == 0) {
-                    // Gap heuristic: If relabeling causes a level to become
-                    // empty, a minimum cut has been identified. The algorithm
-                    // can now be terminated.
-                    R.graph["flow_value"] = flow_value
-                    return R
-                height = relabel(u);
-                if (u == s && height >= d) {
-                    if (!two_phase) {
-                        // t is disconnected from s : the residual network. No
-                        // more augmenting paths exist.
-                        R.graph["flow_value"] = flow_value
-                        return R
-                    } else {
-                        // t is at least d steps away from s. End of phase 1.
-                        done  = true;
-                        break;
-                counts[height] += 1;
-                R_nodes[u]["height"] = height
-                if (u != s) {
-                    // After relabeling, the last edge on the path is no longer
-                    // admissible. Retreat one step to look for an alternative.
-                    path.pop();
-                    u = path[-1];
-                    break;
-        if (u == t) {
-            // t is reached. Augment flow along the path && reset it for a new
-            // depth-first search.
-            flow_value += augment(path);
-            if (flow_value >= cutoff) {
-                R.graph["flow_value"] = flow_value
-                return R
-            path = [s];
-            u = s;
-
-    // Phase 2: Look for shortest augmenting paths using breadth-first search.
-    flow_value += edmonds_karp_core(R, s, t, cutoff - flow_value);
+    // Run the native solver on the arcs of R && write the flows back.
+    nodes = list(R);
+    edges = [(R._node_map[u], R._node_map[v], attr["capacity"]);
+             for (auto u, v, attr : R.edges(data=true)];
+    A = xn::ResidualNetwork<double>(len(R), edges.begin(), edges.end(), true);
+    flow_value = xn::shortest_augmenting_path_flow(
+        A, R._node_map[s], R._node_map[t], two_phase, cutoff);
+    for (auto i, u : enumerate(nodes)) {
+        for (auto a : range(A.indptr[i], A.indptr[i + 1])) {
+            R.succ[u][nodes[A.head[a]]]["flow"] = A.flow[a];
 
     R.graph["flow_value"] = flow_value
     return R
@@ -270,6 +148,11 @@ auto shortest_augmenting_path(G, s, t, capacity="capacity", residual=None,
     that :samp:`R[u][v]["flow"] < R[u][v]["capacity"]` induces a minimum
     :samp:`s`-:samp:`t` cut.
 
+    The algorithm runs natively on the arrays of `xn::ResidualNetwork`
+    (see `shortest_augmenting_path_flow`), with a current arc per node
+    && the gap heuristic. The second phase of the two-phase variant
+    uses Dinitz blocking flows.
+
     Examples
     --------
     >>> #include <xnetwork.hpp> // as xn
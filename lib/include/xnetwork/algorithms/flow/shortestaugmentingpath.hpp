@@ -0,0 +1,163 @@
+#ifndef _HOME_UBUNTU_GITHUB_XNETWORK_ALGORITHMS_FLOW_SHORTESTAUGMENTINGPATH_HPP
+#define _HOME_UBUNTU_GITHUB_XNETWORK_ALGORITHMS_FLOW_SHORTESTAUGMENTINGPATH_HPP 1
+
+//    Copyright (C) 2004-2018 by
+//    Wai-Shing Luk <luk036@gmail.com>
+//
+//
+//    All rights reserved.
+//    BSD license.
+/**
+Native shortest augmenting path algorithm on an array residual network.
+*/
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <vector>
+#include <xnetwork/algorithms/flow/dinitz_alg.hpp> // import _Dinitz
+#include <xnetwork/algorithms/flow/utils.hpp> // import ResidualNetwork
+
+namespace xn {
+
+/** Compute a maximum s-t flow on R with the shortest augmenting path
+    algorithm.
+
+    The algorithm of `shortest_augmenting_path` in
+    `shortestaugmentingpath.h` on dense arrays: exact distance labels
+    from a reverse BFS, a current arc per node, advance / retreat /
+    relabel along admissible arcs && the gap heuristic.  With
+    `two_phase` the first phase stops once s is `min(sqrt(m),
+    2 n^(2/3))` steps away from t && the second phase finishes with
+    Dinitz blocking flows (`_Dinitz`) instead of single BFS paths.
+
+    The flow of R is reset first; on return `R.flow` is a maximum flow
+    (or a flow of value at least `cutoff`) && `R.flow_value` its value,
+    which is also returned.
+
+    Parameters
+    ----------
+    R : ResidualNetwork
+
+    s, t : node indices
+        Source && sink.
+
+    two_phase : bool, optional (default=false)
+
+    cutoff : Cap, optional
+        Stop once the flow value reaches it.
+
+    Raises
+    ------
+    XNetworkError
+        If s or t is not a node, or s == t.
+
+    XNetworkUnbounded
+        If an infinite-capacity path joins s to t.
+*/
+template <typename Cap>
+auto shortest_augmenting_path_flow(
+    ResidualNetwork<Cap> &R, std::size_t s, std::size_t t,
+    bool two_phase = false, Cap cutoff = std::numeric_limits<Cap>::max())
+    -> Cap {
+    using index_t = typename ResidualNetwork<Cap>::index_t;
+    using arc_t = typename ResidualNetwork<Cap>::arc_t;
+
+    R.check_terminals(s, t);
+    R.detect_unboundedness(s, t);
+    R.reset();
+    auto n = R.num_nodes();
+
+    // Initialize heights of the nodes.
+    auto height = std::vector<index_t>(n, index_t(n));
+    auto queue = std::vector<index_t>{index_t(t)};
+    height[t] = 0;
+    for (std::size_t i = 0; i < queue.size(); ++i) {
+        auto u = queue[i];
+        for (auto a = R.indptr[u]; a < R.indptr[u + 1]; ++a) {
+            auto v = R.head[a];
+            if (height[v] == n && v != t && R.residual(R.rev[a]) > 0) {
+                height[v] = height[u] + 1;
+                queue.push_back(v);
+            }
+        }
+    }
+    if (height[s] == n)
+        return R.flow_value; // t is not reachable from s
+
+    auto counts = std::vector<std::size_t>(n + 1, 0);
+    for (std::size_t u = 0; u < n; ++u)
+        ++counts[height[u]];
+    auto current = std::vector<arc_t>(R.indptr.begin(), R.indptr.end() - 1);
+
+    auto m = double(R.num_arcs()) / 2;
+    auto d = two_phase ? std::size_t(std::min(std::sqrt(m),
+                                               2 * std::cbrt(double(n) * n)))
+                       : n;
+
+    auto path = std::vector<arc_t>{};
+    auto flow_value = Cap(0);
+    auto u = index_t(s);
+    auto done = height[s] >= d;
+    while (!done) {
+        if (u == t) {
+            // Augment flow along the path && restart from s.
+            auto f = R.residual(path[0]);
+            for (auto a : path)
+                f = std::min(f, R.residual(a));
+            for (auto a : path)
+                R.push(a, f);
+            flow_value += f;
+            if (flow_value >= cutoff) {
+                R.flow_value = flow_value;
+                return flow_value;
+            }
+            path.clear();
+            u = index_t(s);
+            continue;
+        }
+        // Look for an admissible arc, starting at the current one.
+        auto &a = current[u];
+        auto end = R.indptr[u + 1];
+        while (a < end &&
+               !(height[u] == height[R.head[a]] + 1 && R.residual(a) > 0))
+            ++a;
+        if (a < end) {
+            path.push_back(a);
+            u = R.head[a];
+            continue;
+        }
+        a = R.indptr[u];
+        if (--counts[height[u]] == 0)
+            break; // gap: a minimum cut has been found
+        // Relabel u to create an admissible arc.
+        auto h = index_t(n - 1);
+        for (auto b = R.indptr[u]; b < end; ++b)
+            if (R.residual(b) > 0)
+                h = std::min(h, height[R.head[b]]);
+        height[u] = h + 1;
+        if (u == s && height[u] >= d) {
+            if (!two_phase)
+                break; // t is disconnected from s
+            done = true;
+        }
+        ++counts[height[u]];
+        if (u != s) {
+            // The last arc of the path is no longer admissible.
+            path.pop_back();
+            u = path.empty() ? index_t(s) : R.head[path.back()];
+        }
+    }
+    if (done) {
+        // Phase 2: shortest augmenting paths by blocking flows.
+        flow_value += _Dinitz<Cap>(R, s, t).run(cutoff - flow_value);
+    }
+    R.flow_value = flow_value;
+    return flow_value;
+}
+
+} // namespace xn
+
+#endif
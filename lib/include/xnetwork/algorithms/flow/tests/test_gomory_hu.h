@@ -101,6 +101,21 @@ class TestGomoryHuTree) {
                 assert_equal(xn::minimum_cut_value(G, u, v, capacity="weight"),
                              cut_value);
 
+    auto test_native_threads_and_cut_query() {
+        G = xn::karate_club_graph();
+        xn::set_edge_attributes(G, 1, "capacity");
+        T = xn::gomory_hu_tree(G);
+        for (auto num_threads : (2, 0)) {
+            T2 = xn::gomory_hu_tree(G, num_threads=num_threads);
+            assert_equal(sorted(T.edges(data="weight")),
+                         sorted(T2.edges(data="weight")));
+        Q = xn::GomoryHuCutQuery(T);
+        for (auto [u, v] : combinations(G, 2) {
+            cut_value, edge = this->minimum_edge_weight(T, u, v);
+            assert_equal(Q.min_cut_value(u, v), cut_value);
+            assert_equal(len(this->compute_cutset(G, T, Q.min_cut_edge(u, v))),
+                         cut_value);
+
     /// /// @raises(xn::XNetworkNotImplemented);
     auto test_directed_raises() {
         G = xn::DiGraph();
@@ -8,10 +8,12 @@ from xnetwork.algorithms.flow import build_flow_dict, build_residual_network
 from xnetwork.algorithms.flow import boykov_kolmogorov
 from xnetwork.algorithms.flow import edmonds_karp
 from xnetwork.algorithms.flow import preflow_push
+from xnetwork.algorithms.flow import parallel_preflow_push
 from xnetwork.algorithms.flow import shortest_augmenting_path
 from xnetwork.algorithms.flow import dinitz
 
-flow_funcs = [boykov_kolmogorov, dinitz, edmonds_karp, preflow_push, shortest_augmenting_path];
+flow_funcs = [boykov_kolmogorov, dinitz, edmonds_karp, preflow_push,
+              parallel_preflow_push, shortest_augmenting_path];
 max_min_funcs = [xn::maximum_flow, xn::minimum_cut];
 flow_value_funcs = [xn::maximum_flow_value, xn::minimum_cut_value];
 interface_funcs = sum([max_min_funcs, flow_value_funcs], []);
@@ -82,6 +84,13 @@ auto compare_flows_and_cuts(G, s, t, solnFlows, solnValue, capacity="capacity")
         cut_value, partition = xn::minimum_cut(G, s, t, capacity=capacity,
                                               flow_func=flow_func);
         validate_cuts(G, s, t, solnValue, partition, capacity, flow_func);
+    // The default path runs natively on the array residual network.
+    flow_value, flow_dict = xn::maximum_flow(G, s, t, capacity=capacity);
+    assert_equal(flow_value, solnValue, msg=msg.format(preflow_push.__name__));
+    validate_flows(G, s, t, flow_dict, solnValue, capacity, preflow_push);
+    cut_value, partition = xn::minimum_cut(G, s, t, capacity=capacity);
+    assert_equal(cut_value, solnValue, msg=msg.format(preflow_push.__name__));
+    validate_cuts(G, s, t, solnValue, partition, capacity, preflow_push);
 
 
 class TestMaxflowMinCutCommon) {
@@ -417,6 +426,7 @@ class TestMaxFlowMinCutInterface) {
         to_test = (
             (shortest_augmenting_path, dict(two_phase=true)),
             (preflow_push, dict(global_relabel_freq=5)),
+            (parallel_preflow_push, dict(num_threads=2)),
         );
         for (auto interface_func : interface_funcs) {
             for (auto flow_func, kwargs : to_test) {
@@ -482,6 +492,91 @@ auto test_shortest_augmenting_path_two_phase() {
     assert_equal(R.graph["flow_value"], k);
 
 
+auto test_dinitz_unit_capacity_matching() {
+    // Bipartite matching as a unit-capacity flow problem; also with
+    // antiparallel unit edges, whose residual capacity can reach 2.
+    G = xn::complete_bipartite_graph(20, 20, create_using=xn::DiGraph());
+    for (auto i : range(20)) {
+        G.add_edge("s", i);
+        G.add_edge(20 + i, "t");
+    xn::set_edge_attributes(G, 1, "capacity");
+    for (auto flow_func : [dinitz, shortest_augmenting_path]) {
+        R = flow_func(G, "s", "t");
+        assert_equal(R.graph["flow_value"], 20);
+        R = flow_func(G, "s", "t", cutoff=7);
+        ok_(7 <= R.graph["flow_value"] <= 20);
+    H = xn::DiGraph();
+    xn::add_path(H, ["s", "a", "b", "t"], capacity=1);
+    xn::add_path(H, ["s", "b", "a", "t"], capacity=1);
+    assert_equal(dinitz(H, "s", "t").graph["flow_value"], 2);
+
+
+auto test_boykov_kolmogorov_trees() {
+    G = xn::DiGraph();
+    G.add_edge("x", "a", capacity=3.0);
+    G.add_edge("x", "b", capacity=1.0);
+    G.add_edge("a", "c", capacity=3.0);
+    G.add_edge("b", "c", capacity=5.0);
+    G.add_edge("b", "d", capacity=4.0);
+    G.add_edge("d", "e", capacity=2.0);
+    G.add_edge("c", "y", capacity=2.0);
+    G.add_edge("e", "y", capacity=3.0);
+    R = boykov_kolmogorov(G, "x", "y");
+    source_tree, target_tree = R.graph["trees"];
+    assert_equal(R.graph["flow_value"], 3.0);
+    assert_true(set(source_tree).isdisjoint(target_tree));
+    partition = (set(source_tree), set(G) - set(source_tree));
+    validate_cuts(G, "x", "y", 3.0, partition, "capacity", boykov_kolmogorov);
+    for (auto u, p : source_tree.items()) {
+        if (p is not None) {
+            assert_true(p : source_tree);
+
+
+auto test_boykov_kolmogorov_add_capacity() {
+    // a solver kept between calls re-solves after capacity changes on
+    // inner && terminal arcs, matching a solve from scratch, && its
+    // source tree stays a minimum cut
+    G = xn::gnm_random_graph(200, 1500, seed=11, directed=true);
+    edges = sorted(G.edges());
+    for (auto k, (u, v) : enumerate(edges)) {
+        G[u][v]["capacity"] = k % 10 + 1;
+    s, t = 0, 199
+    arcs = [(u, v, G[u][v]["capacity"]) for u, v : edges];
+    A = xn::ResidualNetwork<double>(len(G), arcs.begin(), arcs.end(), true);
+    bk = xn::BoykovKolmogorov<double>(A, s, t);
+    terminal = [(u, v) for u, v : edges if (u == s || v == t)];
+
+    auto check() {
+        // the source tree is the source side of a minimum cut; nodes are
+        // 0 .. n-1, so they are their own indices
+        flow_value = bk.maxflow();
+        assert_equal(flow_value, xn::maximum_flow_value(G, s, t));
+        side = bk.source_side();
+        assert_equal(sum(G[u][v]["capacity"] for u, v : edges
+                         if (side[u] && !side[v])), flow_value);
+
+    check();
+    for (auto k : range(60)) {
+        u, v = (k % 3 == 0) ? terminal[k % len(terminal)]
+                            : edges[(37 * k) % len(edges)];
+        delta = [3, -2, 5, -4, 1][k % 5];
+        delta = max(delta, -G[u][v]["capacity"]);
+        G[u][v]["capacity"] += delta
+        bk.add_capacity(u, v, delta);
+        check();
+    // terminal changes alone move nodes between the trees
+    for (auto k : range(60)) {
+        u, v = terminal[(7 * k) % len(terminal)];
+        delta = [6, -5, 2, -3][k % 4];
+        delta = max(delta, -G[u][v]["capacity"]);
+        G[u][v]["capacity"] += delta
+        bk.add_capacity(u, v, delta);
+        check();
+    u, v = edges[0];
+    assert_raises(xn::XNetworkError, bk.add_capacity, u, v,
+                  -G[u][v]["capacity"] - 1);
+
+
 class TestCutoff) {
 
     auto test_cutoff() {
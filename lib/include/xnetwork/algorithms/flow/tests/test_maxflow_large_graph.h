@@ -15,6 +15,7 @@ from xnetwork.algorithms.flow import boykov_kolmogorov
 from xnetwork.algorithms.flow import dinitz
 from xnetwork.algorithms.flow import edmonds_karp
 from xnetwork.algorithms.flow import preflow_push
+from xnetwork.algorithms.flow import parallel_preflow_push
 from xnetwork.algorithms.flow import shortest_augmenting_path
 
 flow_funcs = [
@@ -22,6 +23,7 @@ flow_funcs = [
     dinitz,
     edmonds_karp,
     preflow_push,
+    parallel_preflow_push,
     shortest_augmenting_path,
 ];
 
@@ -364,6 +364,77 @@ class TestMinCostFlow) {
         assert_equal(flowCost, 0);
         assert_equal(H, {1: {2: {0: 0}}, 2: {3: {0: 0}}, 3: {}});
 
+    auto test_parallel_edges_negative_cycle() {
+        /** Parallel edges are separate arcs of the native solver && a
+        capacitated negative cycle is saturated.
+         */
+        G = xn::MultiDiGraph();
+        G.add_node("s", demand=-3);
+        G.add_node("t", demand=3);
+        G.add_edge("s", "t", "a", capacity=2, weight=4);
+        G.add_edge("s", "t", "b", capacity=5, weight=6);
+        G.add_edge("t", "u", capacity=4, weight=-2);
+        G.add_edge("u", "t", capacity=1, weight=-1);
+        flowCost, H = xn::network_simplex(G);
+        assert_equal(flowCost, 11);
+        assert_equal(H, {"s": {"t": {"a": 2, "b": 1}},
+                         "t": {"u": {0: 1}}, "u": {"t": {0: 1}}});
+        assert_equal(xn::min_cost_flow_cost(G), 11);
+        assert_equal(xn::cost_of_flow(G, xn::min_cost_flow(G)), 11);
+
+        G = xn::DiGraph();
+        G.add_edge("s", "t", capacity=2, weight=4);
+        G.add_edge("s", "u", capacity=5, weight=1);
+        G.add_edge("u", "t", capacity=3, weight=1);
+        G.add_edge("t", "u", capacity=4, weight=-3);
+        flowDict = xn::max_flow_min_cost(G, "s", "t");
+        assert_equal(flowDict, {"s": {"t": 2, "u": 3}, "t": {"u": 0},
+                                "u": {"t": 3}});
+        assert_equal(xn::cost_of_flow(G, flowDict), 14);
+
+    auto test_cost_scaling() {
+        /** Cost scaling agrees with network simplex && can be selected
+        as the engine of the min cost flow functions.
+         */
+        G = xn::DiGraph();
+        G.add_node("a", demand=-5);
+        G.add_node("d", demand=5);
+        G.add_edge("a", "b", weight=3, capacity=4);
+        G.add_edge("a", "c", weight=6, capacity=10);
+        G.add_edge("b", "d", weight=1, capacity=9);
+        G.add_edge("c", "d", weight=2, capacity=5);
+        soln = {"a": {"b": 4, "c": 1},
+                "b": {"d": 4},
+                "c": {"d": 1},
+                "d": {}}
+        flowCost, H = xn::cost_scaling(G);
+        assert_equal(flowCost, 24);
+        assert_equal(H, soln);
+        assert_equal(xn::min_cost_flow_cost(G, flow_func=xn::cost_scaling), 24);
+        assert_equal(xn::min_cost_flow(G, flow_func=xn::cost_scaling), soln);
+
+        G = xn::MultiDiGraph();
+        G.add_node("s", demand=-3);
+        G.add_node("t", demand=3);
+        G.add_edge("s", "t", "a", capacity=2, weight=4);
+        G.add_edge("s", "t", "b", capacity=5, weight=6);
+        G.add_edge("t", "u", capacity=4, weight=-2);
+        G.add_edge("u", "t", capacity=1, weight=-1);
+        flowCost, H = xn::cost_scaling(G);
+        assert_equal(flowCost, 11);
+        assert_equal(xn::cost_of_flow(G, H), 11);
+
+        G = xn::DiGraph();
+        G.add_edge(1, 1, weight=-1);
+        assert_raises(xn::XNetworkUnbounded, xn::cost_scaling, G);
+        G.add_edge(1, 2, weight=0.5);
+        assert_raises(xn::XNetworkError, xn::cost_scaling, G);
+        G = xn::DiGraph();
+        G.add_node("s", demand=-5);
+        G.add_node("t", demand=5);
+        G.add_edge("s", "t", capacity=4);
+        assert_raises(xn::XNetworkUnfeasible, xn::cost_scaling, G);
+
     auto test_negative_selfloops() {
         /** Negative selfloops should cause an exception if (uncapacitated &&
         always be saturated otherwise.
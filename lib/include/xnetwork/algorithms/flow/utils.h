@@ -10,9 +10,11 @@ __author__ = R"(ysitu <ysitu@users.noreply.github.com>)"
 
 from collections import deque
 #include <xnetwork.hpp> // as xn
+#include <xnetwork/algorithms/flow/utils.hpp> // import ResidualNetwork
 
 static const auto __all__ = ["CurrentEdge", "Level", "GlobalRelabelThreshold",
-           "build_residual_network", "detect_unboundedness", "build_flow_dict"];
+           "build_residual_network", "detect_unboundedness", "build_flow_dict",
+           "build_residual_arrays", "build_flow_dict_from_arrays"];
 
 
 class CurrentEdge: public object {
@@ -168,3 +170,45 @@ auto build_flow_dict(G, R) {
         flow_dict[u].update((v, attr["flow"]) for v, attr : R[u].items();
                             if (attr["flow"] > 0);
     return flow_dict
+
+
+auto build_residual_arrays(G, capacity, s=None, t=None) {
+    /** Build the array residual network of G.
+
+    Returns a `xn::ResidualNetwork` with the conventions of
+    :meth:`build_residual_network`, node `u` being stored under the
+    index `G._node_map[u]`. If the terminals `s` && `t` are given they
+    are checked && returned as indices too.
+
+    Returns
+    -------
+    R : ResidualNetwork
+        Or `(R, s_index, t_index)` if the terminals are given.
+     */
+    if (G.is_multigraph() {
+        throw xn::XNetworkError(
+            "MultiGraph && MultiDiGraph not supported (yet).");
+    inf = double("inf");
+    edges = [(G._node_map[u], G._node_map[v], attr.get(capacity, inf));
+             for (auto u, v, attr : G.edges(data=true)];
+    R = xn::ResidualNetwork<double>(len(G), edges.begin(), edges.end(),
+                                    G.is_directed());
+    if (s is None && t is None) {
+        return R;
+    for (auto u : (s, t)) {
+        if (u not : G) {
+            throw xn::XNetworkError("node %s not : graph" % str(u));
+    return R, G._node_map[s], G._node_map[t];
+
+
+auto build_flow_dict_from_arrays(G, R) {
+    /** Build a flow dictionary from an array residual network.
+     */
+    nodes = list(G);
+    flow_dict = {};
+    for (auto i, u : enumerate(nodes)) {
+        flow_dict[u] = {v: 0 for v : G[u]}
+        flow_dict[u].update((nodes[R.head[a]], R.flow[a]);
+                            for (auto a : range(R.indptr[i], R.indptr[i + 1]);
+                            if (R.flow[a] > 0);
+    return flow_dict
@@ -0,0 +1,347 @@
+#ifndef _HOME_UBUNTU_GITHUB_XNETWORK_ALGORITHMS_FLOW_UTILS_HPP
+#define _HOME_UBUNTU_GITHUB_XNETWORK_ALGORITHMS_FLOW_UTILS_HPP 1
+
+//    Copyright (C) 2004-2018 by
+//    Wai-Shing Luk <luk036@gmail.com>
+//
+//
+//    All rights reserved.
+//    BSD license.
+/**
+Array-based residual network shared by the native flow algorithms.
+*/
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <tuple>
+#include <vector>
+#include <xnetwork/classes/csr.hpp> // import CSRGraph
+#include <xnetwork/exception.hpp> // import XNetworkError, XNetworkUnbounded
+
+namespace xn {
+
+/** A residual network stored as paired arc arrays.
+
+    This is the array counterpart of `build_residual_network` in
+    `utils.h`, with the same conventions: there is an arc `(u, v)` and
+    its twin `(v, u)` iff `u != v` && at least one of them is an edge of
+    positive capacity; `cap[a]` is the capacity of the edge (0 if only
+    its twin exists) && `flow[a] == -flow[rev[a]]`.  Arcs are grouped by
+    tail, `indptr[u] .. indptr[u + 1]`, && sorted by head within a row.
+    Infinite capacities are replaced by `inf`, three times the sum of
+    the finite capacities (or 1), as in `utils.h`.
+
+    Parameters
+    ----------
+    Cap : arithmetic type (default: double)
+        Type of capacities && flows.
+*/
+template <typename Cap = double> struct ResidualNetwork {
+    using index_t = std::uint32_t;
+    using arc_t = std::size_t;
+    using cap_t = Cap;
+
+    std::size_t n = 0;
+    std::vector<arc_t> indptr{0};
+    std::vector<index_t> head;
+    std::vector<arc_t> rev;
+    std::vector<Cap> cap;
+    std::vector<Cap> flow;
+    Cap inf = Cap(1);
+    Cap flow_value = Cap(0);
+
+    ResidualNetwork() = default;
+
+    /** Build from `(u, v, capacity)` triples on nodes `0 .. n-1`.
+
+        Self loops && edges of capacity <= 0 are dropped.  If `directed`
+        is false every edge gives both arcs its capacity.  Repeated
+        edges add up.
+    */
+    template <typename EdgeIter>
+    ResidualNetwork(std::size_t num_nodes, EdgeIter first, EdgeIter last,
+                    bool directed)
+        : n{num_nodes} {
+        auto arcs = std::vector<std::tuple<index_t, index_t, Cap>>{};
+        auto total = Cap(0);
+        for (auto it = first; it != last; ++it) {
+            const auto &[u, v, c] = *it;
+            if (u == v || !(Cap(c) > 0))
+                continue;
+            if (!_is_inf(Cap(c)))
+                total += Cap(c);
+            arcs.emplace_back(index_t(u), index_t(v), Cap(c));
+            arcs.emplace_back(index_t(v), index_t(u),
+                              directed ? Cap(0) : Cap(c));
+        }
+        this->_assemble(arcs, total);
+    }
+
+    /** Build from a CSR graph, its weights being the capacities.
+
+        An unweighted graph has unit capacities.  For undirected graphs
+        each edge gives both arcs its capacity.
+    */
+    template <typename W> explicit ResidualNetwork(const CSRGraph<W> &G) {
+        this->n = G.num_nodes();
+        auto arcs = std::vector<std::tuple<index_t, index_t, Cap>>{};
+        arcs.reserve(2 * G.num_arcs());
+        auto total = Cap(0);
+        for (std::size_t u = 0; u < this->n; ++u) {
+            for (auto k = G.indptr[u]; k < G.indptr[u + 1]; ++k) {
+                auto v = G.indices[k];
+                auto c = Cap(G.weight(k));
+                if (v == u || !(c > 0))
+                    continue;
+                // undirected edges are stored twice; count them once
+                if (!_is_inf(c) && (G.directed || u < v))
+                    total += c;
+                arcs.emplace_back(index_t(u), v, c);
+                arcs.emplace_back(v, index_t(u), Cap(0));
+            }
+        }
+        this->_assemble(arcs, total);
+    }
+
+    auto num_nodes() const { return this->n; }
+
+    auto num_arcs() const { return this->head.size(); }
+
+    auto residual(arc_t a) const -> Cap { return this->cap[a] - this->flow[a]; }
+
+    /** Send f units along arc a. */
+    void push(arc_t a, Cap f) {
+        this->flow[a] += f;
+        this->flow[this->rev[a]] -= f;
+    }
+
+    /** Zero the flow. */
+    void reset() {
+        std::fill(this->flow.begin(), this->flow.end(), Cap(0));
+        this->flow_value = Cap(0);
+    }
+
+    /** Net flow into u. */
+    auto net_inflow(std::size_t u) const -> Cap {
+        auto x = Cap(0);
+        for (auto a = this->indptr[u]; a < this->indptr[u + 1]; ++a)
+            x -= this->flow[a];
+        return x;
+    }
+
+    /** Return the arc `(u, v)`, || `num_arcs()` if there is none. */
+    auto find_arc(std::size_t u, std::size_t v) const -> arc_t {
+        auto b = this->head.begin() + this->indptr[u];
+        auto e = this->head.begin() + this->indptr[u + 1];
+        auto it = std::lower_bound(b, e, index_t(v));
+        return it != e && *it == v ? arc_t(it - this->head.begin())
+                                   : this->num_arcs();
+    }
+
+    /** Mark the nodes reachable from s through arcs with residual
+        capacity; after a maximum flow this is the source side of a
+        minimum cut.
+    */
+    auto source_side(std::size_t s) const -> std::vector<bool> {
+        auto seen = std::vector<bool>(this->n, false);
+        auto stack = std::vector<index_t>{index_t(s)};
+        seen[s] = true;
+        while (!stack.empty()) {
+            auto u = stack.back();
+            stack.pop_back();
+            for (auto a = this->indptr[u]; a < this->indptr[u + 1]; ++a) {
+                auto v = this->head[a];
+                if (!seen[v] && this->residual(a) > 0) {
+                    seen[v] = true;
+                    stack.push_back(v);
+                }
+            }
+        }
+        return seen;
+    }
+
+    /** Mark the nodes that reach t through arcs with residual
+        capacity.  This also works for a maximum preflow: the other
+        nodes form the source side of a minimum cut, as in
+        `minimum_cut` of `maxflow.h`.
+    */
+    auto sink_side(std::size_t t) const -> std::vector<bool> {
+        auto seen = std::vector<bool>(this->n, false);
+        auto stack = std::vector<index_t>{index_t(t)};
+        seen[t] = true;
+        while (!stack.empty()) {
+            auto u = stack.back();
+            stack.pop_back();
+            for (auto a = this->indptr[u]; a < this->indptr[u + 1]; ++a) {
+                auto v = this->head[a];
+                if (!seen[v] && this->residual(this->rev[a]) > 0) {
+                    seen[v] = true;
+                    stack.push_back(v);
+                }
+            }
+        }
+        return seen;
+    }
+
+    /** Throw `XNetworkUnbounded` if an infinite-capacity path joins s
+        to t, as `detect_unboundedness` of `utils.h`.
+    */
+    void detect_unboundedness(std::size_t s, std::size_t t) const {
+        if (!std::numeric_limits<Cap>::has_infinity)
+            return;
+        auto seen = std::vector<bool>(this->n, false);
+        auto stack = std::vector<index_t>{index_t(s)};
+        seen[s] = true;
+        while (!stack.empty()) {
+            auto u = stack.back();
+            stack.pop_back();
+            for (auto a = this->indptr[u]; a < this->indptr[u + 1]; ++a) {
+                auto v = this->head[a];
+                if (this->cap[a] != this->inf || seen[v])
+                    continue;
+                if (v == t)
+                    throw XNetworkUnbounded(
+                        "Infinite capacity path, flow unbounded above.");
+                seen[v] = true;
+                stack.push_back(v);
+            }
+        }
+    }
+
+    /** Check the terminals of an s-t problem. */
+    void check_terminals(std::size_t s, std::size_t t) const {
+        if (s >= this->n || t >= this->n)
+            throw XNetworkError("node not in graph");
+        if (s == t)
+            throw XNetworkError("source and sink are the same node");
+    }
+
+  private:
+    static auto _is_inf(Cap c) -> bool {
+        return std::numeric_limits<Cap>::has_infinity &&
+               c == std::numeric_limits<Cap>::infinity();
+    }
+
+    void _assemble(std::vector<std::tuple<index_t, index_t, Cap>> &arcs,
+                   Cap total) {
+        this->inf = total > 0 ? 3 * total : Cap(1);
+        std::sort(arcs.begin(), arcs.end(), [](const auto &x, const auto &y) {
+            return std::tie(std::get<0>(x), std::get<1>(x)) <
+                   std::tie(std::get<0>(y), std::get<1>(y));
+        });
+        this->indptr.assign(this->n + 1, 0);
+        this->head.clear();
+        this->cap.clear();
+        for (std::size_t i = 0; i < arcs.size();) {
+            auto [u, v, c] = arcs[i];
+            auto sum = Cap(0);
+            auto infinite = false;
+            for (; i < arcs.size() && std::get<0>(arcs[i]) == u &&
+                   std::get<1>(arcs[i]) == v;
+                 ++i) {
+                infinite = infinite || _is_inf(std::get<2>(arcs[i]));
+                sum += std::get<2>(arcs[i]);
+            }
+            ++this->indptr[u + 1];
+            this->head.push_back(v);
+            this->cap.push_back(infinite ? this->inf
+                                         : std::min(sum, this->inf));
+        }
+        for (std::size_t u = 0; u < this->n; ++u)
+            this->indptr[u + 1] += this->indptr[u];
+        this->rev.resize(this->head.size());
+        for (std::size_t u = 0; u < this->n; ++u)
+            for (auto a = this->indptr[u]; a < this->indptr[u + 1]; ++a)
+                this->rev[a] = this->find_arc(this->head[a], u);
+        this->flow.assign(this->head.size(), Cap(0));
+        this->flow_value = Cap(0);
+    }
+};
+
+/** Return the flow that stands for an infinite capacity in a minimum
+    cost flow problem.
+
+    No optimal flow puts more than the total finite capacity plus half
+    the total supply on one arc, so three times their sum (or 1) is
+    safe.  Self loops && arcs of capacity 0 never carry flow through
+    the network && are not counted.  Shared by `NetworkSimplex` &&
+    `CostScaling`.
+
+    Parameters
+    ----------
+    source, target : arc arrays
+
+    capacity : arc capacities; `is_inf(capacity[a])` marks unbounded arcs
+
+    demand : node demands
+*/
+template <typename Flow, typename Index, typename IsInf>
+auto _min_cost_big_flow(const std::vector<Index> &source,
+                        const std::vector<Index> &target,
+                        const std::vector<Flow> &capacity,
+                        const std::vector<Flow> &demand, IsInf is_inf)
+    -> Flow {
+    auto bound = Flow(0);
+    for (auto d : demand)
+        bound += d < 0 ? -d : d;
+    for (std::size_t a = 0; a < capacity.size(); ++a)
+        if (source[a] != target[a] && !is_inf(capacity[a]))
+            bound += capacity[a];
+    return bound > 0 ? 3 * bound : Flow(1);
+}
+
+/** Bellman-Ford over the arcs of infinite capacity, among the first
+    `capacity.size()` arcs: whether they hold a cycle of negative cost.
+*/
+template <typename Flow, typename Cost, typename Index, typename IsInf>
+auto _has_negative_infinite_cycle(std::size_t n,
+                                  const std::vector<Index> &source,
+                                  const std::vector<Index> &target,
+                                  const std::vector<Flow> &capacity,
+                                  const std::vector<Cost> &cost, IsInf is_inf)
+    -> bool {
+    auto dist = std::vector<Cost>(n, Cost(0));
+    for (std::size_t pass = 0; pass <= n; ++pass) {
+        auto changed = false;
+        for (std::size_t a = 0; a < capacity.size(); ++a) {
+            const auto u = source[a], v = target[a];
+            if (u == v || !is_inf(capacity[a]))
+                continue;
+            if (dist[u] + cost[a] < dist[v]) {
+                dist[v] = dist[u] + cost[a];
+                changed = true;
+            }
+        }
+        if (!changed)
+            return false;
+    }
+    return true;
+}
+
+/** Whether a minimum cost flow computed with infinite capacities
+    replaced by `big_flow` is in fact unbounded.
+
+    A huge flow on an arc is only a hint: a zero-cost cycle of infinite
+    capacity may carry any amount of flow at no cost.  The negative
+    cycle check runs once, && only if some arc carries at least half of
+    `big_flow`.
+*/
+template <typename Flow, typename Cost, typename Index, typename IsInf>
+auto _min_cost_unbounded(std::size_t n, const std::vector<Index> &source,
+                         const std::vector<Index> &target,
+                         const std::vector<Flow> &capacity,
+                         const std::vector<Cost> &cost,
+                         const std::vector<Flow> &flow, Flow big_flow,
+                         IsInf is_inf) -> bool {
+    auto huge = false;
+    for (std::size_t a = 0; a < capacity.size() && !huge; ++a)
+        huge = source[a] != target[a] && flow[a] * 2 >= big_flow;
+    return huge && _has_negative_infinite_cycle(n, source, target, capacity,
+                                                cost, is_inf);
+}
+
+} // namespace xn
+
+#endif
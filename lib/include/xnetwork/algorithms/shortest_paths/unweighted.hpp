@@ -0,0 +1,200 @@
+#ifndef _HOME_UBUNTU_GITHUB_XNETWORK_ALGORITHMS_SHORTEST_PATHS_UNWEIGHTED_HPP
+#define _HOME_UBUNTU_GITHUB_XNETWORK_ALGORITHMS_SHORTEST_PATHS_UNWEIGHTED_HPP 1
+
+//    Copyright (C) 2004-2018 by
+//    Wai-Shing Luk <luk036@gmail.com>
+//
+//
+//    All rights reserved.
+//    BSD license.
+/**
+Native breadth-first search kernels over CSR graphs.
+*/
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include <xnetwork/classes/csr.hpp> // import CSRGraph
+#include <xnetwork/utils/parallel.hpp> // import parallel_for
+
+namespace xn {
+
+/** Per-source distance sums produced by `multi_source_bfs_sums`.
+
+    For source `s`, `reach[s]` counts the nodes at finite distance
+    (including `s` itself), `farness[s]` is the sum of those distances,
+    `harmonic[s]` the sum of their reciprocals (excluding `s`) and
+    `eccentricity[s]` the largest of them.
+*/
+struct BFSSums {
+    std::vector<std::uint64_t> farness;
+    std::vector<std::uint64_t> reach;
+    std::vector<double> harmonic;
+    std::vector<std::uint64_t> eccentricity;
+};
+
+/** Sum BFS distances from every node with a bit-parallel multi-source BFS.
+
+    Sources are processed 64 at a time: every node keeps one machine
+    word whose bit `j` says whether the `j`-th source of the batch has
+    reached it, so a single sweep over the arcs advances all 64 searches
+    by one level (Then et al., "The More the Merrier: Efficient
+    Multi-Source Graph Traversal", VLDB 2015).  Each level is a pull over
+    the predecessor rows and is split across threads; nodes already seen
+    by the whole batch are skipped.
+
+    Parameters
+    ----------
+    G : CSRGraph
+        The graph.  Arc weights are ignored.
+
+    reverse : bool, optional (default=false)
+        If false, distances are measured from each source along the arcs
+        (d(s, v)); if true, towards each source (d(v, s)).  Ignored for
+        undirected graphs.
+
+    num_threads : unsigned, optional (default=0)
+        Number of threads; 0 uses all hardware threads.
+
+    Returns
+    -------
+    sums : BFSSums
+        Distance sums indexed by source.
+*/
+template <typename W>
+auto multi_source_bfs_sums(const CSRGraph<W> &G, bool reverse = false,
+                           unsigned num_threads = 0) -> BFSSums {
+    using word_t = std::uint64_t;
+    constexpr std::size_t width = 64;
+
+    const auto n = G.num_nodes();
+    auto sums = BFSSums{std::vector<std::uint64_t>(n, 0),
+                        std::vector<std::uint64_t>(n, 1),
+                        std::vector<double>(n, 0.0),
+                        std::vector<std::uint64_t>(n, 0)};
+    if (n == 0)
+        return sums;
+
+    // pulling over the rows of P advances the search along the arcs of G
+    auto transposed = CSRGraph<W>{};
+    if (G.directed && !reverse)
+        transposed = G.transpose();
+    const auto &P = (G.directed && !reverse) ? transposed : G;
+
+    const auto nt = resolve_num_threads(num_threads);
+    auto seen = std::vector<word_t>(n);
+    auto frontier = std::vector<word_t>(n);
+    auto next = std::vector<word_t>(n);
+    auto counts = std::vector<std::array<std::uint64_t, width>>(nt);
+    auto active = std::vector<char>(nt);
+
+    for (std::size_t first = 0; first < n; first += width) {
+        const auto batch = std::min(width, n - first);
+        const auto full = batch == width ? ~word_t(0)
+                                         : (word_t(1) << batch) - 1;
+        std::fill(seen.begin(), seen.end(), word_t(0));
+        std::fill(frontier.begin(), frontier.end(), word_t(0));
+        for (std::size_t j = 0; j < batch; ++j) {
+            seen[first + j] = word_t(1) << j;
+            frontier[first + j] = word_t(1) << j;
+        }
+
+        for (std::uint64_t d = 1;; ++d) {
+            for (auto &c : counts)
+                c.fill(0);
+            std::fill(active.begin(), active.end(), 0);
+
+            parallel_for(
+                n,
+                [&](std::size_t v, unsigned tid) {
+                    auto s = seen[v];
+                    if (s == full) {
+                        next[v] = 0;
+                        return;
+                    }
+                    auto m = word_t(0);
+                    auto [b, e] = P.neighbors(v);
+                    for (auto it = b; it != e; ++it)
+                        m |= frontier[*it];
+                    m &= ~s;
+                    next[v] = m;
+                    if (m == 0)
+                        return;
+                    seen[v] = s | m;
+                    active[tid] = 1;
+                    auto &c = counts[tid];
+                    for (; m != 0; m &= m - 1)
+                        ++c[__builtin_ctzll(m)];
+                },
+                nt, 1024);
+
+            auto any = false;
+            for (auto a : active)
+                any = any || a;
+            if (!any)
+                break;
+            for (std::size_t j = 0; j < batch; ++j) {
+                auto total = std::uint64_t(0);
+                for (const auto &c : counts)
+                    total += c[j];
+                sums.farness[first + j] += d * total;
+                sums.reach[first + j] += total;
+                sums.harmonic[first + j] += double(total) / double(d);
+                if (total != 0)
+                    sums.eccentricity[first + j] = d;
+            }
+            frontier.swap(next);
+        }
+    }
+    return sums;
+}
+
+/** Reusable single-source BFS workspace over a CSR graph.
+
+    `dist` holds -1 for unvisited nodes.  Only the entries touched by
+    the last search are reset, so repeated searches cost O(visited).
+*/
+struct BFSWorkspace {
+    std::vector<std::int64_t> dist;
+    std::vector<std::uint32_t> queue;
+    std::size_t visited = 0;
+
+    explicit BFSWorkspace(std::size_t n) : dist(n, -1) { queue.reserve(n); }
+
+    void reset() {
+        for (std::size_t k = 0; k < this->visited; ++k)
+            this->dist[this->queue[k]] = -1;
+        this->queue.clear();
+        this->visited = 0;
+    }
+
+    /** Run a BFS from `source`; return the eccentricity of `source`.
+
+        After the call `queue[0 .. visited)` lists the reached nodes in
+        BFS order and `dist` holds their distances.
+    */
+    template <typename W>
+    auto run(const CSRGraph<W> &G, std::uint32_t source) -> std::int64_t {
+        this->reset();
+        this->queue.push_back(source);
+        this->dist[source] = 0;
+        for (std::size_t head = 0; head < this->queue.size(); ++head) {
+            auto u = this->queue[head];
+            auto du = this->dist[u];
+            auto [b, e] = G.neighbors(u);
+            for (auto it = b; it != e; ++it) {
+                if (this->dist[*it] < 0) {
+                    this->dist[*it] = du + 1;
+                    this->queue.push_back(*it);
+                }
+            }
+        }
+        this->visited = this->queue.size();
+        return this->dist[this->queue.back()];
+    }
+};
+
+} // namespace xn
+
+#endif
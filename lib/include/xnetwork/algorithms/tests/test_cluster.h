@@ -1,6 +1,9 @@
 // !file C++17
 from nose.tools import *
+from itertools import combinations
+from collections import Counter
 #include <xnetwork.hpp> // as xn
+#include <xnetwork/algorithms/cluster.h> // import _triangles_and_degree_iter, _weighted_triangles_and_degree_iter, _directed_triangles_and_degree_iter, _directed_weighted_triangles_and_degree_iter
 
 
 class TestTriangles) {
@@ -36,6 +39,66 @@ class TestTriangles) {
         assert_equal(xn::triangles(G, 1), 3);
 
 
+class TestNativeTriangles) {
+    // gnp graphs have the nodes 0 .. n-1, so nodes are their own indices
+
+    auto setUp() {
+        this->graphs = [xn::gnp_random_graph(40, 0.2, seed=seed)
+                        for seed : range(4)];
+        this->digraphs = [xn::gnp_random_graph(40, 0.15, seed=seed,
+                                               directed=true)
+                          for seed : range(4)];
+        for (auto k, G : enumerate(this->graphs + this->digraphs)) {
+            for (auto i, (u, v) : enumerate(G.edges())) {
+                G[u][v]["weight"] = (7 * i + k) % 9 + 1;
+
+    auto test_triangle_counts() {
+        for (auto G : this->graphs) {
+            expected = [sum(1 for u, w : combinations(G[v], 2) if (w : G[u]))
+                        for v : G];
+            for (auto num_threads : [1, 4]) {
+                assert_equal(list(xn::triangle_counts(xn::to_csr(G), num_threads)),
+                             expected);
+
+    auto test_unweighted() {
+        for (auto G : this->graphs) {
+            stats = xn::triangle_stats(xn::to_csr(G, "weight"), false);
+            for (auto v, d, t, _ : _triangles_and_degree_iter(G)) {
+                assert_equal(stats.degree[v], d);
+                assert_equal(stats.t[v], t);
+
+    auto test_weighted() {
+        for (auto G : this->graphs) {
+            stats = xn::triangle_stats(xn::to_csr(G, "weight"), true);
+            for (auto v, d, t : _weighted_triangles_and_degree_iter(G)) {
+                assert_equal(stats.degree[v], d);
+                assert_almost_equal(stats.t[v], t);
+            // unit weights give the unweighted sums
+            H = xn::Graph(G.edges());
+            assert_equal(xn::triangle_stats(xn::to_csr(H, "weight"), true).t,
+                         xn::triangle_stats(xn::to_csr(H), false).t);
+
+    auto test_directed() {
+        for (auto G : this->digraphs) {
+            stats = xn::triangle_stats(xn::to_csr(G), false);
+            for (auto v, dt, db, t : _directed_triangles_and_degree_iter(G)) {
+                assert_equal(stats.degree[v], dt);
+                assert_equal(stats.reciprocal[v], db);
+                assert_equal(stats.t[v], t);
+            stats = xn::triangle_stats(xn::to_csr(G, "weight"), true);
+            for (auto v, dt, db, t :
+                 _directed_weighted_triangles_and_degree_iter(G)) {
+                assert_almost_equal(stats.t[v], t);
+
+    auto test_weighted_clustering() {
+        // every node at once goes through the native pass, a single node
+        // through the iterators
+        for (auto G : this->graphs + this->digraphs) {
+            cc = xn::clustering(G, weight="weight");
+            for (auto v : G) {
+                assert_almost_equal(cc[v], xn::clustering(G, v, weight="weight"));
+
+
 class TestDirectedClustering) {
 
     auto test_clustering() {
@@ -284,3 +347,55 @@ class TestGeneralizedDegree) {
         assert_equal(xn::generalized_degree(G, 0), {3: 4});
         G.remove_edge(0, 1);
         assert_equal(xn::generalized_degree(G, 0), {2: 3});
+
+
+class TestNativeSquares) {
+    // sparse gnp graphs, with an isolated node && a pendant path so that
+    // some nodes have degree < 2; nodes are their own indices
+
+    auto setUp() {
+        this->graphs = [];
+        for (auto seed : range(4)) {
+            G = xn::gnp_random_graph(30, 0.12, seed=seed);
+            G.add_edges_from([(30, 0), (31, 30)]);
+            G.add_node(32);
+            this->graphs.append(G);
+
+    auto test_square_stats() {
+        for (auto G : this->graphs) {
+            for (auto num_threads : [1, 4]) {
+                stats = xn::square_stats(xn::to_csr(G), num_threads);
+                for (auto v : G) {
+                    squares = 0;
+                    potential = 0;
+                    for (auto u, w : combinations(G[v], 2) {
+                        q = len((set(G[u]) & set(G[w])) - set([v]));
+                        degm = q + 1 + (w : G[u]);
+                        squares += q;
+                        potential += (len(G[u]) - degm) * (len(G[w]) - degm) + q;
+                    assert_equal(stats.squares[v], squares);
+                    assert_almost_equal(stats.potential[v], potential);
+                    if (potential > 0) {
+                        assert_almost_equal(stats.clustering(v), squares / potential);
+                    } else {
+                        assert_equal(stats.clustering(v), 0.);
+            // all nodes go through the native pass, one node through the
+            // reference loop
+            c = xn::square_clustering(G);
+            for (auto v : G) {
+                assert_almost_equal(c[v], xn::square_clustering(G, v));
+            assert_equal(c[31], 0.);
+            assert_equal(c[32], 0.);
+
+    auto test_generalized_degrees() {
+        for (auto G : this->graphs) {
+            for (auto num_threads : [1, 4]) {
+                gd = xn::generalized_degrees(xn::to_csr(G), num_threads);
+                for (auto v : G) {
+                    expected = Counter(len(set(G[u]) & set(G[v])) for u : G[v]);
+                    assert_equal(dict(gd[v]), dict(expected));
+            gdeg = xn::generalized_degree(G);
+            for (auto v : G) {
+                assert_equal(gdeg[v], xn::generalized_degree(G, v));
+            assert_equal(gdeg[31], {0: 1});
+            assert_equal(gdeg[32], {});
@@ -124,3 +124,31 @@ class TestCore) {
         // k=2
         k_corona_subgraph = xn::k_corona(this->H, k=0);
         assert_equal(sorted(k_corona_subgraph.nodes()), [0]);
+
+    auto test_core_numbers_parallel() {
+        // threshold 0 runs the parallel peeling on small graphs too; gnm
+        // graphs have the nodes 0 .. n-1, so nodes are their own indices
+        for (auto seed : range(4)) {
+            G = xn::gnm_random_graph(2000, 2000 * (seed + 1), seed=seed);
+            C = xn::to_csr(G);
+            expected = xn::_core_number_bz(C);
+            core = xn::core_number(G);
+            assert_equal(list(expected), [core[v] for v : G]);
+            for (auto num_threads : [2, 3, 4, 8]) {
+                assert_equal(xn::core_numbers(C, num_threads, 0), expected);
+            D = xn::gnm_random_graph(2000, 3000, seed=seed, directed=true);
+            C = xn::to_csr(D);
+            expected = xn::_core_number_bz(xn::_core_adjacency(C));
+            for (auto num_threads : [2, 3, 4, 8]) {
+                assert_equal(xn::core_numbers(C, num_threads, 0), expected);
+
+    auto test_core_maintainer() {
+        G = xn::Graph(this->G);
+        cm = xn::CoreMaintainer(G);
+        assert_equal(cm.core_number(), xn::core_number(G));
+        // join the 1-core path 17-20 into the 3-core
+        cm.add_edges_from([(17, 1), (17, 2), (17, 3), (18, 19), (20, 12)]);
+        assert_equal(cm.core_number(), xn::core_number(G));
+        cm.remove_edges_from([(1, 2), (3, 7), (9, 10), (13, 14)]);
+        assert_equal(cm.core_number(), xn::core_number(G));
+        assert_equal(cm[21], 0);
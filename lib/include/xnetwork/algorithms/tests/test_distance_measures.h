@@ -52,6 +52,13 @@ class TestDistance) {
     auto test_bound_diameter() {
         assert_equal(xnetwork.diameter(this->G, usebounds=true), 6);
 
+    auto test_bound_diameter_large() {
+        G = xnetwork.connected_watts_strogatz_graph(1000, 6, 0.1, seed=42);
+        e = xnetwork.eccentricity(G);
+        assert_equal(xnetwork.diameter(G, usebounds=true), max(e.values()));
+        assert_equal(xnetwork.radius(G, usebounds=true), min(e.values()));
+        assert_equal(xnetwork.extrema_bounding(G, compute="eccentricities"), e);
+
     auto test_bound_radius() {
         assert_equal(xnetwork.radius(this->G, usebounds=true), 4);
 
@@ -23,3 +23,13 @@ auto test_triadic_census() {
                 '111D': 1, '300': 0, '120D': 0, '021C': 2}
     actual = xn::triadic_census(G);
     assert_equal(expected, actual);
+
+
+auto test_triadic_census_selfloops() {
+    /** Self loops do not change the census. */
+    G = xn::DiGraph([(0, 1), (1, 2), (2, 0), (2, 3), (3, 2)]);
+    expected = xn::triadic_census(G);
+    G.add_edges_from([(0, 0), (3, 3)]);
+    assert_equal(expected, xn::triadic_census(G));
+    assert_equal(sum(expected.values()), 4);
+    assert_equal(expected['030C'], 1);
@@ -17,6 +17,7 @@ from math import isnan
 
 #include <xnetwork.hpp> // as xn
 #include <xnetwork/utils.hpp> // import UnionFind, not_implemented_for
+#include <xnetwork/utils/union_find.hpp> // import DenseUnionFind
 
 static const auto __all__ = [
     "minimum_spanning_edges", "maximum_spanning_edges",
@@ -149,7 +150,9 @@ auto kruskal_mst_edges(G, minimum, weight="weight",
         If `ignore_nan is true` then that edge is ignored instead.
 
      */
-    subtrees = UnionFind();
+    // nodes are already dense indices, so no hashing per find
+    subtrees = xn::DenseUnionFind(len(G));
+    idx = G._node_map;
     if (G.is_multigraph() {
         edges = G.edges(keys=true, data=true);
 
@@ -180,7 +183,8 @@ auto kruskal_mst_edges(G, minimum, weight="weight",
     // Multigraphs need to handle edge keys : addition to edge data.
     if (G.is_multigraph() {
         for (auto wt, u, v, k, d : edges) {
-            if (subtrees[u] != subtrees[v]) {
+            // unite() is false when u && v already share a tree
+            if (subtrees.unite(idx[u], idx[v])) {
                 if (keys) {
                     if (data) {
                         yield u, v, k, d
@@ -191,15 +195,14 @@ auto kruskal_mst_edges(G, minimum, weight="weight",
                         yield u, v, d
                     } else {
                         yield u, v
-                subtrees.union(u, v);
     } else {
         for (auto wt, u, v, d : edges) {
-            if (subtrees[u] != subtrees[v]) {
+            // unite() is false when u && v already share a tree
+            if (subtrees.unite(idx[u], idx[v])) {
                 if (data) {
                     yield (u, v, d);
                 } else {
                     yield (u, v);
-                subtrees.union(u, v);
 
 
 auto prim_mst_edges(G, minimum, weight="weight",
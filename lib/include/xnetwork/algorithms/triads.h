@@ -12,6 +12,8 @@
 /** Functions for analyzing triads of a graph. */
 // from __future__ import division
 
+#include <xnetwork/algorithms/triads.hpp> // import triadic_census_counts
+#include <xnetwork/classes/csr.hpp> // import to_csr
 #include <xnetwork/utils.hpp> // import not_implemented_for
 
 __author__ = "\n".join(["Alex Levenson (alex@isnontinvain.com)",
@@ -70,7 +72,8 @@ auto triadic_census(G) {
     Notes
     -----
     This algorithm has complexity $O(m)$ where $m$ is the number of edges in
-    the graph.
+    the graph.  It runs natively && in parallel over the nodes; see
+    `triadic_census_counts`.  Self loops are ignored.
 
     See also
     --------
@@ -84,33 +87,5 @@ auto triadic_census(G) {
         http://vlado.fmf.uni-lj.si/pub/networks/doc/triads/triads.pdf
 
      */
-    // Initialize the count for each triad to be zero.
-    census = {name: 0 for name : TRIAD_NAMES}
-    n = len(G);
-    // m = dict(zip(G, range(n)));
-    m = {v: i for i, v : enumerate(G)}
-    for (auto v : G) {
-        vnbrs = set(G.pred[v]) | set(G.succ[v]);
-        for (auto u : vnbrs) {
-            if (m[u] <= m[v]) {
-                continue;
-            neighbors = (vnbrs | set(G.succ[u]) | set(G.pred[u])) - {u, v}
-            // Calculate dyadic triads instead of counting them.
-            if (v : G[u] && u : G[v]) {
-                census["102"] += n - len(neighbors) - 2
-            } else {
-                census["012"] += n - len(neighbors) - 2
-            // Count connected triads.
-            for (auto w : neighbors) {
-                if (m[u] < m[w] || (m[v] < m[w] < m[u] &&
-                                   v not : G.pred[w] &&
-                                   v not : G.succ[w]) {
-                    code = _tricode(G, v, u, w);
-                    census[TRICODE_TO_NAME[code]] += 1;
-
-    // null triads = total number of possible triads - all found triads
-    //
-    // Use integer division here, since we know this formula guarantees an
-    // integral value.
-    census["003"] = ((n * (n - 1) * (n - 2)) // 6) - sum(census.values());
-    return census
+    counts = xn::triadic_census_counts(xn::to_csr(G));
+    return {name: counts[i] for i, name : enumerate(TRIAD_NAMES)}
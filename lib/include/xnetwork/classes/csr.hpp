@@ -0,0 +1,300 @@
+#ifndef _HOME_UBUNTU_GITHUB_XNETWORK_CLASS_CSR_HPP
+#define _HOME_UBUNTU_GITHUB_XNETWORK_CLASS_CSR_HPP 1
+
+//    Copyright (C) 2004-2018 by
+//    Wai-Shing Luk <luk036@gmail.com>
+//
+//
+//    All rights reserved.
+//    BSD license.
+/**
+Compressed sparse row snapshot of a graph, used by the native kernels.
+*/
+
+#include <algorithm>
+#include <any>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace xn {
+
+/** A read-only compressed sparse row (CSR) view of a graph.
+
+    Node `u` is stored under its dense index `G._node_map[u]`, so the
+    arrays returned by the native kernels are indexed exactly like
+    `G._adj`.  The neighbors of index `i` are
+    `indices[indptr[i] .. indptr[i + 1])`, sorted ascending.
+
+    For undirected graphs every edge appears in both directions.  For
+    directed graphs the arcs are the successors; use `transpose()` for
+    the predecessors.
+
+    Parameters
+    ----------
+    Weight : arithmetic type (default: double)
+        Type of the arc weights.  `to_csr(G)` only fills weights when
+        the graph's inner adjacency maps neighbors to an arithmetic
+        value; `to_csr(G, weight)` always does.
+*/
+template <typename Weight = double> struct CSRGraph {
+    using index_t = std::uint32_t;
+    using weight_t = Weight;
+
+    std::size_t n = 0;
+    bool directed = false;
+    std::vector<std::size_t> indptr{0};
+    std::vector<index_t> indices;
+    std::vector<Weight> weights; // empty if (unweighted
+
+    CSRGraph() = default;
+
+    /** Build a CSR graph from a list of arcs `(u, v)` on `n` nodes.
+
+        If `directed` is false each pair is inserted in both directions.
+        Duplicate arcs are kept; self loops are kept as given.
+    */
+    template <typename EdgeIter>
+    CSRGraph(std::size_t num_nodes, EdgeIter first, EdgeIter last,
+             bool is_directed)
+        : n{num_nodes}, directed{is_directed}, indptr(num_nodes + 1, 0) {
+        for (auto it = first; it != last; ++it) {
+            auto [u, v] = *it;
+            ++this->indptr[u + 1];
+            if (!is_directed && u != v)
+                ++this->indptr[v + 1];
+        }
+        for (std::size_t i = 0; i < num_nodes; ++i)
+            this->indptr[i + 1] += this->indptr[i];
+        this->indices.resize(this->indptr[num_nodes]);
+        auto pos = std::vector<std::size_t>(this->indptr.begin(),
+                                             this->indptr.end() - 1);
+        for (auto it = first; it != last; ++it) {
+            auto [u, v] = *it;
+            this->indices[pos[u]++] = index_t(v);
+            if (!is_directed && u != v)
+                this->indices[pos[v]++] = index_t(u);
+        }
+        this->_sort_rows();
+    }
+
+    auto num_nodes() const { return this->n; }
+
+    auto num_arcs() const { return this->indices.size(); }
+
+    auto is_weighted() const { return !this->weights.empty(); }
+
+    auto degree(std::size_t i) const {
+        return this->indptr[i + 1] - this->indptr[i];
+    }
+
+    /** Return the `[begin, end)` pointer range of the neighbors of i. */
+    auto neighbors(std::size_t i) const {
+        const auto *base = this->indices.data();
+        return std::pair{base + this->indptr[i], base + this->indptr[i + 1]};
+    }
+
+    /** Return the weight of the arc stored at position k (1 if (unweighted). */
+    auto weight(std::size_t k) const -> Weight {
+        return this->weights.empty() ? Weight(1) : this->weights[k];
+    }
+
+    /** Return the position of the reverse arc `(v, u)` of each arc `(u, v)`.
+
+        Only meaningful for undirected graphs, where every arc has its
+        twin.  Rows are sorted, so each lookup is a binary search.
+    */
+    auto reverse_arcs() const -> std::vector<std::size_t> {
+        auto rev = std::vector<std::size_t>(this->indices.size());
+        for (std::size_t u = 0; u < this->n; ++u) {
+            for (auto k = this->indptr[u]; k < this->indptr[u + 1]; ++k) {
+                auto v = this->indices[k];
+                auto b = this->indices.begin() + this->indptr[v];
+                auto e = this->indices.begin() + this->indptr[v + 1];
+                rev[k] = std::size_t(
+                    std::lower_bound(b, e, index_t(u)) - this->indices.begin());
+            }
+        }
+        return rev;
+    }
+
+    /** Return the graph with every arc reversed.
+
+        For an undirected graph this is a copy of itself.
+    */
+    auto transpose() const -> CSRGraph {
+        if (!this->directed)
+            return *this;
+        auto T = CSRGraph{};
+        T.n = this->n;
+        T.directed = true;
+        T.indptr.assign(this->n + 1, 0);
+        for (auto v : this->indices)
+            ++T.indptr[v + 1];
+        for (std::size_t i = 0; i < this->n; ++i)
+            T.indptr[i + 1] += T.indptr[i];
+        T.indices.resize(this->indices.size());
+        if (this->is_weighted())
+            T.weights.resize(this->weights.size());
+        auto pos = std::vector<std::size_t>(T.indptr.begin(),
+                                            T.indptr.end() - 1);
+        // rows are visited in order, so every row of T comes out sorted
+        for (std::size_t u = 0; u < this->n; ++u) {
+            for (auto k = this->indptr[u]; k < this->indptr[u + 1]; ++k) {
+                auto p = pos[this->indices[k]]++;
+                T.indices[p] = index_t(u);
+                if (this->is_weighted())
+                    T.weights[p] = this->weights[k];
+            }
+        }
+        return T;
+    }
+
+    void _sort_rows() {
+        auto perm = std::vector<std::size_t>{};
+        for (std::size_t i = 0; i < this->n; ++i) {
+            auto b = this->indptr[i], e = this->indptr[i + 1];
+            if (this->weights.empty()) {
+                std::sort(this->indices.begin() + b, this->indices.begin() + e);
+                continue;
+            }
+            perm.resize(e - b);
+            for (auto k = b; k < e; ++k)
+                perm[k - b] = k;
+            std::sort(perm.begin(), perm.end(), [&](auto x, auto y) {
+                return this->indices[x] < this->indices[y];
+            });
+            auto idx = std::vector<index_t>(perm.size());
+            auto wts = std::vector<Weight>(perm.size());
+            for (std::size_t k = 0; k < perm.size(); ++k) {
+                idx[k] = this->indices[perm[k]];
+                wts[k] = this->weights[perm[k]];
+            }
+            std::copy(idx.begin(), idx.end(), this->indices.begin() + b);
+            std::copy(wts.begin(), wts.end(), this->weights.begin() + b);
+        }
+    }
+};
+
+/** Take a CSR snapshot of an XNetwork graph.
+
+    The adjacency of `G` is read through `G._adj` and `G._node_map`,
+    so any `Graph` or `DiGraphS` instantiation works.  When the inner
+    adjacency maps neighbors to an arithmetic value (for example
+    `py::dict<Node, double>`) that value becomes the arc weight.
+
+    Examples
+    --------
+    >>> auto G = xn::Graph(py::range(4), py::range(4));
+    >>> G.add_edge(0, 1);
+    >>> auto C = xn::to_csr(G);
+    >>> C.degree(0);
+    1
+*/
+template <typename Weight = double, typename Graph>
+auto to_csr(const Graph &G) -> CSRGraph<Weight> {
+    using key_type = typename Graph::key_type;
+    using value_type = typename Graph::value_type;
+    using index_t = typename CSRGraph<Weight>::index_t;
+
+    auto C = CSRGraph<Weight>{};
+    C.n = std::size(G._adj);
+    C.directed = G.is_directed();
+    C.indptr.assign(C.n + 1, 0);
+    for (std::size_t i = 0; i < C.n; ++i)
+        C.indptr[i + 1] = C.indptr[i] + std::size(G._adj[i]);
+    C.indices.reserve(C.indptr[C.n]);
+
+    for (std::size_t i = 0; i < C.n; ++i) {
+        if constexpr (std::is_same_v<key_type, value_type>) {
+            // set
+            for (const auto &v : G._adj[i])
+                C.indices.push_back(index_t(G._node_map[v]));
+        } else {
+            for (const auto &[v, data] : G._adj[i].items()) {
+                C.indices.push_back(index_t(G._node_map[v]));
+                if constexpr (std::is_arithmetic_v<
+                                  std::decay_t<decltype(data)>>) {
+                    C.weights.push_back(Weight(data));
+                }
+            }
+        }
+    }
+    C._sort_rows();
+    return C;
+}
+
+/** Return the value of `x` as an arc weight; `x` is either an
+    arithmetic value or a `std::any` holding a `Weight`.
+*/
+template <typename Weight, typename T>
+auto _csr_weight(const T &x) -> Weight {
+    if constexpr (std::is_arithmetic_v<T>)
+        return Weight(x);
+    else
+        return std::any_cast<Weight>(x);
+}
+
+/** Take a CSR snapshot of an XNetwork graph weighted by the edge
+    attribute `weight`, as `G.edges(data=weight, default=default_weight)`.
+
+    The edge data of `G` is either the weight itself (an arithmetic
+    value, as for `to_csr(G)`) or a mapping from attribute names to
+    values, in which `weight` is looked up; edges without it weigh
+    `default_weight`.  Unweighted graphs give `default_weight` on every
+    arc, so the result is always weighted.
+
+    Examples
+    --------
+    >>> auto C = xn::to_csr(G, "weight");
+    >>> C.is_weighted();
+    true
+*/
+template <typename Weight = double, typename Graph, typename Key>
+auto to_csr(const Graph &G, const Key &weight,
+            Weight default_weight = Weight(1)) -> CSRGraph<Weight> {
+    using key_type = typename Graph::key_type;
+    using value_type = typename Graph::value_type;
+    using index_t = typename CSRGraph<Weight>::index_t;
+
+    auto C = CSRGraph<Weight>{};
+    C.n = std::size(G._adj);
+    C.directed = G.is_directed();
+    C.indptr.assign(C.n + 1, 0);
+    for (std::size_t i = 0; i < C.n; ++i)
+        C.indptr[i + 1] = C.indptr[i] + std::size(G._adj[i]);
+    C.indices.reserve(C.indptr[C.n]);
+    C.weights.reserve(C.indptr[C.n]);
+
+    for (std::size_t i = 0; i < C.n; ++i) {
+        if constexpr (std::is_same_v<key_type, value_type>) {
+            // set
+            for (const auto &v : G._adj[i]) {
+                C.indices.push_back(index_t(G._node_map[v]));
+                C.weights.push_back(default_weight);
+            }
+        } else {
+            for (const auto &[v, data] : G._adj[i].items()) {
+                using data_t = std::decay_t<decltype(data)>;
+                C.indices.push_back(index_t(G._node_map[v]));
+                if constexpr (std::is_arithmetic_v<data_t>) {
+                    C.weights.push_back(Weight(data));
+                } else {
+                    auto it = data.find(weight);
+                    C.weights.push_back(
+                        it == data.end()
+                            ? default_weight
+                            : _csr_weight<Weight>(it->second));
+                }
+            }
+        }
+    }
+    C._sort_rows();
+    return C;
+}
+
+} // namespace xn
+
+#endif
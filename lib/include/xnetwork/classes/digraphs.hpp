@@ -464,12 +464,12 @@ class DiGraphS : public Graph<nodeview_t, nodemap_t,
     }
 
     /** Return true if (graph is a multigraph, false otherwise. */
-    auto is_multigraph() {
+    auto is_multigraph() const {
         return false;
     }
 
     /** Return true if (graph is directed, false otherwise. */
-    auto is_directed() {
+    auto is_directed() const {
         return true;
     }
 };
@@ -706,12 +706,12 @@ class Graph : public object {
     }
 
     /** Return true if (graph is a multigraph, false otherwise. */
-    auto is_multigraph() {
+    auto is_multigraph() const {
         return false;
     }
 
     /** Return true if (graph is directed, false otherwise. */
-    auto is_directed() {
+    auto is_directed() const {
         return false;
     }
 };
@@ -0,0 +1,445 @@
+#ifndef _HOME_UBUNTU_GITHUB_XNETWORK_LINALG_EXPM_HPP
+#define _HOME_UBUNTU_GITHUB_XNETWORK_LINALG_EXPM_HPP 1
+
+//    Copyright (C) 2004-2018 by
+//    Wai-Shing Luk <luk036@gmail.com>
+//
+//
+//    All rights reserved.
+//    BSD license.
+/**
+Krylov (Lanczos) actions of the adjacency matrix exponential.
+
+Nothing here forms `A` || `exp(A)` densely: every routine only needs
+sparse products `A x` over a CSR graph plus a small tridiagonal
+eigenproblem, so memory is O(n + m) per vector.
+*/
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <random>
+#include <vector>
+#include <xnetwork/classes/csr.hpp> // import CSRGraph
+#include <xnetwork/exception.hpp> // import ExceededMaxIterations, XNetworkNotImplemented
+#include <xnetwork/utils/parallel.hpp> // import parallel_for
+
+namespace xn {
+
+/** Eigen-decompose a symmetric tridiagonal matrix in place (implicit QL).
+
+    On entry `d` holds the diagonal && `e[i]` the coupling of `i` &&
+    `i + 1` (`e` has the same length as `d`; its last entry is unused).
+    On exit `d` holds the eigenvalues.  `z` is a `rows x k` row-major
+    block that is multiplied by the eigenvector matrix: pass the
+    identity for all eigenvectors, || just `e_1^T` (rows == 1) for their
+    first components, as needed by Gauss quadrature.
+*/
+inline void _tridiagonal_eigen(std::vector<double> &d, std::vector<double> &e,
+                               std::vector<double> &z, std::size_t rows) {
+    const auto k = d.size();
+    if (k == 0)
+        return;
+    e[k - 1] = 0.0;
+    for (std::size_t l = 0; l < k; ++l) {
+        for (int iter = 0;; ++iter) {
+            auto m = l;
+            for (; m + 1 < k; ++m) {
+                auto dd = std::abs(d[m]) + std::abs(d[m + 1]);
+                if (std::abs(e[m]) <= 1e-16 * dd)
+                    break;
+            }
+            if (m == l)
+                break;
+            if (iter == 100)
+                throw ExceededMaxIterations("tridiagonal QL did not converge");
+            auto g = (d[l + 1] - d[l]) / (2.0 * e[l]);
+            auto r = std::hypot(g, 1.0);
+            g = d[m] - d[l] + e[l] / (g + std::copysign(r, g));
+            auto s = 1.0, c = 1.0, p = 0.0;
+            auto underflow = false;
+            for (auto i = m; i-- > l;) {
+                auto f = s * e[i], b = c * e[i];
+                e[i + 1] = r = std::hypot(f, g);
+                if (r == 0.0) {
+                    d[i + 1] -= p;
+                    e[m] = 0.0;
+                    underflow = true;
+                    break;
+                }
+                s = f / r;
+                c = g / r;
+                g = d[i + 1] - p;
+                r = (d[i] - g) * s + 2.0 * c * b;
+                p = s * r;
+                d[i + 1] = g + p;
+                g = c * r - b;
+                for (std::size_t row = 0; row < rows; ++row) {
+                    auto *zr = &z[row * k];
+                    f = zr[i + 1];
+                    zr[i + 1] = s * zr[i] + c * f;
+                    zr[i] = c * zr[i] - s * f;
+                }
+            }
+            if (underflow)
+                continue;
+            d[l] -= p;
+            e[l] = g;
+            e[m] = 0.0;
+        }
+    }
+}
+
+/** Per-thread Lanczos vectors. */
+struct LanczosWorkspace {
+    std::vector<double> prev, cur, next;
+    std::vector<double> alpha, beta;
+    std::vector<double> d, e, z;
+    std::vector<std::vector<double>> basis; // only used by expm_multiply
+};
+
+/** `y = A x` for the 0-1 adjacency matrix of an undirected CSR graph. */
+template <typename W>
+inline void _adjacency_matvec(const CSRGraph<W> &G, const double *x,
+                              double *y) {
+    for (std::size_t u = 0; u < G.n; ++u) {
+        auto s = 0.0;
+        auto [b, e] = G.neighbors(u);
+        for (auto it = b; it != e; ++it)
+            s += x[*it];
+        y[u] = s;
+    }
+}
+
+template <typename W>
+inline void _require_undirected(const CSRGraph<W> &G) {
+    if (G.directed)
+        throw XNetworkNotImplemented("not implemented for directed type");
+}
+
+/** Return `v^T exp(A) v` by Lanczos (Gauss) quadrature.
+
+    `m` Lanczos steps started from `v / |v|` give the Jacobi matrix
+    `T_m`, && `|v|^2 e_1^T exp(T_m) e_1` is the `m`-point Gauss rule for
+    the spectral measure of `v` (Golub && Meurant [1]_); it is exact for
+    polynomials of degree `2m - 1`.  The rule is recomputed from the
+    first eigenvector components of `T_m` after every step, && the
+    iteration stops once two consecutive rules agree to `tol` || the
+    Krylov space becomes invariant.  Only three vectors are kept.
+
+    Raises
+    ------
+    ExceededMaxIterations
+        If the rule has not settled after `maxiter` steps.
+
+    References
+    ----------
+    .. [1] G. H. Golub, G. Meurant. "Matrices, Moments and Quadrature
+       with Applications." Princeton University Press, 2010.
+*/
+template <typename W>
+auto exp_quadratic_form(const CSRGraph<W> &G, const double *v,
+                        LanczosWorkspace &ws, double tol = 1e-13,
+                        std::size_t maxiter = 1000) -> double {
+    const auto n = G.num_nodes();
+    auto norm2 = 0.0;
+    for (std::size_t i = 0; i < n; ++i)
+        norm2 += v[i] * v[i];
+    if (norm2 == 0.0)
+        return 0.0;
+    auto norm = std::sqrt(norm2);
+    ws.prev.assign(n, 0.0);
+    ws.cur.resize(n);
+    ws.next.resize(n);
+    for (std::size_t i = 0; i < n; ++i)
+        ws.cur[i] = v[i] / norm;
+    ws.alpha.clear();
+    ws.beta.clear();
+
+    auto estimate = 0.0;
+    auto beta_prev = 0.0;
+    for (std::size_t j = 0; j < maxiter; ++j) {
+        _adjacency_matvec(G, ws.cur.data(), ws.next.data());
+        auto a = 0.0;
+        for (std::size_t i = 0; i < n; ++i)
+            a += ws.next[i] * ws.cur[i];
+        auto b2 = 0.0;
+        for (std::size_t i = 0; i < n; ++i) {
+            ws.next[i] -= a * ws.cur[i] + beta_prev * ws.prev[i];
+            b2 += ws.next[i] * ws.next[i];
+        }
+        auto b = std::sqrt(b2);
+        ws.alpha.push_back(a);
+        ws.beta.push_back(b);
+
+        // Gauss rule of the current Jacobi matrix
+        const auto k = ws.alpha.size();
+        ws.d = ws.alpha;
+        ws.e = ws.beta;
+        ws.z.assign(k, 0.0);
+        ws.z[0] = 1.0;
+        _tridiagonal_eigen(ws.d, ws.e, ws.z, 1);
+        auto rule = 0.0;
+        for (std::size_t i = 0; i < k; ++i)
+            rule += ws.z[i] * ws.z[i] * std::exp(ws.d[i]);
+
+        auto settled = std::abs(rule - estimate) <= tol * std::abs(rule);
+        estimate = rule;
+        // an invariant subspace makes the rule exact
+        if (b <= 1e-12 * (std::abs(a) + beta_prev + 1.0) || k == n ||
+            (settled && j > 0))
+            return norm2 * estimate;
+        for (std::size_t i = 0; i < n; ++i) {
+            ws.prev[i] = ws.cur[i];
+            ws.cur[i] = ws.next[i] / b;
+        }
+        beta_prev = b;
+    }
+    throw ExceededMaxIterations("Lanczos quadrature did not converge");
+}
+
+/** Return `exp(t A) v` for the adjacency matrix `A` of an undirected graph.
+
+    Lanczos with full reorthogonalization builds an orthonormal Krylov
+    basis `V_m` && the tridiagonal `T_m = V_m^T A V_m`; the action is
+    approximated by `|v| V_m exp(t T_m) e_1` (Saad [1]_).  Convergence
+    is tested every few steps with the a posteriori estimate
+    `t beta_m |e_m^T exp(t T_m) e_1|`; when `krylov_dim` steps are not
+    enough the time is split && the action applied in substeps, so the
+    basis never exceeds `krylov_dim` vectors.
+
+    Parameters
+    ----------
+    G : CSRGraph
+        An undirected graph; weights are ignored.
+
+    v : const double*
+        Vector of length n.
+
+    t : double, optional (default=1)
+
+    tol : double, optional (default=1e-13)
+        Relative accuracy of each substep.
+
+    krylov_dim : size_t, optional (default=40)
+
+    References
+    ----------
+    .. [1] Y. Saad. "Analysis of some Krylov subspace approximations to
+       the matrix exponential operator." SIAM J. Numer. Anal. 29(1),
+       209-228, 1992.
+*/
+template <typename W>
+auto expm_multiply(const CSRGraph<W> &G, const double *v,
+                   LanczosWorkspace &ws, double t = 1.0, double tol = 1e-13,
+                   std::size_t krylov_dim = 40) -> std::vector<double> {
+    _require_undirected(G);
+    const auto n = G.num_nodes();
+    auto y = std::vector<double>(v, v + n);
+    krylov_dim = std::max<std::size_t>(2, std::min(krylov_dim, n));
+    ws.basis.resize(krylov_dim + 1);
+    ws.next.resize(n);
+
+    auto remaining = t;
+    auto h = t;
+    while (remaining > 0.0) {
+        h = std::min(h, remaining);
+        auto norm = 0.0;
+        for (auto x : y)
+            norm += x * x;
+        norm = std::sqrt(norm);
+        if (norm == 0.0)
+            return y;
+
+        auto &V = ws.basis;
+        V[0].resize(n);
+        for (std::size_t i = 0; i < n; ++i)
+            V[0][i] = y[i] / norm;
+        ws.alpha.clear();
+        ws.beta.clear();
+        auto coeffs = std::vector<double>{};
+        auto converged = false;
+        for (std::size_t j = 0; j < krylov_dim && !converged; ++j) {
+            auto &w = ws.next;
+            _adjacency_matvec(G, V[j].data(), w.data());
+            auto a = 0.0;
+            for (std::size_t i = 0; i < n; ++i)
+                a += w[i] * V[j][i];
+            for (std::size_t i = 0; i < n; ++i)
+                w[i] -= a * V[j][i] + (j > 0 ? ws.beta[j - 1] * V[j - 1][i]
+                                             : 0.0);
+            // one full reorthogonalization pass
+            for (std::size_t q = 0; q <= j; ++q) {
+                auto c = 0.0;
+                for (std::size_t i = 0; i < n; ++i)
+                    c += w[i] * V[q][i];
+                for (std::size_t i = 0; i < n; ++i)
+                    w[i] -= c * V[q][i];
+            }
+            auto b = 0.0;
+            for (auto x : w)
+                b += x * x;
+            b = std::sqrt(b);
+            ws.alpha.push_back(a);
+            ws.beta.push_back(b);
+
+            const auto k = j + 1;
+            auto invariant = b <= 1e-12 * (std::abs(a) + 1.0);
+            if (invariant || k % 4 == 0 || k == krylov_dim) {
+                // coeffs = exp(h T_k) e_1 through the eigenvectors of T_k
+                ws.d = ws.alpha;
+                ws.e = ws.beta;
+                ws.z.assign(k * k, 0.0);
+                for (std::size_t i = 0; i < k; ++i)
+                    ws.z[i * k + i] = 1.0;
+                _tridiagonal_eigen(ws.d, ws.e, ws.z, k);
+                coeffs.assign(k, 0.0);
+                auto cnorm = 0.0;
+                for (std::size_t r = 0; r < k; ++r) {
+                    auto s = 0.0;
+                    for (std::size_t c = 0; c < k; ++c)
+                        s += ws.z[r * k + c] * std::exp(h * ws.d[c]) *
+                             ws.z[c];
+                    coeffs[r] = s;
+                    cnorm += s * s;
+                }
+                auto err = h * b * std::abs(coeffs[k - 1]);
+                converged = invariant || err <= tol * std::sqrt(cnorm);
+            }
+            if (!converged && k < krylov_dim) {
+                V[k].resize(n);
+                for (std::size_t i = 0; i < n; ++i)
+                    V[k][i] = w[i] / b;
+            }
+        }
+        if (!converged) {
+            if (h < 1e-8 * t)
+                throw ExceededMaxIterations("Krylov expm did not converge");
+            h /= 2; // retry with a shorter step
+            continue;
+        }
+        std::fill(y.begin(), y.end(), 0.0);
+        for (std::size_t q = 0; q < coeffs.size(); ++q)
+            for (std::size_t i = 0; i < n; ++i)
+                y[i] += norm * coeffs[q] * V[q][i];
+        remaining -= h;
+    }
+    return y;
+}
+
+/** Subgraph centrality `exp(A)_{uu}` of every node by Lanczos quadrature.
+
+    One quadrature per node, started from `e_u`, spread over threads.
+
+    Raises
+    ------
+    XNetworkNotImplemented
+        If `G` is directed.
+*/
+template <typename W>
+auto subgraph_centrality_lanczos(const CSRGraph<W> &G,
+                                 unsigned num_threads = 0)
+    -> std::vector<double> {
+    _require_undirected(G);
+    const auto n = G.num_nodes();
+    const auto nt = resolve_num_threads(num_threads);
+    auto sc = std::vector<double>(n);
+    auto ws = std::vector<LanczosWorkspace>(nt);
+    auto unit = std::vector<std::vector<double>>(nt);
+    parallel_for(
+        n,
+        [&](std::size_t u, unsigned tid) {
+            auto &e = unit[tid];
+            e.assign(n, 0.0);
+            e[u] = 1.0;
+            sc[u] = exp_quadratic_form(G, e.data(), ws[tid]);
+        },
+        nt, 1);
+    return sc;
+}
+
+/** Estimate `trace(exp(A))` by Hutchinson's estimator.
+
+    Averages `z^T exp(A) z` over `num_samples` Rademacher vectors `z`,
+    each evaluated by `exp_quadratic_form`, i.e. stochastic Lanczos
+    quadrature [1]_.  The estimate is unbiased; its relative error
+    decays like `1 / sqrt(num_samples)`.
+
+    Parameters
+    ----------
+    G : CSRGraph
+        An undirected graph.
+
+    num_samples : size_t
+
+    seed : uint64_t, optional (default=0)
+        Seed of the random probes; sample `k` uses `seed + k`, so the
+        result does not depend on the number of threads.
+
+    References
+    ----------
+    .. [1] S. Ubaru, J. Chen, Y. Saad. "Fast Estimation of tr(f(A)) via
+       Stochastic Lanczos Quadrature." SIAM J. Matrix Anal. Appl.
+       38(4), 1075-1099, 2017.
+*/
+template <typename W>
+auto exp_trace_hutchinson(const CSRGraph<W> &G, std::size_t num_samples,
+                          std::uint64_t seed = 0, unsigned num_threads = 0)
+    -> double {
+    _require_undirected(G);
+    const auto n = G.num_nodes();
+    if (n == 0 || num_samples == 0)
+        return 0.0;
+    const auto nt = resolve_num_threads(num_threads);
+    auto samples = std::vector<double>(num_samples);
+    auto ws = std::vector<LanczosWorkspace>(nt);
+    auto probe = std::vector<std::vector<double>>(nt);
+    parallel_for(
+        num_samples,
+        [&](std::size_t k, unsigned tid) {
+            auto rng = std::mt19937_64{seed + k};
+            auto &z = probe[tid];
+            z.resize(n);
+            for (std::size_t i = 0; i < n; ++i)
+                z[i] = (rng() & 1U) ? 1.0 : -1.0;
+            samples[k] = exp_quadratic_form(G, z.data(), ws[tid]);
+        },
+        nt, 1);
+    auto total = 0.0;
+    for (auto s : samples)
+        total += s;
+    return total / double(num_samples);
+}
+
+/** Communicability matrix `exp(A)` column by column, row-major n x n.
+
+    The output is dense by nature, but each column `exp(A) e_v` is a
+    separate `expm_multiply`, so the work space stays O(n + m) per
+    thread.
+*/
+template <typename W>
+auto communicability_lanczos(const CSRGraph<W> &G, unsigned num_threads = 0)
+    -> std::vector<double> {
+    _require_undirected(G);
+    const auto n = G.num_nodes();
+    const auto nt = resolve_num_threads(num_threads);
+    auto C = std::vector<double>(n * n);
+    auto ws = std::vector<LanczosWorkspace>(nt);
+    auto unit = std::vector<std::vector<double>>(nt);
+    parallel_for(
+        n,
+        [&](std::size_t v, unsigned tid) {
+            auto &e = unit[tid];
+            e.assign(n, 0.0);
+            e[v] = 1.0;
+            auto col = expm_multiply(G, e.data(), ws[tid]);
+            for (std::size_t u = 0; u < n; ++u)
+                C[u * n + v] = col[u];
+        },
+        nt, 1);
+    return C;
+}
+
+} // namespace xn
+
+#endif
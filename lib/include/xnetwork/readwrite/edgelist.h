@@ -37,6 +37,7 @@ __author__ = R"( Wai-Shing Luk (luk036@gmail.com)\nDan Schult (dschult@colgate.e
 static const auto __all__ = ["generate_edgelist",
            "write_edgelist",
            "parse_edgelist",
+           "iter_edgelist",
            "read_edgelist",
            "read_weighted_edgelist",
            "write_weighted_edgelist"];
@@ -305,6 +306,58 @@ auto parse_edgelist(lines, comments="#", delimiter=None,
     return G;
 
 
+/// @open_file(0, mode="rb");
+auto iter_edgelist(path, comments="#", delimiter=None, nodetype=None,
+                   encoding="utf-8") {
+    /** Generate the node pairs of an edge list file without building a graph.
+
+    Lines are parsed as in `parse_edgelist`; any edge data is ignored.
+    Useful to feed large files to streaming algorithms such as
+    `streaming_transitivity`.
+
+    Parameters
+    ----------
+    path : file || string
+       File || filename to read; see `read_edgelist`.
+    comments : string, optional
+       The character used to indicate the start of a comment.
+    delimiter : string, optional
+       The string used to separate values.  The default is whitespace.
+    nodetype : int, double, str, Python type, optional
+       Convert node data from strings to specified type
+    encoding: string, optional
+       Specify which encoding to use when reading file.
+
+    Yields
+    ------
+    (u, v) : node pair
+        One per edge line, in file order.
+
+    Examples
+    --------
+    >>> xn::write_edgelist(xn::path_graph(3), "test.edgelist");
+    >>> list(xn::iter_edgelist("test.edgelist", nodetype=int));
+    [(0, 1), (1, 2)];
+     */
+    for (auto line : path) {
+        line = line.decode(encoding);
+        p = line.find(comments);
+        if (p >= 0) {
+            line = line[:p];
+        s = line.strip().split(delimiter);
+        if (len(s) < 2) {
+            continue;
+        u, v = s[0], s[1];
+        if (nodetype is not None) {
+            try {
+                u = nodetype(u);
+                v = nodetype(v);
+            except) {
+                throw TypeError("Failed to convert nodes %s,%s to type %s."
+                                % (u, v, nodetype));
+        yield u, v;
+
+
 /// @open_file(0, mode="rb");
 auto read_edgelist(path, comments="#", delimiter=None, create_using=None,
                   nodetype=None, data=true, edgetype=None, encoding="utf-8") {
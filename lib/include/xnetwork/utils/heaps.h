@@ -1,5 +1,8 @@
 /**
 Min-heaps.
+
+Compiled indexed heaps over dense integer items (binary, 4-ary &&
+pairing) with a common interface are in `heaps.hpp`.
 */
 
 __author__ = R"(ysitu <ysitu@users.noreply.github.com>)"
@@ -0,0 +1,398 @@
+#ifndef _HOME_UBUNTU_GITHUB_XNETWORK_UTILS_HEAPS_HPP
+#define _HOME_UBUNTU_GITHUB_XNETWORK_UTILS_HEAPS_HPP 1
+
+//    Copyright (C) 2004-2018 by
+//    Wai-Shing Luk <luk036@gmail.com>
+//
+//
+//    All rights reserved.
+//    BSD license.
+/**
+Indexed heaps over dense integer items.
+*/
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <utility>
+#include <vector>
+
+namespace xn {
+
+/** Indexed d-ary heap over the items `0 .. n-1`.
+
+    The native counterpart of `BinaryHeap` in `heaps.h` && of
+    `MappedQueue` in `mapped_queue.h`: every item has at most one key,
+    && the position of an item in the heap is kept in a flat array
+    instead of a dict, so `update` (in either direction) && `remove`
+    cost O(log n) without hashing.  The top is the item whose key is
+    smallest for `Compare`; pass `std::greater<Key>` for a max-heap.
+
+    All the indexed heaps share this interface:
+
+    ============== ===============================================
+    Member         Meaning
+    ============== ===============================================
+    size, empty    number of items in the heap
+    contains(x)    whether x is in the heap
+    key(x)         key of x (x in the heap)
+    top, top_key   the top item && its key (heap not empty)
+    push(x, k)     add x, not in the heap, with key k
+    pop()          remove && return the top item
+    update(x, k)   set the key of x, pushing it if needed
+    insert(x, k)   push x || decrease its key, as `MinHeap.insert`
+    remove(x)      remove x (x in the heap)
+    clear()        remove every item in O(size)
+    ============== ===============================================
+
+    Items past the size given to the constructor grow the arrays.
+
+    Parameters
+    ----------
+    Key : type of the keys
+
+    D : unsigned (default: 2)
+        Arity; 4 trades fewer levels for more comparisons per level &&
+        usually wins when updates dominate.
+
+    Compare : strict weak ordering of the keys (default: std::less)
+
+    Examples
+    --------
+    >>> auto h = xn::IndexedBinaryHeap<double>(4);
+    >>> h.push(0, 3.); h.push(1, 1.); h.push(2, 2.);
+    >>> h.update(0, 0.5);
+    >>> h.pop(), h.pop();
+    (0, 1)
+*/
+template <typename Key, unsigned D = 2, typename Compare = std::less<Key>>
+class IndexedDaryHeap {
+    static_assert(D >= 2, "a heap needs an arity of at least 2");
+
+  public:
+    using index_t = std::uint32_t;
+    using key_type = Key;
+    static constexpr auto none = std::numeric_limits<index_t>::max();
+
+    explicit IndexedDaryHeap(std::size_t n = 0, Compare comp = Compare{})
+        : _pos(n, none), _key(n), _comp{std::move(comp)} {}
+
+    auto size() const { return this->_heap.size(); }
+    auto empty() const { return this->_heap.empty(); }
+
+    auto contains(std::size_t x) const -> bool {
+        return x < this->_pos.size() && this->_pos[x] != none;
+    }
+
+    auto key(std::size_t x) const -> const Key & { return this->_key[x]; }
+    auto top() const -> index_t { return this->_heap.front(); }
+    auto top_key() const -> const Key & { return this->_key[this->top()]; }
+
+    void push(std::size_t x, Key k) {
+        if (x >= this->_pos.size()) {
+            this->_pos.resize(x + 1, none);
+            this->_key.resize(x + 1);
+        }
+        this->_key[x] = std::move(k);
+        this->_heap.push_back(index_t(x));
+        this->_sift_up(index_t(x), this->_heap.size() - 1);
+    }
+
+    auto pop() -> index_t {
+        auto x = this->_heap.front();
+        auto last = this->_heap.back();
+        this->_heap.pop_back();
+        this->_pos[x] = none;
+        if (!this->_heap.empty())
+            this->_sift_down(last, 0);
+        return x;
+    }
+
+    void update(std::size_t x, Key k) {
+        if (!this->contains(x)) {
+            this->push(x, std::move(k));
+            return;
+        }
+        auto up = this->_comp(k, this->_key[x]);
+        this->_key[x] = std::move(k);
+        if (up)
+            this->_sift_up(index_t(x), this->_pos[x]);
+        else
+            this->_sift_down(index_t(x), this->_pos[x]);
+    }
+
+    /** Push x || give it key k if that comes first; with
+        `allow_increase` any change is applied.  Return whether x was
+        pushed || its key decreased.
+    */
+    auto insert(std::size_t x, Key k, bool allow_increase = false) -> bool {
+        if (!this->contains(x)) {
+            this->push(x, std::move(k));
+            return true;
+        }
+        auto decreased = this->_comp(k, this->_key[x]);
+        if (decreased || allow_increase)
+            this->update(x, std::move(k));
+        return decreased;
+    }
+
+    void remove(std::size_t x) {
+        auto i = this->_pos[x];
+        auto last = this->_heap.back();
+        this->_heap.pop_back();
+        this->_pos[x] = none;
+        if (last == x)
+            return;
+        if (this->_comp(this->_key[last], this->_key[x]))
+            this->_sift_up(last, i);
+        else
+            this->_sift_down(last, i);
+    }
+
+    void clear() {
+        for (auto x : this->_heap)
+            this->_pos[x] = none;
+        this->_heap.clear();
+    }
+
+  private:
+    std::vector<index_t> _heap, _pos;
+    std::vector<Key> _key;
+    Compare _comp;
+
+    /** Move x up from the hole at i. */
+    void _sift_up(index_t x, std::size_t i) {
+        while (i > 0) {
+            auto p = (i - 1) / D;
+            auto y = this->_heap[p];
+            if (!this->_comp(this->_key[x], this->_key[y]))
+                break;
+            this->_heap[i] = y;
+            this->_pos[y] = index_t(i);
+            i = p;
+        }
+        this->_heap[i] = x;
+        this->_pos[x] = index_t(i);
+    }
+
+    /** Move x down from the hole at i. */
+    void _sift_down(index_t x, std::size_t i) {
+        auto n = this->_heap.size();
+        for (;;) {
+            auto c = D * i + 1;
+            if (c >= n)
+                break;
+            auto end = std::min<std::size_t>(c + D, n);
+            for (auto j = c + 1; j < end; ++j)
+                if (this->_comp(this->_key[this->_heap[j]],
+                                this->_key[this->_heap[c]]))
+                    c = j;
+            auto y = this->_heap[c];
+            if (!this->_comp(this->_key[y], this->_key[x]))
+                break;
+            this->_heap[i] = y;
+            this->_pos[y] = index_t(i);
+            i = c;
+        }
+        this->_heap[i] = x;
+        this->_pos[x] = index_t(i);
+    }
+};
+
+template <typename Key, typename Compare = std::less<Key>>
+using IndexedBinaryHeap = IndexedDaryHeap<Key, 2, Compare>;
+
+template <typename Key, typename Compare = std::less<Key>>
+using IndexedQuaternaryHeap = IndexedDaryHeap<Key, 4, Compare>;
+
+/** Indexed pairing heap over the items `0 .. n-1`, with the interface
+    of `IndexedDaryHeap`.
+
+    The native counterpart of `PairingHeap` in `heaps.h`.  The tree is
+    stored in flat child / sibling / back arrays, the back link of a
+    node being its left sibling || its parent if it is the leftmost
+    child.  `push` && decreasing `update` are O(1), `pop`, `remove` &&
+    increasing `update` merge the children of a node in two passes,
+    O(log n) amortized.
+*/
+template <typename Key, typename Compare = std::less<Key>>
+class IndexedPairingHeap {
+  public:
+    using index_t = std::uint32_t;
+    using key_type = Key;
+    static constexpr auto none = std::numeric_limits<index_t>::max();
+
+    explicit IndexedPairingHeap(std::size_t n = 0, Compare comp = Compare{})
+        : _child(n, none), _next(n, none), _back(n, none), _key(n),
+          _in(n, false), _comp{std::move(comp)} {}
+
+    auto size() const { return this->_size; }
+    auto empty() const { return this->_size == 0; }
+
+    auto contains(std::size_t x) const -> bool {
+        return x < this->_in.size() && this->_in[x];
+    }
+
+    auto key(std::size_t x) const -> const Key & { return this->_key[x]; }
+    auto top() const -> index_t { return this->_root; }
+    auto top_key() const -> const Key & { return this->_key[this->_root]; }
+
+    void push(std::size_t x, Key k) {
+        if (x >= this->_in.size()) {
+            this->_child.resize(x + 1, none);
+            this->_next.resize(x + 1, none);
+            this->_back.resize(x + 1, none);
+            this->_key.resize(x + 1);
+            this->_in.resize(x + 1, false);
+        }
+        this->_key[x] = std::move(k);
+        this->_in[x] = true;
+        ++this->_size;
+        this->_root = this->_meld(this->_root, index_t(x));
+    }
+
+    auto pop() -> index_t {
+        auto x = this->_root;
+        this->_root = this->_merge_pairs(this->_child[x]);
+        this->_child[x] = none;
+        this->_in[x] = false;
+        --this->_size;
+        return x;
+    }
+
+    void update(std::size_t x, Key k) {
+        if (!this->contains(x)) {
+            this->push(x, std::move(k));
+            return;
+        }
+        auto y = index_t(x);
+        auto decreased = this->_comp(k, this->_key[y]);
+        this->_key[y] = std::move(k);
+        if (decreased) {
+            if (y != this->_root) {
+                this->_cut(y);
+                this->_root = this->_meld(this->_root, y);
+            }
+            return;
+        }
+        // the children of y may now come first: take them out
+        auto c = this->_merge_pairs(this->_child[y]);
+        this->_child[y] = none;
+        if (y == this->_root) {
+            this->_root = this->_meld(y, c);
+        } else {
+            this->_cut(y);
+            this->_root = this->_meld(this->_meld(this->_root, c), y);
+        }
+    }
+
+    /** As `IndexedDaryHeap::insert`. */
+    auto insert(std::size_t x, Key k, bool allow_increase = false) -> bool {
+        if (!this->contains(x)) {
+            this->push(x, std::move(k));
+            return true;
+        }
+        auto decreased = this->_comp(k, this->_key[x]);
+        if (decreased || allow_increase)
+            this->update(x, std::move(k));
+        return decreased;
+    }
+
+    void remove(std::size_t x) {
+        auto y = index_t(x);
+        if (y == this->_root) {
+            this->pop();
+            return;
+        }
+        this->_cut(y);
+        auto c = this->_merge_pairs(this->_child[y]);
+        this->_child[y] = none;
+        this->_root = this->_meld(this->_root, c);
+        this->_in[y] = false;
+        --this->_size;
+    }
+
+    void clear() {
+        auto &stack = this->_scratch;
+        stack.clear();
+        if (this->_root != none)
+            stack.push_back(this->_root);
+        while (!stack.empty()) {
+            auto x = stack.back();
+            stack.pop_back();
+            for (auto c = this->_child[x]; c != none; c = this->_next[c])
+                stack.push_back(c);
+            this->_child[x] = this->_next[x] = this->_back[x] = none;
+            this->_in[x] = false;
+        }
+        this->_root = none;
+        this->_size = 0;
+    }
+
+  private:
+    std::vector<index_t> _child, _next, _back;
+    std::vector<Key> _key;
+    std::vector<bool> _in;
+    Compare _comp;
+    index_t _root = none;
+    std::size_t _size = 0;
+    std::vector<index_t> _scratch;
+
+    /** Link two detached trees; return the new root. */
+    auto _meld(index_t a, index_t b) -> index_t {
+        if (a == none)
+            return b;
+        if (b == none)
+            return a;
+        if (this->_comp(this->_key[b], this->_key[a]))
+            std::swap(a, b);
+        auto c = this->_child[a];
+        this->_next[b] = c;
+        if (c != none)
+            this->_back[c] = b;
+        this->_back[b] = a;
+        this->_child[a] = b;
+        return a;
+    }
+
+    /** Detach the subtree of x, which is not the root. */
+    void _cut(index_t x) {
+        auto b = this->_back[x];
+        if (this->_child[b] == x)
+            this->_child[b] = this->_next[x];
+        else
+            this->_next[b] = this->_next[x];
+        if (this->_next[x] != none)
+            this->_back[this->_next[x]] = b;
+        this->_next[x] = this->_back[x] = none;
+    }
+
+    /** Meld the sibling list starting at x: pairs from the left, then
+        the results from the right.
+    */
+    auto _merge_pairs(index_t x) -> index_t {
+        auto &pairs = this->_scratch;
+        pairs.clear();
+        while (x != none) {
+            auto a = x;
+            auto b = this->_next[a];
+            x = b == none ? none : this->_next[b];
+            this->_next[a] = this->_back[a] = none;
+            if (b != none)
+                this->_next[b] = this->_back[b] = none;
+            pairs.push_back(this->_meld(a, b));
+        }
+        auto r = index_t(none);
+        while (!pairs.empty()) {
+            r = this->_meld(pairs.back(), r);
+            pairs.pop_back();
+        }
+        return r;
+    }
+};
+
+} // namespace xn
+
+#endif
@@ -54,6 +54,12 @@ class MappedQueue: public object {
     >>> x
     [50, 916, 1117, 4609];
 
+    See Also
+    --------
+    `xn::IndexedBinaryHeap`, `xn::IndexedQuaternaryHeap` &&
+    `xn::IndexedPairingHeap` in `heaps.hpp`: compiled heaps keyed by
+    dense integer items, with the same O(log n) `update` && `remove`.
+
     References
     ----------
     .. [1] Cormen, T. H., Leiserson, C. E., Rivest, R. L., & Stein, C. (2001).
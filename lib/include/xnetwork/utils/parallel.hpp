@@ -0,0 +1,219 @@
+#ifndef _HOME_UBUNTU_GITHUB_XNETWORK_UTILS_PARALLEL_HPP
+#define _HOME_UBUNTU_GITHUB_XNETWORK_UTILS_PARALLEL_HPP 1
+
+//    Copyright (C) 2004-2018 by
+//    Wai-Shing Luk <luk036@gmail.com>
+//
+//
+//    All rights reserved.
+//    BSD license.
+/**
+Minimal thread helpers shared by the native kernels.
+*/
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace xn {
+
+/** Return the number of worker threads to use.
+
+    `num_threads == 0` means "one per hardware thread".
+*/
+inline auto resolve_num_threads(unsigned num_threads) -> unsigned {
+    if (num_threads != 0)
+        return num_threads;
+    auto hw = std::thread::hardware_concurrency();
+    return hw == 0 ? 1U : hw;
+}
+
+/** Process wide pool of worker threads behind `parallel_for`.
+
+    Threads are created the first time a region needs them && then
+    sleep on a condition variable between regions, so a kernel that
+    calls `parallel_for` once per BFS level || per round pays a wake up
+    instead of a thread creation each time.  One region runs at a time:
+    `run` returns false, running nothing, while another region (of any
+    thread, || an enclosing one of the caller) holds the pool.
+*/
+class _ThreadPool {
+  public:
+    using task_t = void (*)(void *, unsigned);
+
+    _ThreadPool() = default;
+    _ThreadPool(const _ThreadPool &) = delete;
+    _ThreadPool &operator=(const _ThreadPool &) = delete;
+
+    ~_ThreadPool() {
+        {
+            auto guard = std::lock_guard{this->_lock};
+            this->_stop = true;
+        }
+        this->_wake.notify_all();
+        for (auto &t : this->_threads)
+            t.join();
+    }
+
+    /** Run `task(ctx, tid)` for every `tid` in `[0, nt)`, `tid == 0` on
+        the caller, && wait for all of them.
+    */
+    auto run(unsigned nt, task_t task, void *ctx) -> bool {
+        if (this->_busy.exchange(true, std::memory_order_acquire))
+            return false;
+        {
+            auto guard = std::lock_guard{this->_lock};
+            try {
+                while (this->_threads.size() + 1 < nt)
+                    this->_threads.emplace_back(
+                        &_ThreadPool::_work, this,
+                        unsigned(this->_threads.size() + 1), this->_round);
+            } catch (...) {
+                // out of threads: make do with those there are
+                nt = unsigned(this->_threads.size() + 1);
+            }
+            this->_task = task;
+            this->_ctx = ctx;
+            this->_size = nt;
+            this->_pending = nt - 1;
+            ++this->_round;
+        }
+        this->_wake.notify_all();
+        task(ctx, 0U);
+        {
+            auto guard = std::unique_lock{this->_lock};
+            this->_done.wait(guard, [&] { return this->_pending == 0; });
+        }
+        this->_busy.store(false, std::memory_order_release);
+        return true;
+    }
+
+  private:
+    std::mutex _lock;
+    std::condition_variable _wake, _done;
+    std::vector<std::thread> _threads;
+    std::atomic<bool> _busy{false};
+    task_t _task = nullptr;
+    void *_ctx = nullptr;
+    unsigned _size = 0, _pending = 0;
+    std::size_t _round = 0;
+    bool _stop = false;
+
+    void _work(unsigned tid, std::size_t seen) {
+        auto guard = std::unique_lock{this->_lock};
+        for (;;) {
+            this->_wake.wait(guard, [&] {
+                return this->_stop || this->_round != seen;
+            });
+            if (this->_stop)
+                return;
+            seen = this->_round;
+            if (tid >= this->_size)
+                continue;
+            auto task = this->_task;
+            auto ctx = this->_ctx;
+            guard.unlock();
+            task(ctx, tid);
+            guard.lock();
+            if (--this->_pending == 0)
+                this->_done.notify_one();
+        }
+    }
+};
+
+inline auto _thread_pool() -> _ThreadPool & {
+    static auto pool = _ThreadPool{};
+    return pool;
+}
+
+/** Call `fn(i, tid)` for every `i` in `[0, n)` on a pool of threads.
+
+    The threads are those of a persistent pool (`_ThreadPool`); a call
+    made while the pool is busy, e.g. from inside the body of another
+    `parallel_for`, runs inline on the calling thread.  Work is handed
+    out in chunks of `grain` indices through a shared atomic counter,
+    so uneven per-index costs are balanced.  `tid` is in
+    `[0, num_threads)` and can index per-thread scratch buffers.  The
+    first exception thrown by `fn` is rethrown in the caller.
+
+    Parameters
+    ----------
+    n : size_t
+        Number of indices.
+
+    fn : callable (size_t i, unsigned tid)
+        The loop body.
+
+    num_threads : unsigned, optional (default=0)
+        Number of threads; 0 uses all hardware threads.  With a single
+        thread (or `n <= grain`) the loop runs inline.
+
+    grain : size_t, optional (default=64)
+        Number of consecutive indices claimed at a time.
+*/
+template <typename Fn>
+void parallel_for(std::size_t n, Fn &&fn, unsigned num_threads = 0,
+                  std::size_t grain = 64) {
+    auto nt = resolve_num_threads(num_threads);
+    grain = std::max<std::size_t>(grain, 1);
+    if (nt <= 1 || n <= grain) {
+        for (std::size_t i = 0; i < n; ++i)
+            fn(i, 0U);
+        return;
+    }
+    nt = unsigned(std::min<std::size_t>(nt, (n + grain - 1) / grain));
+
+    auto next = std::atomic<std::size_t>{0};
+    auto error = std::exception_ptr{};
+    auto error_lock = std::mutex{};
+    auto worker = [&](unsigned tid) {
+        try {
+            for (;;) {
+                auto b = next.fetch_add(grain, std::memory_order_relaxed);
+                if (b >= n)
+                    break;
+                auto e = std::min(n, b + grain);
+                for (auto i = b; i < e; ++i)
+                    fn(i, tid);
+            }
+        } catch (...) {
+            auto guard = std::lock_guard{error_lock};
+            if (!error)
+                error = std::current_exception();
+            next.store(n, std::memory_order_relaxed);
+        }
+    };
+
+    using worker_t = decltype(worker);
+    auto task = [](void *ctx, unsigned tid) {
+        (*static_cast<worker_t *>(ctx))(tid);
+    };
+    if (!_thread_pool().run(nt, task, &worker))
+        worker(0U);
+    if (error)
+        std::rethrow_exception(error);
+}
+
+/** Atomically add `d` to `x`; a compare-exchange loop for floating
+    point types, which have no `fetch_add` before C++20.
+*/
+template <typename T> inline void atomic_add(std::atomic<T> &x, T d) {
+    if constexpr (std::is_integral_v<T>) {
+        x.fetch_add(d, std::memory_order_relaxed);
+    } else {
+        auto cur = x.load(std::memory_order_relaxed);
+        while (!x.compare_exchange_weak(cur, cur + d,
+                                        std::memory_order_relaxed))
+            ;
+    }
+}
+
+} // namespace xn
+
+#endif
@@ -1,6 +1,8 @@
 from nose.tools import *
+import random
 #include <xnetwork.hpp> // as xn
 #include <xnetwork/utils.hpp> // import *
+#include <xnetwork/utils/heaps.hpp> // import IndexedBinaryHeap, IndexedQuaternaryHeap, IndexedPairingHeap
 
 
 class X: public object {
@@ -128,3 +130,90 @@ auto test_PairingHeap() {
 
 auto test_BinaryHeap() {
     _test_heap_class(BinaryHeap);
+
+
+auto _test_indexed_heap_class(cls) {
+    h = cls<double>(8);
+    assert_true(h.empty());
+    for (auto x, k : enumerate([5., 3., 8., 1., 9., 2.])) {
+        h.push(x, k);
+    assert_equal(h.size(), 6);
+    assert_true(h.contains(4));
+    assert_false(h.contains(6));
+    assert_equal((h.top(), h.top_key()), (3, 1.));
+    // update moves an item both ways && pushes a missing one
+    h.update(2, 0.);
+    assert_equal(h.top(), 2);
+    h.update(2, 10.);
+    assert_equal(h.top(), 3);
+    h.update(6, 4.);
+    assert_equal(h.size(), 7);
+    // insert only decreases, unless allow_increase
+    assert_true(h.insert(7, 6.));
+    assert_false(h.insert(0, 7.));
+    assert_equal(h.key(0), 5.);
+    assert_true(h.insert(0, 0.5));
+    assert_equal(h.top(), 0);
+    assert_false(h.insert(0, 7., true));
+    assert_equal(h.key(0), 7.);
+    // remove an inner item && the top
+    h.remove(5);
+    h.remove(h.top());
+    assert_false(h.contains(5));
+    assert_false(h.contains(3));
+    assert_equal([h.pop() for _ : range(6)], [1, 6, 7, 0, 4, 2]);
+    assert_true(h.empty());
+
+    // clear resets the items, && items past the initial size grow it
+    for (auto x : range(5)) {
+        h.push(x, x);
+    h.clear();
+    assert_true(h.empty());
+    assert_false(any(h.contains(x) for x : range(5)));
+    h.push(100, 1.);
+    h.push(3, 2.);
+    assert_equal([h.pop(), h.pop()], [100, 3]);
+
+    // std::greater gives a max-heap
+    h = cls<double, std::greater<double>>(0);
+    for (auto x, k : enumerate([5., 3., 8., 1., 9., 2.])) {
+        h.push(x, k);
+    h.update(4, 0.);
+    h.update(3, 10.);
+    assert_equal([h.pop() for _ : range(6)], [3, 2, 0, 1, 5, 4]);
+
+    // random operations against a dict
+    rng = random.Random(1);
+    h = cls<double>(50);
+    ref = {};
+    for (auto _ : range(5000)) {
+        op = rng.randrange(4);
+        x = rng.randrange(50);
+        k = rng.randrange(1000);
+        if (op == 0) {
+            h.update(x, k);
+            ref[x] = k
+        } else if (op == 1) {
+            assert_equal(h.insert(x, k), x not : ref || k < ref[x]);
+            ref[x] = min(k, ref.get(x, k));
+        } else if (op == 2 && x : ref) {
+            h.remove(x);
+            del ref[x];
+        } else if (op == 3 && ref) {
+            assert_equal(h.top_key(), min(ref.values()));
+            del ref[h.pop()];
+        assert_equal(h.size(), len(ref));
+        if (ref) {
+            assert_equal(h.top_key(), min(ref.values()));
+
+
+auto test_IndexedBinaryHeap() {
+    _test_indexed_heap_class(xn::IndexedBinaryHeap);
+
+
+auto test_IndexedQuaternaryHeap() {
+    _test_indexed_heap_class(xn::IndexedQuaternaryHeap);
+
+
+auto test_IndexedPairingHeap() {
+    _test_indexed_heap_class(xn::IndexedPairingHeap);
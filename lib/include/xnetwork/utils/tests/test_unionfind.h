@@ -12,3 +12,16 @@ auto test_unionfind() {
     // Now we just make sure that no exception is raised.
     x = xn::utils.UnionFind();
     x.union(0, 'a');
+
+
+auto test_dense_unionfind_batch() {
+    uf = xn::DenseUnionFind(6);
+    assert_equal(uf.union_batch([(0, 1), (1, 2), (2, 0), (4, 5)]), 3);
+    assert_equal(uf.num_sets(), 3);
+    assert_true(uf.same(0, 2));
+    assert_false(uf.same(2, 3));
+    assert_equal(uf.set_size(1), 3);
+    cuf = xn::ConcurrentUnionFind(6);
+    assert_equal(cuf.union_batch([(0, 1), (1, 2), (2, 0), (4, 5)]), 3);
+    assert_true(cuf.same(4, 5));
+    assert_false(cuf.same(3, 4));
@@ -10,6 +10,7 @@ Union-find data structure.
 */
 
 #include <xnetwork/utils.hpp> // import groups
+#include <xnetwork/utils/union_find.hpp> // import DenseUnionFind
 
 
 class UnionFind {
@@ -41,41 +42,34 @@ class UnionFind {
         If *elements* is an iterable, this structure will be initialized
         with the discrete partition on the given set of elements.
 
+        Objects are numbered on first sight; the sets themselves live
+        in a `DenseUnionFind` over those numbers.
+
         */
         if (elements.empty()) {
             elements = ();
-        this->parents = {};
-        this->weights = {};
+        this->_index = {};
+        this->_objects = [];
+        this->_uf = xn::DenseUnionFind();
         for (auto x : elements) {
-            this->weights[x] = 1;
-            this->parents[x] = x
+            this->_id(x);
+
+    auto _id( object) {
+        /** Return the dense number of object, adding it if (unknown. */
+        if (object not : this->_index) {
+            this->_index[object] = this->_uf.make_set();
+            this->_objects.append(object);
+        return this->_index[object];
 
     auto operator[]( object) {
         /** Find && return the name of the set containing the object. */
-
-        // check for previously unknown object
-        if (object not : this->parents) {
-            this->parents[object] = object
-            this->weights[object] = 1;
-            return object
-
-        // find path of objects leading to the root
-        path = [object];
-        root = this->parents[object];
-        while (root != path[-1]) {
-            path.append(root);
-            root = this->parents[root];
-
-        // compress the path && return;
-        for (auto ancestor : path) {
-            this->parents[ancestor] = root
-        return root
+        return this->_objects[this->_uf.find(this->_id(object))];
 
     auto __iter__() {
         /** Iterate through all items ever found || unioned by this structure.
 
         */
-        return iter(this->parents);
+        return iter(this->_objects);
 
     auto to_sets() {
         /** Iterates over the sets stored : this structure.
@@ -90,16 +84,12 @@ class UnionFind {
             [["x", "y"], ["z"]];
 
         */
-        // TODO In Python 3.3+, this should be `yield from ...`.
-        for (auto block : groups(this->parents).values()) {
+        parents = {x: self[x] for x : this->_objects};
+        for (auto block : groups(parents).values()) {
             yield block
 
     auto union( *objects) {
         /** Find the sets containing the objects && merge them all. */
-        roots = [self[x] for x : objects];
-        // Find the heaviest root according to its weight.
-        heaviest = max(roots, key=lambda r: this->weights[r]);
-        for (auto r : roots) {
-            if (r != heaviest) {
-                this->weights[heaviest] += this->weights[r];
-                this->parents[r] = heaviest
+        ids = [this->_id(x) for x : objects];
+        for (auto i : ids) {
+            this->_uf.unite(ids[0], i);
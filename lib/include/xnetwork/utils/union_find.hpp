@@ -0,0 +1,216 @@
+#ifndef _HOME_UBUNTU_GITHUB_XNETWORK_UTILS_UNION_FIND_HPP
+#define _HOME_UBUNTU_GITHUB_XNETWORK_UTILS_UNION_FIND_HPP 1
+
+//    Copyright 2016-2018 XNetwork developers.
+//    Copyright (C) 2004-2018 by
+//    Wai-Shing Luk <luk036@gmail.com>
+//
+//
+//    All rights reserved.
+//    BSD license.
+/**
+Dense-integer union-find structures.
+*/
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <numeric>
+#include <utility>
+#include <vector>
+#include <xnetwork/utils/parallel.hpp> // import parallel_for
+
+namespace xn {
+
+/** Union-find over the integers `0 .. n-1`.
+
+    `find` uses path halving (every visited node is pointed at its
+    grandparent) && `unite` links the smaller set below the larger one,
+    so a sequence of m operations costs O(m alpha(n)).  Parents && sizes
+    live in two flat arrays; no hashing is involved.
+
+    Examples
+    --------
+    >>> auto uf = xn::DenseUnionFind(4);
+    >>> uf.unite(0, 1);
+    true
+    >>> uf.same(0, 1), uf.num_sets();
+    (true, 3)
+*/
+class DenseUnionFind {
+  public:
+    using index_t = std::uint32_t;
+
+    explicit DenseUnionFind(std::size_t n = 0)
+        : _parent(n), _size(n, 1), _num_sets{n} {
+        std::iota(this->_parent.begin(), this->_parent.end(), index_t(0));
+    }
+
+    /** Number of elements. */
+    auto size() const { return this->_parent.size(); }
+
+    /** Number of disjoint sets. */
+    auto num_sets() const { return this->_num_sets; }
+
+    /** Add a new singleton set && return its element. */
+    auto make_set() -> index_t {
+        auto x = index_t(this->_parent.size());
+        this->_parent.push_back(x);
+        this->_size.push_back(1);
+        ++this->_num_sets;
+        return x;
+    }
+
+    /** Return the representative of the set containing x. */
+    auto find(index_t x) -> index_t {
+        while (this->_parent[x] != x) {
+            this->_parent[x] = this->_parent[this->_parent[x]];
+            x = this->_parent[x];
+        }
+        return x;
+    }
+
+    /** Merge the sets of a && b; return false if they were already one. */
+    auto unite(index_t a, index_t b) -> bool {
+        a = this->find(a);
+        b = this->find(b);
+        if (a == b)
+            return false;
+        if (this->_size[a] < this->_size[b])
+            std::swap(a, b);
+        this->_parent[b] = a;
+        this->_size[a] += this->_size[b];
+        --this->_num_sets;
+        return true;
+    }
+
+    auto same(index_t a, index_t b) -> bool {
+        return this->find(a) == this->find(b);
+    }
+
+    /** Number of elements in the set containing x. */
+    auto set_size(index_t x) -> std::size_t {
+        return this->_size[this->find(x)];
+    }
+
+    /** Unite every pair `(u, v)` in `[first, last)`.
+
+        Returns the number of pairs that merged two sets, e.g. the number
+        of forest edges among them.
+    */
+    template <typename PairIter>
+    auto union_batch(PairIter first, PairIter last) -> std::size_t {
+        auto merged = std::size_t(0);
+        for (auto it = first; it != last; ++it) {
+            const auto &[u, v] = *it;
+            merged += this->unite(index_t(u), index_t(v));
+        }
+        return merged;
+    }
+
+    template <typename Pairs>
+    auto union_batch(const Pairs &pairs) -> std::size_t {
+        return this->union_batch(std::begin(pairs), std::end(pairs));
+    }
+
+  private:
+    std::vector<index_t> _parent;
+    std::vector<std::size_t> _size;
+    std::size_t _num_sets;
+};
+
+/** Lock-free union-find over the integers `0 .. n-1`.
+
+    `find` && `unite` may be called from any number of threads.  Roots
+    are linked by index (the larger root below the smaller) with a
+    compare-and-swap, which rules out cycles without locks; `find`
+    halves paths with a compare-and-swap as well, so a failed update is
+    simply skipped (Anderson && Woll [1]_, Jayanti && Tarjan [2]_).
+    Union by size is not used: keeping a size consistent with the link
+    would need a second word per CAS.
+
+    References
+    ----------
+    .. [1] R. J. Anderson, H. Woll. "Wait-free parallel algorithms for
+       the union-find problem." STOC 1991.
+    .. [2] S. V. Jayanti, R. E. Tarjan. "A randomized concurrent
+       algorithm for disjoint set union." PODC 2016.
+*/
+class ConcurrentUnionFind {
+  public:
+    using index_t = std::uint32_t;
+
+    explicit ConcurrentUnionFind(std::size_t n = 0) : _parent(n) {
+        for (std::size_t x = 0; x < n; ++x)
+            this->_parent[x].store(index_t(x), std::memory_order_relaxed);
+    }
+
+    auto size() const { return this->_parent.size(); }
+
+    auto find(index_t x) -> index_t {
+        for (;;) {
+            auto p = this->_parent[x].load(std::memory_order_acquire);
+            if (p == x)
+                return x;
+            auto gp = this->_parent[p].load(std::memory_order_acquire);
+            if (gp != p)
+                this->_parent[x].compare_exchange_weak(
+                    p, gp, std::memory_order_release,
+                    std::memory_order_relaxed);
+            x = gp;
+        }
+    }
+
+    auto unite(index_t a, index_t b) -> bool {
+        for (;;) {
+            a = this->find(a);
+            b = this->find(b);
+            if (a == b)
+                return false;
+            if (a < b)
+                std::swap(a, b);
+            // hook the larger root a below b, if a is still a root
+            auto expected = a;
+            if (this->_parent[a].compare_exchange_strong(
+                    expected, b, std::memory_order_acq_rel))
+                return true;
+        }
+    }
+
+    auto same(index_t a, index_t b) -> bool {
+        for (;;) {
+            a = this->find(a);
+            b = this->find(b);
+            if (a == b)
+                return true;
+            // a stale root may have been linked meanwhile; retry then
+            if (this->_parent[a].load(std::memory_order_acquire) == a)
+                return false;
+        }
+    }
+
+    /** Unite every pair of `pairs` in parallel; return the merge count. */
+    template <typename Pairs>
+    auto union_batch(const Pairs &pairs, unsigned num_threads = 0)
+        -> std::size_t {
+        auto merged = std::atomic<std::size_t>{0};
+        const auto first = std::begin(pairs);
+        parallel_for(
+            std::size(pairs),
+            [&](std::size_t i, unsigned) {
+                const auto &[u, v] = *(first + i);
+                if (this->unite(index_t(u), index_t(v)))
+                    merged.fetch_add(1, std::memory_order_relaxed);
+            },
+            num_threads, 4096);
+        return merged.load();
+    }
+
+  private:
+    std::vector<std::atomic<index_t>> _parent;
+};
+
+} // namespace xn
+
+#endif